@@ -18,13 +18,17 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include <SFCGAL/Coordinate.h>
 
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/numeric.h>
+#include <SFCGAL/detail/lazyBytes.h>
+#include <SFCGAL/detail/deepCopy.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -40,7 +44,14 @@ Coordinate::Coordinate():
 Coordinate::Coordinate( const Kernel::FT& x, const Kernel::FT& y ):
     _storage( Kernel::Point_2( x, y ) )
 {
+#ifdef SFCGAL_USE_INEXACT_KERNEL
 
+    // also the double constructor
+    if ( !std::isfinite( x ) || !std::isfinite( y ) ) {
+        BOOST_THROW_EXCEPTION( NonFiniteValueException( "cannot create coordinate with non finite value" ) );
+    }
+
+#endif
 }
 
 ///
@@ -49,9 +60,17 @@ Coordinate::Coordinate( const Kernel::FT& x, const Kernel::FT& y ):
 Coordinate::Coordinate( const Kernel::FT& x, const Kernel::FT& y, const Kernel::FT& z ):
     _storage( Kernel::Point_3( x, y, z ) )
 {
+#ifdef SFCGAL_USE_INEXACT_KERNEL
 
+    // also the double constructor
+    if ( !std::isfinite( x ) || !std::isfinite( y ) || !std::isfinite( z ) ) {
+        BOOST_THROW_EXCEPTION( NonFiniteValueException( "cannot create coordinate with non finite value" ) );
+    }
+
+#endif
 }
 
+#ifndef SFCGAL_USE_INEXACT_KERNEL
 
 ///
 ///
@@ -62,7 +81,8 @@ Coordinate::Coordinate( const double& x, const double& y )
         BOOST_THROW_EXCEPTION( NonFiniteValueException( "cannot create coordinate with non finite value" ) );
     }
 
-    _storage = Kernel::Point_2( x, y );
+    Double_2 storage = {{ x, y }};
+    _storage = storage ;
 }
 
 ///
@@ -74,8 +94,10 @@ Coordinate::Coordinate( const double& x, const double& y, const double& z )
         BOOST_THROW_EXCEPTION( NonFiniteValueException( "cannot create coordinate with non finite value" ) );
     }
 
-    _storage = Kernel::Point_3( x, y, z );
+    Double_3 storage = {{ x, y, z }};
+    _storage = storage ;
 }
+#endif
 
 ///
 ///
@@ -134,6 +156,12 @@ public:
     int operator()( const Kernel::Point_3& ) const {
         return 3;
     }
+    int operator()( const Coordinate::Double_2& ) const {
+        return 2;
+    }
+    int operator()( const Coordinate::Double_3& ) const {
+        return 3;
+    }
 };
 
 
@@ -160,7 +188,7 @@ bool Coordinate::isEmpty() const
 ///
 bool Coordinate::is3D() const
 {
-    return _storage.which() == 2;
+    return _storage.which() == 2 || _storage.which() == 4;
 }
 
 class GetXVisitor : public boost::static_visitor<Kernel::FT> {
@@ -175,6 +203,12 @@ public:
     Kernel::FT operator()( const Kernel::Point_3& storage ) const {
         return storage.x();
     }
+    Kernel::FT operator()( const Coordinate::Double_2& storage ) const {
+        return storage[0];
+    }
+    Kernel::FT operator()( const Coordinate::Double_3& storage ) const {
+        return storage[0];
+    }
 };
 
 ///
@@ -198,6 +232,12 @@ public:
     Kernel::FT operator()( const Kernel::Point_3& storage ) const {
         return storage.y();
     }
+    Kernel::FT operator()( const Coordinate::Double_2& storage ) const {
+        return storage[1];
+    }
+    Kernel::FT operator()( const Coordinate::Double_3& storage ) const {
+        return storage[1];
+    }
 };
 
 ///
@@ -221,6 +261,12 @@ public:
     Kernel::FT operator()( const Kernel::Point_3& storage ) const {
         return storage.z();
     }
+    Kernel::FT operator()( const Coordinate::Double_2& ) const {
+        return 0;
+    }
+    Kernel::FT operator()( const Coordinate::Double_3& storage ) const {
+        return storage[2];
+    }
 };
 
 ///
@@ -258,6 +304,12 @@ public:
                       _roundFT( storage.z() )
                   );
     }
+    void operator()( Coordinate::Double_2& ) const {
+        BOOST_ASSERT( false ); // promoted before rounding
+    }
+    void operator()( Coordinate::Double_3& ) const {
+        BOOST_ASSERT( false ); // promoted before rounding
+    }
 
 
 
@@ -266,10 +318,14 @@ private:
 
 
     Kernel::FT _roundFT( const Kernel::FT& v ) const {
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+        return SFCGAL::round( v * _scaleFactor ) / _scaleFactor ;
+#else
         return Kernel::FT( CGAL::Gmpq(
                                SFCGAL::round( v.exact() * _scaleFactor ),
                                _scaleFactor
                            ) ) ;
+#endif
     }
 
 };
@@ -277,11 +333,136 @@ private:
 
 Coordinate& Coordinate::round( const long& scaleFactor )
 {
+    // rounded values are rationals, not doubles
+    _promoteToExact() ;
+
     RoundVisitor roundVisitor( scaleFactor ) ;
     boost::apply_visitor( roundVisitor, _storage ) ;
     return *this ;
 }
 
+//----------------------
+
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+namespace {
+
+///
+/// nearest double of an exact value, returns true if it is the exact value
+///
+bool exactToDouble( const Kernel::Exact_kernel::FT& v, double& d )
+{
+    d = CGAL::to_double( v );
+    return std::isfinite( d ) && Kernel::Exact_kernel::FT( d ) == v ;
+}
+
+}
+#endif
+
+///
+///
+///
+bool Coordinate::compact( const bool& roundToDouble )
+{
+    if ( _storage.which() == 1 ) {
+        Double_2 storage ;
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+        const Kernel::Point_2& p = boost::get< Kernel::Point_2 >( _storage );
+        storage[0] = p.x() ;
+        storage[1] = p.y() ;
+#else
+        // computing the exact value prunes the lazy construction DAG
+        const Kernel::Exact_kernel::Point_2& p = CGAL::exact( boost::get< Kernel::Point_2 >( _storage ) );
+        bool isExact = exactToDouble( p.x(), storage[0] );
+        isExact = exactToDouble( p.y(), storage[1] ) && isExact ;
+
+        if ( ! isExact && ! ( roundToDouble && std::isfinite( storage[0] ) && std::isfinite( storage[1] ) ) ) {
+            return false ;
+        }
+
+#endif
+        _storage = storage ;
+    }
+    else if ( _storage.which() == 2 ) {
+        Double_3 storage ;
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+        const Kernel::Point_3& p = boost::get< Kernel::Point_3 >( _storage );
+        storage[0] = p.x() ;
+        storage[1] = p.y() ;
+        storage[2] = p.z() ;
+#else
+        // computing the exact value prunes the lazy construction DAG
+        const Kernel::Exact_kernel::Point_3& p = CGAL::exact( boost::get< Kernel::Point_3 >( _storage ) );
+        bool isExact = exactToDouble( p.x(), storage[0] );
+        isExact = exactToDouble( p.y(), storage[1] ) && isExact ;
+        isExact = exactToDouble( p.z(), storage[2] ) && isExact ;
+
+        if ( ! isExact && ! ( roundToDouble && std::isfinite( storage[0] ) && std::isfinite( storage[1] ) && std::isfinite( storage[2] ) ) ) {
+            return false ;
+        }
+
+#endif
+        _storage = storage ;
+    }
+
+    return _isDouble() ;
+}
+
+//----------------------
+
+///
+///
+///
+size_t Coordinate::exactBytes() const
+{
+    detail::LazyRepSet counted ;
+    size_t numLazyNodes = 0 ;
+    return exactBytes( counted, numLazyNodes );
+}
+
+///
+///
+///
+size_t Coordinate::exactBytes( std::set< const void* >& counted, size_t& numLazyNodes ) const
+{
+    if ( _storage.which() == 1 ) {
+        return detail::lazyBytes( boost::get< Kernel::Point_2 >( _storage ), counted, numLazyNodes );
+    }
+    else if ( _storage.which() == 2 ) {
+        return detail::lazyBytes( boost::get< Kernel::Point_3 >( _storage ), counted, numLazyNodes );
+    }
+    else {
+        return 0 ;
+    }
+}
+
+///
+///
+///
+bool Coordinate::sharesLazyExact() const
+{
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+    return false ;
+#else
+    return _storage.which() == 1 || _storage.which() == 2 ;
+#endif
+}
+
+///
+///
+///
+Coordinate Coordinate::deepCopy() const
+{
+    if ( _storage.which() == 1 ) {
+        return Coordinate( detail::deepCopy( boost::get< Kernel::Point_2 >( _storage ) ) );
+    }
+    else if ( _storage.which() == 2 ) {
+        return Coordinate( detail::deepCopy( boost::get< Kernel::Point_3 >( _storage ) ) );
+    }
+    else {
+        return *this ;
+    }
+}
+
 
 
 //----------------------
@@ -297,6 +478,12 @@ public:
     Kernel::Point_2 operator()( const Kernel::Point_3& storage ) const {
         return Kernel::Point_2( storage.x(), storage.y() );
     }
+    Kernel::Point_2 operator()( const Coordinate::Double_2& storage ) const {
+        return Kernel::Point_2( storage[0], storage[1] );
+    }
+    Kernel::Point_2 operator()( const Coordinate::Double_3& storage ) const {
+        return Kernel::Point_2( storage[0], storage[1] );
+    }
 };
 
 ///
@@ -319,6 +506,12 @@ public:
     Kernel::Point_3 operator()( const Kernel::Point_3& storage ) const {
         return storage;
     }
+    Kernel::Point_3 operator()( const Coordinate::Double_2& storage ) const {
+        return Kernel::Point_3( storage[0], storage[1], 0.0 );
+    }
+    Kernel::Point_3 operator()( const Coordinate::Double_3& storage ) const {
+        return Kernel::Point_3( storage[0], storage[1], storage[2] );
+    }
 };
 
 ///
@@ -330,6 +523,19 @@ Kernel::Point_3 Coordinate::toPoint_3() const
     return boost::apply_visitor( visitor, _storage );
 }
 
+///
+///
+///
+void Coordinate::_promoteToExact()
+{
+    if ( _storage.which() == 3 ) {
+        _storage = toPoint_2();
+    }
+    else if ( _storage.which() == 4 ) {
+        _storage = toPoint_3();
+    }
+}
+
 ///
 ///
 ///
@@ -345,6 +551,20 @@ bool Coordinate::operator < ( const Coordinate& other ) const
         BOOST_THROW_EXCEPTION( Exception( "try to compare empty points with different coordinate dimension using a < b" ) );
     }
 
+    // double mode, no need for exact numbers
+    if ( _isDouble() && other._isDouble() ) {
+        if ( is3D() ) {
+            const Double_3& a = boost::get< Double_3 >( _storage );
+            const Double_3& b = boost::get< Double_3 >( other._storage );
+            return std::lexicographical_compare( a.begin(), a.end(), b.begin(), b.end() );
+        }
+        else {
+            const Double_2& a = boost::get< Double_2 >( _storage );
+            const Double_2& b = boost::get< Double_2 >( other._storage );
+            return std::lexicographical_compare( a.begin(), a.end(), b.begin(), b.end() );
+        }
+    }
+
     // comparison along x
     if ( x() < other.x() ) {
         return true ;
@@ -384,6 +604,16 @@ bool Coordinate::operator == ( const Coordinate& other ) const
         return other.isEmpty() ;
     }
 
+    // double mode, no need for exact numbers
+    if ( _isDouble() && other._isDouble() && is3D() == other.is3D() ) {
+        if ( is3D() ) {
+            return boost::get< Double_3 >( _storage ) == boost::get< Double_3 >( other._storage ) ;
+        }
+        else {
+            return boost::get< Double_2 >( _storage ) == boost::get< Double_2 >( other._storage ) ;
+        }
+    }
+
     if ( is3D() || other.is3D() ) {
         return x() == other.x() && y() == other.y()  && z() == other.z() ;
     }
@@ -401,5 +631,5 @@ bool Coordinate::operator != ( const Coordinate& other ) const
 }
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -23,6 +23,8 @@
 
 #include <SFCGAL/config.h>
 
+#include <set>
+
 #include <boost/assert.hpp>
 #include <boost/array.hpp>
 #include <boost/variant.hpp>
@@ -32,11 +34,16 @@
 
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * @brief Represents the Coordinate of a Point (wraps either an empty structure, or a Kernel::Point_2,
  * or a Kernel::Point_3)
+ *
+ * Coordinates built from finite doubles are stored as raw doubles ("double mode"). The corresponding
+ * Kernel::Point_2 or Kernel::Point_3 is only built when an exact value is requested (x(), toPoint_2(), ...)
+ * and exact constructions are only performed on the resulting points, which avoids storing a lazy exact
+ * node for each input coordinate.
  */
 class SFCGAL_API Coordinate {
 public:
@@ -52,17 +59,22 @@ public:
      * XYZ Constructor with exact coordinates
      */
     Coordinate( const Kernel::FT& x, const Kernel::FT& y, const Kernel::FT& z ) ;
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+    // with the inexact constructions kernel, Kernel::FT is double and the constructors
+    // above are the double constructors
+
     /**
-     * XYZ constructor
+     * XYZ constructor (double mode storage)
      * @warning x,y,z must not be not be NaN nor inf
      */
     Coordinate( const double& x, const double& y, const double& z ) ;
 
     /**
-     * XY constructor
+     * XY constructor (double mode storage)
      * @warning x,y must not be not be NaN nor inf
      */
     Coordinate( const double& x, const double& y ) ;
+#endif
     /**
      * Constructor from CGAL::Point_2<K>
      */
@@ -126,6 +138,40 @@ public:
      */
     Coordinate& round( const long& scaleFactor = 1 ) ;
 
+    /**
+     * @brief Computes the exact value of the coordinate, which drops its lazy exact construction
+     * history, and switches to double storage when the doubles are the exact value.
+     * @param roundToDouble switch to double storage even if the doubles are not exact (nearest doubles)
+     * @return true if the coordinate is stored as doubles
+     */
+    bool compact( const bool& roundToDouble = false ) ;
+
+    /**
+     * @brief Returns the number of bytes allocated for the exact representation of the coordinate
+     * (lazy exact node, exact value and its GMP limbs once computed), 0 in double mode.
+     * @warning the exact value is not computed and the unevaluated lazy construction history
+     * below the node is not counted
+     */
+    size_t exactBytes() const ;
+
+    /**
+     * @brief Same as exactBytes(), returns 0 if the lazy exact node is already in counted (shared with an
+     * other coordinate) and increments numLazyNodes if its exact value is not computed (see detail::lazyBytes)
+     */
+    size_t exactBytes( std::set< const void* >& counted, size_t& numLazyNodes ) const ;
+
+    /**
+     * @brief Tests if the copies of the coordinate share its lazy exact representation (exact storage
+     * with the exact constructions Kernel). Such a coordinate must not be read by several threads.
+     */
+    bool sharesLazyExact() const ;
+
+    /**
+     * @brief Returns a copy sharing no lazy exact representation with the coordinate (see detail::deepCopy)
+     * @warning the exact value is computed
+     */
+    Coordinate deepCopy() const ;
+
 
     //-- comparator
 
@@ -175,8 +221,23 @@ public:
 
     // class for Empty coordinate
     class Empty {};
+    // XY coordinate stored as doubles
+    typedef boost::array< double, 2 > Double_2 ;
+    // XYZ coordinate stored as doubles
+    typedef boost::array< double, 3 > Double_3 ;
 private:
-    boost::variant< Empty, Kernel::Point_2, Kernel::Point_3 > _storage;
+    boost::variant< Empty, Kernel::Point_2, Kernel::Point_3, Double_2, Double_3 > _storage;
+
+    /**
+     * @brief Tests if the coordinate is stored as doubles
+     */
+    inline bool _isDouble() const {
+        return _storage.which() >= 3 ;
+    }
+    /**
+     * @brief Replaces double storage with the corresponding exact point
+     */
+    void _promoteToExact() ;
 
 public:
     /**
@@ -187,13 +248,13 @@ public:
         int dim = coordinateDimension();
         ar << dim;
 
-        if ( _storage.which() > 0 ) {
+        if ( dim > 0 ) {
             const Kernel::FT& x_ = x();
             const Kernel::FT& y_ = y();
             ar << x_;
             ar << y_;
 
-            if ( _storage.which() == 2 ) {
+            if ( dim == 3 ) {
                 const Kernel::FT& z_ = z();
                 ar << z_;
             }
@@ -230,6 +291,6 @@ public:
 };
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -24,7 +24,7 @@
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/PolyhedralSurface.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -348,5 +348,5 @@ bool operator==( const Envelope& a, const Envelope& b )
            a.xMax() == b.xMax() &&
            a.yMax() == b.yMax();
 }
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -32,7 +32,7 @@
 #include <SFCGAL/detail/Interval.h>
 #include <SFCGAL/Coordinate.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 class LineString ;
 class Polygon ;
@@ -222,6 +222,6 @@ private:
  */
 SFCGAL_API bool operator==( const Envelope&, const Envelope& );
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,7 +21,7 @@
 #include <SFCGAL/Exception.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -67,7 +67,7 @@ std::string Exception::diagnostic() const throw()
 }
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
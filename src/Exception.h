@@ -28,7 +28,7 @@
 #include <boost/exception/all.hpp>
 #include <boost/format.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * Base SFCGAL Exception
@@ -110,7 +110,7 @@ public:
 
 };
 
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
 
@@ -0,0 +1,175 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/Exception.h>
+
+#include <algorithm>
+
+#include <CGAL/config.h>
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/thread/mutex.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+
+namespace {
+
+///
+/// The policy is owned by its Scope
+///
+void noCleanup( ExecutionPolicy* )
+{
+}
+
+///
+///
+///
+boost::thread_specific_ptr< ExecutionPolicy >& currentPolicy()
+{
+    static boost::thread_specific_ptr< ExecutionPolicy > policy( &noCleanup );
+    return policy ;
+}
+
+///
+///
+///
+boost::mutex& globalMutex()
+{
+    static boost::mutex mutex ;
+    return mutex ;
+}
+
+///
+///
+///
+ExecutionPolicy& globalPolicy()
+{
+    static ExecutionPolicy policy ;
+    return policy ;
+}
+
+} // namespace
+
+///
+///
+///
+ExecutionPolicy::Scope::Scope( const ExecutionPolicy& policy ):
+    _policy( policy ),
+    _previous( currentPolicy().get() )
+{
+    currentPolicy().reset( &_policy );
+}
+
+///
+///
+///
+ExecutionPolicy::Scope::~Scope()
+{
+    currentPolicy().reset( _previous );
+}
+
+///
+///
+///
+ExecutionPolicy::ExecutionPolicy( const size_t& numThreads, const size_t& minPairs ):
+    _numThreads( numThreads ),
+    _minPairs( minPairs )
+{
+    if ( numThreads != 1 && ! parallelSupported() ) {
+        BOOST_THROW_EXCEPTION( NotImplementedException( "parallel execution requires CGAL with thread support (CGAL_HAS_THREADS)" ) );
+    }
+}
+
+///
+///
+///
+ExecutionPolicy ExecutionPolicy::sequential()
+{
+    return ExecutionPolicy( 1 );
+}
+
+///
+///
+///
+ExecutionPolicy ExecutionPolicy::parallel( const size_t& numThreads )
+{
+    return ExecutionPolicy( numThreads );
+}
+
+///
+///
+///
+bool ExecutionPolicy::parallelSupported()
+{
+#ifdef CGAL_HAS_THREADS
+    return true ;
+#else
+    return false ;
+#endif
+}
+
+///
+///
+///
+size_t ExecutionPolicy::threadsFor( const size_t& numPairs ) const
+{
+    if ( numPairs < std::max( _minPairs, size_t( 2 ) ) ) {
+        return 1 ;
+    }
+
+    size_t n = _numThreads ;
+
+    if ( n == 0 ) {
+        n = std::max( boost::thread::hardware_concurrency(), 1U );
+    }
+
+    return std::min( n, numPairs );
+}
+
+///
+///
+///
+ExecutionPolicy ExecutionPolicy::current()
+{
+    const ExecutionPolicy* policy = currentPolicy().get();
+    return policy ? *policy : global() ;
+}
+
+///
+///
+///
+ExecutionPolicy ExecutionPolicy::global()
+{
+    boost::mutex::scoped_lock lock( globalMutex() );
+    return globalPolicy();
+}
+
+///
+///
+///
+void ExecutionPolicy::setGlobal( const ExecutionPolicy& policy )
+{
+    boost::mutex::scoped_lock lock( globalMutex() );
+    globalPolicy() = policy ;
+}
+
+SFCGAL_END_NAMESPACE
@@ -0,0 +1,135 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_EXECUTIONPOLICY_H_
+#define _SFCGAL_EXECUTIONPOLICY_H_
+
+#include <cstddef>
+
+#include <boost/noncopyable.hpp>
+
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
+
+/**
+ * @brief How the pairs of primitives with overlapping boxes are computed by intersection(),
+ * intersection3D(), difference() and difference3D()
+ *
+ * A parallel policy gathers the candidate pairs found by CGAL::box_intersection_d, shares their exact
+ * computations between threads (the pairs are dealt by chunks to the first idle thread), then merges
+ * the results in the order of the sequential computation : the result doesn't depend on the number
+ * of threads. The pairs involving a volume are computed in the calling thread, as the corefinement
+ * of polyhedra modifies its inputs.
+ *
+ * The policy active in the current thread (see ExecutionPolicy::Scope) is used, the global policy
+ * otherwise (sequential by default).
+ *
+ * union_() and union3D() stay sequential : each pair merges its primitives into the ones of the
+ * previous pairs.
+ *
+ * The lazy exact numbers are reference counted without atomic operations (CGAL 4.3) : the threads
+ * can't share them. The pairs are dealt by blocks, each block holds deep copies of its primitives
+ * (made by the calling thread before the other threads start), which share nothing with the inputs
+ * nor with the other blocks. The CGAL lazy kernel keeps its shared constants per thread when it is
+ * built with thread support (CGAL_HAS_THREADS, see parallelSupported()). Otherwise, only the sequential
+ * policy can be built.
+ *
+ * @warning the geometries must not be modified by other threads during the call
+ * @ingroup public_api
+ */
+class SFCGAL_API ExecutionPolicy {
+public:
+    class Scope ;
+
+    /**
+     * @param numThreads number of threads sharing the pairs (0 for one thread per core, 1 for sequential)
+     * @param minPairs number of candidate pairs under which the computation stays sequential
+     * @throw NotImplementedException if numThreads != 1 and parallelSupported() is false
+     */
+    explicit ExecutionPolicy( const size_t& numThreads = 1, const size_t& minPairs = 64 ) ;
+
+    /**
+     * @brief computations in the calling thread
+     */
+    static ExecutionPolicy sequential() ;
+    /**
+     * @brief computations shared by numThreads threads (0 for one thread per core)
+     * @throw NotImplementedException if parallelSupported() is false
+     */
+    static ExecutionPolicy parallel( const size_t& numThreads = 0 ) ;
+
+    /**
+     * @brief indicates if CGAL is built with thread support (CGAL_HAS_THREADS)
+     */
+    static bool parallelSupported() ;
+
+    /**
+     * @brief number of threads sharing the pairs (0 for one thread per core)
+     */
+    inline const size_t& numThreads() const {
+        return _numThreads ;
+    }
+    /**
+     * @brief number of candidate pairs under which the computation stays sequential
+     */
+    inline const size_t& minPairs() const {
+        return _minPairs ;
+    }
+
+    /**
+     * @brief number of threads to use for numPairs candidate pairs (1 for a sequential computation)
+     */
+    size_t threadsFor( const size_t& numPairs ) const ;
+
+    /**
+     * @brief returns the policy active in the current thread, the global policy if none
+     */
+    static ExecutionPolicy current() ;
+
+    /**
+     * @brief returns the global policy
+     */
+    static ExecutionPolicy global() ;
+    /**
+     * @brief sets the global policy, used by the threads without active policy
+     */
+    static void setGlobal( const ExecutionPolicy& policy ) ;
+
+private:
+    size_t _numThreads ;
+    size_t _minPairs ;
+};
+
+/**
+ * @brief Activates a policy in the current thread for the lifetime of the Scope
+ */
+class SFCGAL_API ExecutionPolicy::Scope : boost::noncopyable {
+public:
+    explicit Scope( const ExecutionPolicy& policy ) ;
+    ~Scope() ;
+private:
+    ExecutionPolicy _policy ;
+    ExecutionPolicy* _previous ;
+};
+
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/FilterStatistics.h>
+#include <SFCGAL/Exception.h>
+
+#include <boost/thread/mutex.hpp>
+
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+#include <gmp.h>
+
+#include <boost/thread/once.hpp>
+#include <boost/thread/tss.hpp>
+#endif
+
+SFCGAL_BEGIN_NAMESPACE
+
+namespace {
+
+FilterStatistics::Counters familyCounters[ FilterStatistics::NUM_FAMILIES ] ;
+boost::mutex               familyCountersMutex ;
+
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+
+///
+/// Statistics state of a thread which opened a Scope
+///
+struct ThreadState {
+    ThreadState():
+        allocations( 0 ) {
+        for ( int i = 0; i < FilterStatistics::NUM_FAMILIES; i++ ) {
+            active[i] = false ;
+        }
+    }
+
+    // number of GMP allocations done by the thread
+    size_t allocations ;
+    // indicates if a Scope of the family is opened in the thread
+    bool   active[ FilterStatistics::NUM_FAMILIES ] ;
+};
+
+///
+///
+///
+boost::thread_specific_ptr< ThreadState >& threadState()
+{
+    static boost::thread_specific_ptr< ThreadState > state ;
+    return state ;
+}
+
+void* ( *previousAllocate )( size_t ) = NULL ;
+void* ( *previousReallocate )( void*, size_t, size_t ) = NULL ;
+void ( *previousFree )( void*, size_t ) = NULL ;
+
+///
+/// Only the threads which opened a Scope are counted
+///
+void countAllocation()
+{
+    ThreadState* state = threadState().get();
+
+    if ( state ) {
+        ++state->allocations ;
+    }
+}
+
+///
+///
+///
+void* countingAllocate( size_t size )
+{
+    countAllocation();
+    return previousAllocate( size );
+}
+
+///
+///
+///
+void* countingReallocate( void* p, size_t oldSize, size_t newSize )
+{
+    countAllocation();
+    return previousReallocate( p, oldSize, newSize );
+}
+
+///
+/// Chains the GMP memory functions, blocks allocated before remain freed by the previous functions
+///
+void installAllocationHooks()
+{
+    mp_get_memory_functions( &previousAllocate, &previousReallocate, &previousFree );
+    mp_set_memory_functions( &countingAllocate, &countingReallocate, previousFree );
+}
+
+boost::once_flag allocationHooksInstalled = BOOST_ONCE_INIT ;
+
+#endif
+
+} // namespace
+
+///
+///
+///
+FilterStatistics::Counters::Counters():
+    calls( 0 ),
+    exactFallbacks( 0 ),
+    exactAllocations( 0 )
+{
+
+}
+
+///
+///
+///
+FilterStatistics::Scope::Scope( const Family& family ):
+    _family( family ),
+    _active( false ),
+    _allocations( 0 )
+{
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+    boost::call_once( allocationHooksInstalled, &installAllocationHooks );
+
+    if ( ! threadState().get() ) {
+        threadState().reset( new ThreadState );
+    }
+
+    ThreadState& state = *threadState() ;
+
+    if ( state.active[ _family ] ) {
+        // nested call of the same family
+        return ;
+    }
+
+    state.active[ _family ] = true ;
+    _active      = true ;
+    _allocations = state.allocations ;
+#endif
+}
+
+///
+///
+///
+FilterStatistics::Scope::~Scope()
+{
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+
+    if ( ! _active ) {
+        return ;
+    }
+
+    ThreadState& state = *threadState() ;
+    state.active[ _family ] = false ;
+    const size_t allocations = state.allocations - _allocations ;
+
+    boost::mutex::scoped_lock lock( familyCountersMutex );
+    Counters& counters = familyCounters[ _family ] ;
+    ++counters.calls ;
+
+    if ( allocations > 0 ) {
+        ++counters.exactFallbacks ;
+    }
+
+    counters.exactAllocations += allocations ;
+#endif
+}
+
+///
+///
+///
+bool FilterStatistics::enabled()
+{
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+    return true ;
+#else
+    return false ;
+#endif
+}
+
+///
+///
+///
+FilterStatistics::Counters FilterStatistics::counters( const Family& family )
+{
+    if ( family < 0 || family >= NUM_FAMILIES ) {
+        BOOST_THROW_EXCEPTION( Exception( "unknown predicate family" ) );
+    }
+
+    boost::mutex::scoped_lock lock( familyCountersMutex );
+    return familyCounters[ family ] ;
+}
+
+///
+///
+///
+void FilterStatistics::reset()
+{
+    boost::mutex::scoped_lock lock( familyCountersMutex );
+
+    for ( int i = 0; i < NUM_FAMILIES; i++ ) {
+        familyCounters[i] = Counters() ;
+    }
+}
+
+///
+///
+///
+std::string FilterStatistics::familyName( const Family& family )
+{
+    switch ( family ) {
+    case INTERSECTS:
+        return "intersects" ;
+
+    case COVERS:
+        return "covers" ;
+
+    case IS_VALID:
+        return "isValid" ;
+
+    case TRIANGULATION:
+        return "triangulation" ;
+
+    default:
+        BOOST_THROW_EXCEPTION( Exception( "unknown predicate family" ) );
+    }
+}
+
+SFCGAL_END_NAMESPACE
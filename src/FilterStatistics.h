@@ -0,0 +1,125 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_FILTERSTATISTICS_H_
+#define _SFCGAL_FILTERSTATISTICS_H_
+
+#include <string>
+
+#include <boost/noncopyable.hpp>
+
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
+
+/**
+ * @brief Counts how often the predicates fall back to exact arithmetic
+ *
+ * CGAL filtered predicates first evaluate with interval arithmetic and only compute with
+ * exact numbers (GMP) when the filter fails. As CGAL does not report filter failures, a call
+ * is counted as an exact fallback when it allocates GMP numbers.
+ *
+ * Statistics are only collected when SFCGAL is built with the SFCGAL_WITH_FILTER_STATISTICS option
+ * (OFF by default, requires GMP). Otherwise, enabled() returns false and all the counters stay to 0.
+ *
+ * Only the outermost call of a family is counted in a thread. Families are inclusive : the validity
+ * checks done by intersects are counted both in INTERSECTS and in IS_VALID.
+ *
+ * @ingroup public_api
+ */
+class SFCGAL_API FilterStatistics {
+public:
+    /**
+     * @brief predicate families
+     */
+    enum Family {
+        INTERSECTS,
+        COVERS,
+        IS_VALID,
+        TRIANGULATION,
+        NUM_FAMILIES
+    };
+
+    /**
+     * @brief counters of a predicate family
+     */
+    struct SFCGAL_API Counters {
+        Counters();
+
+        /**
+         * number of calls
+         */
+        size_t calls ;
+        /**
+         * number of calls which fell back to exact arithmetic
+         */
+        size_t exactFallbacks ;
+        /**
+         * number of GMP allocations done by these calls
+         */
+        size_t exactAllocations ;
+    };
+
+    /**
+     * @brief Counts a call of a family for the lifetime of the Scope
+     */
+    class SFCGAL_API Scope : boost::noncopyable {
+    public:
+        explicit Scope( const Family& family ) ;
+        ~Scope() ;
+    private:
+        Family _family ;
+        bool   _active ;
+        size_t _allocations ;
+    };
+
+    /**
+     * @brief indicates if the statistics are compiled in
+     */
+    static bool enabled() ;
+
+    /**
+     * @brief returns the counters of a family (sum over all the threads)
+     */
+    static Counters counters( const Family& family ) ;
+    /**
+     * @brief resets all the counters
+     */
+    static void reset() ;
+
+    /**
+     * @brief returns the name of a family ("intersects", "covers", "isValid", "triangulation")
+     */
+    static std::string familyName( const Family& family ) ;
+};
+
+SFCGAL_END_NAMESPACE
+
+/**
+ * Counts the enclosing block as a call of the given family, compiled out
+ * unless SFCGAL_WITH_FILTER_STATISTICS is defined
+ */
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+#  define SFCGAL_FILTER_STATISTICS_SCOPE( family ) \
+    SFCGAL::FilterStatistics::Scope filterStatisticsScope( SFCGAL::FilterStatistics::family )
+#else
+#  define SFCGAL_FILTER_STATISTICS_SCOPE( family )
+#endif
+
+#endif
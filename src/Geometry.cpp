@@ -19,6 +19,7 @@
  */
 
 #include <SFCGAL/Geometry.h>
+#include <SFCGAL/GeometryArena.h>
 
 #include <SFCGAL/Point.h>
 #include <SFCGAL/GeometryVisitor.h>
@@ -35,7 +36,7 @@
 
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -45,6 +46,45 @@ Geometry::~Geometry()
 
 }
 
+#ifdef SFCGAL_WITH_GEOMETRY_ARENA
+///
+///
+///
+void* Geometry::operator new( size_t size )
+{
+    return GeometryArena::allocateGeometry( size );
+}
+
+///
+///
+///
+void Geometry::operator delete( void* p )
+{
+    GeometryArena::deallocateGeometry( p );
+}
+
+///
+///
+///
+void* Geometry::operator new( size_t size, const std::nothrow_t& ) throw()
+{
+    try {
+        return GeometryArena::allocateGeometry( size );
+    }
+    catch ( std::bad_alloc& ) {
+        return NULL ;
+    }
+}
+
+///
+///
+///
+void Geometry::operator delete( void* p, const std::nothrow_t& ) throw()
+{
+    GeometryArena::deallocateGeometry( p );
+}
+#endif
+
 
 ///
 ///
@@ -200,5 +240,5 @@ bool operator == ( const Geometry& ga, const Geometry& gb )
     return true;
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -26,16 +26,18 @@
 #include <boost/shared_ptr.hpp>
 
 #include <memory>
+#include <new>
 #include <string>
 #include <sstream>
 
 #include <boost/assert.hpp>
+#include <boost/config.hpp>
 
 namespace CGAL {
 class Object;
 }
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
 class Point ;
 class LineString ;
@@ -60,9 +62,9 @@ class Envelope ;
 
 class GeometryVisitor ;
 class ConstGeometryVisitor ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * [OGC/SFA]8.2.3 "A common list of codes for geometric types"
@@ -120,6 +122,31 @@ class SFCGAL_API Geometry {
 public:
     virtual ~Geometry();
 
+#ifdef SFCGAL_WITH_GEOMETRY_ARENA
+    /**
+     * @brief Allocates geometries in the GeometryArena active in the current thread, if any
+     * @see GeometryArena
+     */
+    static void* operator new( size_t size ) ;
+    /**
+     * @brief Releases geometries allocated on the heap (arena memory is released with the arena)
+     */
+    static void  operator delete( void* p ) ;
+    /**
+     * @brief nothrow allocation (NULL on failure)
+     */
+    static void* operator new( size_t size, const std::nothrow_t& ) throw() ;
+    static void  operator delete( void* p, const std::nothrow_t& ) throw() ;
+    /**
+     * @brief placement new (the class operator new hides the global ones)
+     */
+    static inline void* operator new( size_t, void* p ) throw() {
+        return p ;
+    }
+    static inline void  operator delete( void*, void* ) throw() {
+    }
+#endif
+
     /**
      * @brief Get a deep copy of the geometry
      */
@@ -281,6 +308,6 @@ protected:
  */
 SFCGAL_API bool operator==( const Geometry&, const Geometry& );
 
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -0,0 +1,196 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/GeometryArena.h>
+
+#include <new>
+
+#include <boost/assert.hpp>
+#include <boost/thread/tss.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+
+namespace {
+
+///
+/// Header stored in front of each geometry, keeps track of the arena
+/// it was allocated from (NULL for the heap)
+///
+union AllocationHeader {
+    GeometryArena* arena ;
+    // force max alignment for the following geometry
+    long double    alignment ;
+};
+
+///
+/// The arena is not owned by the thread
+///
+void noCleanup( GeometryArena* )
+{
+}
+
+///
+///
+///
+boost::thread_specific_ptr< GeometryArena >& currentArena()
+{
+    static boost::thread_specific_ptr< GeometryArena > arena( &noCleanup );
+    return arena ;
+}
+
+} // namespace
+
+///
+///
+///
+GeometryArena::Scope::Scope( GeometryArena& arena ):
+    _previous( GeometryArena::setCurrent( &arena ) )
+{
+
+}
+
+///
+///
+///
+GeometryArena::Scope::~Scope()
+{
+    GeometryArena::setCurrent( _previous );
+}
+
+///
+///
+///
+GeometryArena::GeometryArena( const size_t& blockSize ):
+    _blockSize( blockSize ),
+    _blocks(),
+    _cursor( NULL ),
+    _end( NULL ),
+    _allocatedSize( 0 ),
+    _reservedSize( 0 )
+{
+
+}
+
+///
+///
+///
+GeometryArena::~GeometryArena()
+{
+    BOOST_ASSERT( current() != this );
+
+    for ( size_t i = 0; i < _blocks.size(); i++ ) {
+        delete [] _blocks[i] ;
+    }
+}
+
+///
+///
+///
+void* GeometryArena::allocate( size_t size )
+{
+    const size_t alignment = sizeof( AllocationHeader ) ;
+    size = ( ( size + alignment - 1 ) / alignment ) * alignment ;
+
+    // large allocations get their own block
+    if ( size > _blockSize ) {
+        char* block = new char[ size ] ;
+        _blocks.push_back( block );
+        _allocatedSize += size ;
+        _reservedSize  += size ;
+        return block ;
+    }
+
+    if ( _cursor == NULL || _cursor + size > _end ) {
+        char* block = new char[ _blockSize ] ;
+        _blocks.push_back( block );
+        _cursor = block ;
+        _end    = block + _blockSize ;
+        _reservedSize += _blockSize ;
+    }
+
+    void* p = _cursor ;
+    _cursor += size ;
+    _allocatedSize += size ;
+    return p ;
+}
+
+///
+///
+///
+bool GeometryArena::enabled()
+{
+#ifdef SFCGAL_WITH_GEOMETRY_ARENA
+    return true ;
+#else
+    return false ;
+#endif
+}
+
+///
+///
+///
+GeometryArena* GeometryArena::current()
+{
+    return currentArena().get();
+}
+
+///
+///
+///
+GeometryArena* GeometryArena::setCurrent( GeometryArena* arena )
+{
+    GeometryArena* previous = currentArena().get();
+    currentArena().reset( arena );
+    return previous ;
+}
+
+///
+///
+///
+void* GeometryArena::allocateGeometry( size_t size )
+{
+    GeometryArena* arena = current();
+    const size_t n = sizeof( AllocationHeader ) + size ;
+
+    AllocationHeader* header = static_cast< AllocationHeader* >(
+                                   arena ? arena->allocate( n ) : ::operator new( n )
+                               );
+    header->arena = arena ;
+    return header + 1 ;
+}
+
+///
+///
+///
+void GeometryArena::deallocateGeometry( void* p )
+{
+    if ( p == NULL ) {
+        return ;
+    }
+
+    AllocationHeader* header = static_cast< AllocationHeader* >( p ) - 1 ;
+
+    // memory allocated in an arena is released with the arena
+    if ( header->arena == NULL ) {
+        ::operator delete( header );
+    }
+}
+
+SFCGAL_END_NAMESPACE
@@ -0,0 +1,125 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_GEOMETRYARENA_H_
+#define _SFCGAL_GEOMETRYARENA_H_
+
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
+
+/**
+ * @brief Monotonic memory region a whole geometry tree can be allocated from
+ *
+ * When SFCGAL is built with the SFCGAL_WITH_GEOMETRY_ARENA option (OFF by default, see enabled()),
+ * Geometry has a class operator new : while an arena is active in a thread (see GeometryArena::Scope),
+ * every Geometry object allocated with new by this thread is taken from the arena. Deleting such a
+ * geometry runs its destructor but not the release of the memory of the object : all the blocks of
+ * the arena are released at once by its destructor.
+ *
+ * Only the Geometry objects are allocated in the arena. The buffers of their containers (points of
+ * a LineString, rings of a Polygon, geometries of a collection) and the exact numbers stay on the heap.
+ *
+ * Without the option, geometries are allocated on the heap with no overhead and activating an arena
+ * has no effect on them.
+ *
+ * @warning geometries allocated in an arena must be deleted before the arena
+ * @ingroup public_api
+ */
+class SFCGAL_API GeometryArena : boost::noncopyable {
+public:
+    /**
+     * @brief Activates an arena in the current thread for the lifetime of the Scope
+     */
+    class SFCGAL_API Scope : boost::noncopyable {
+    public:
+        explicit Scope( GeometryArena& arena ) ;
+        ~Scope() ;
+    private:
+        GeometryArena* _previous ;
+    };
+
+    /**
+     * @param blockSize size of the memory blocks reserved by the arena
+     */
+    explicit GeometryArena( const size_t& blockSize = 65536 ) ;
+    /**
+     * @brief releases all the blocks
+     */
+    ~GeometryArena() ;
+
+    /**
+     * @brief allocates size bytes in the arena
+     */
+    void*  allocate( size_t size ) ;
+
+    /**
+     * @brief returns the number of bytes allocated in the arena
+     */
+    inline size_t allocatedSize() const {
+        return _allocatedSize ;
+    }
+    /**
+     * @brief returns the number of bytes reserved by the arena blocks
+     */
+    inline size_t reservedSize() const {
+        return _reservedSize ;
+    }
+
+    /**
+     * @brief Tests if geometries are allocated in the active arena (SFCGAL_WITH_GEOMETRY_ARENA)
+     */
+    static bool enabled() ;
+
+    /**
+     * @brief returns the arena active in the current thread (NULL if none)
+     */
+    static GeometryArena* current() ;
+    /**
+     * @brief sets the arena active in the current thread (NULL to deactivate)
+     * @return the previously active arena
+     */
+    static GeometryArena* setCurrent( GeometryArena* arena ) ;
+
+    /**
+     * @brief allocation of a Geometry (in the current arena if any, on the heap otherwise)
+     */
+    static void* allocateGeometry( size_t size ) ;
+    /**
+     * @brief deallocation of a Geometry (no-op for geometries allocated in an arena)
+     */
+    static void  deallocateGeometry( void* p ) ;
+
+private:
+    size_t              _blockSize ;
+    std::vector< char* > _blocks ;
+    char*               _cursor ;
+    char*               _end ;
+    size_t              _allocatedSize ;
+    size_t              _reservedSize ;
+};
+
+SFCGAL_END_NAMESPACE
+
+#endif
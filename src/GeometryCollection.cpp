@@ -25,7 +25,37 @@
 
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
+
+namespace {
+
+/**
+ * Deleter of the geometries of a collection, allows to release
+ * a geometry that is no longer shared
+ */
+struct GeometryDeleter {
+    GeometryDeleter():
+        released( false ) {
+    }
+
+    void operator()( Geometry* geometry ) const {
+        if ( ! released ) {
+            delete geometry ;
+        }
+    }
+
+    bool released ;
+};
+
+///
+///
+///
+boost::shared_ptr< Geometry > shareGeometry( Geometry* geometry )
+{
+    return boost::shared_ptr< Geometry >( geometry, GeometryDeleter() );
+}
+
+}
 
 ///
 ///
@@ -40,13 +70,24 @@ GeometryCollection::GeometryCollection():
 ///
 ///
 GeometryCollection::GeometryCollection( GeometryCollection const& other ):
-    Geometry()
+    Geometry(),
+    _geometries( other._geometries )
 {
-    for ( size_t i = 0; i < other.numGeometries(); i++ ) {
-        addGeometry( other.geometryN( i ).clone() );
-    }
+
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+GeometryCollection::GeometryCollection( GeometryCollection&& other ):
+    Geometry(),
+    _geometries()
+{
+    swap( other );
+}
+#endif
+
 ///
 ///
 ///
@@ -95,7 +136,7 @@ int  GeometryCollection::dimension() const
 {
     int maxDimension = 0 ;
 
-    for ( boost::ptr_vector< Geometry >::const_iterator it = _geometries.begin(); it != _geometries.end(); ++it ) {
+    for ( const_iterator it = begin(); it != end(); ++it ) {
         maxDimension = std::max( maxDimension, it->dimension() );
     }
 
@@ -111,7 +152,7 @@ int   GeometryCollection::coordinateDimension() const
         return 0 ;
     }
     else {
-        return _geometries.front().coordinateDimension() ;
+        return _geometries.front()->coordinateDimension() ;
     }
 }
 
@@ -128,7 +169,7 @@ bool   GeometryCollection::isEmpty() const
 ///
 bool   GeometryCollection::is3D() const
 {
-    return ! isEmpty() && _geometries.front().is3D() ;
+    return ! isEmpty() && _geometries.front()->is3D() ;
 }
 
 ///
@@ -136,7 +177,7 @@ bool   GeometryCollection::is3D() const
 ///
 bool   GeometryCollection::isMeasured() const
 {
-    return ! isEmpty() && _geometries.front().isMeasured() ;
+    return ! isEmpty() && _geometries.front()->isMeasured() ;
 }
 
 ///
@@ -152,7 +193,7 @@ size_t  GeometryCollection::numGeometries() const
 ///
 const Geometry&    GeometryCollection::geometryN( size_t const& n ) const
 {
-    return _geometries[n];
+    return *_geometries[n];
 }
 
 ///
@@ -160,7 +201,13 @@ const Geometry&    GeometryCollection::geometryN( size_t const& n ) const
 ///
 Geometry&          GeometryCollection::geometryN( size_t const& n )
 {
-    return _geometries[n];
+    boost::shared_ptr< Geometry >& geometry = _geometries[n] ;
+
+    if ( ! geometry.unique() ) {
+        geometry = shareGeometry( geometry->clone() );
+    }
+
+    return *geometry;
 }
 
 
@@ -178,7 +225,7 @@ void    GeometryCollection::addGeometry( Geometry* geometry )
         BOOST_THROW_EXCEPTION( std::runtime_error( oss.str() ) );
     }
 
-    _geometries.push_back( geometry );
+    _geometries.push_back( shareGeometry( geometry ) );
 }
 
 ///
@@ -189,6 +236,61 @@ void    GeometryCollection::addGeometry( Geometry const& geometry )
     addGeometry( geometry.clone() );
 }
 
+///
+///
+///
+void    GeometryCollection::releaseGeometries( boost::ptr_vector< Geometry >& geometries )
+{
+    // the geometries shared with another collection (or unserialized) are cloned first,
+    // in reverse order, nothing is modified if a clone fails
+    std::vector< bool > released( _geometries.size() );
+    boost::ptr_vector< Geometry > clones ;
+
+    for ( size_t i = _geometries.size(); i > 0; i-- ) {
+        released[i - 1] = _geometries[i - 1].unique() && boost::get_deleter< GeometryDeleter >( _geometries[i - 1] ) != NULL ;
+
+        if ( ! released[i - 1] ) {
+            clones.push_back( _geometries[i - 1]->clone() );
+        }
+    }
+
+    geometries.reserve( geometries.size() + _geometries.size() );
+
+    // no allocation from here
+    for ( size_t i = 0; i < _geometries.size(); i++ ) {
+        if ( released[i] ) {
+            geometries.push_back( _geometries[i].get() );
+            boost::get_deleter< GeometryDeleter >( _geometries[i] )->released = true ;
+        }
+        else {
+            geometries.transfer( geometries.end(), clones.end() - 1, clones );
+        }
+    }
+
+    _geometries.clear();
+}
+
+///
+///
+///
+void    GeometryCollection::removeGeometryN( const size_t& n )
+{
+    BOOST_ASSERT( n < _geometries.size() );
+    _geometries.erase( _geometries.begin() + n );
+}
+
+///
+///
+///
+void    GeometryCollection::_detachGeometries()
+{
+    for ( size_t i = 0; i < _geometries.size(); i++ ) {
+        if ( ! _geometries[i].unique() ) {
+            _geometries[i] = shareGeometry( _geometries[i]->clone() );
+        }
+    }
+}
+
 ///
 ///
 ///
@@ -217,5 +319,5 @@ void GeometryCollection::accept( ConstGeometryVisitor& visitor ) const
 
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -22,32 +22,52 @@
 #define _SFCGAL_GEOMETRYCOLLECTION_H_
 
 #include <vector>
+#include <memory>
+#include <utility>
 #include <boost/assert.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/iterator/indirect_iterator.hpp>
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/serialization/base_object.hpp>
-#include <boost/ptr_container/serialize_ptr_vector.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A GeometryCollection in SFA.
+ *
+ * The geometries of a collection are reference counted and shared with its copies
+ * (copy on write) : copying a collection doesn't copy its geometries, a shared
+ * geometry is only cloned when it is accessed for modification (non-const geometryN()
+ * or iterators).
+ *
+ * @warning a reference obtained for modification must not be kept across a copy
+ * of the collection, modifications through it would be seen by the copy.
+ *
  * @ingroup public_api
  */
 class SFCGAL_API GeometryCollection : public Geometry {
 public:
-    typedef boost::ptr_vector< Geometry >::iterator       iterator ;
-    typedef boost::ptr_vector< Geometry >::const_iterator const_iterator ;
+    typedef boost::indirect_iterator< std::vector< boost::shared_ptr< Geometry > >::iterator, Geometry >                   iterator ;
+    typedef boost::indirect_iterator< std::vector< boost::shared_ptr< Geometry > >::const_iterator, const Geometry >       const_iterator ;
 
     /**
      * Empty GeometryCollection constructor
      */
     GeometryCollection() ;
     /**
-     * Copy constructor
+     * Copy constructor (the geometries are shared until they are modified)
      */
     GeometryCollection( const GeometryCollection& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor (steals the geometries, other is left empty)
+     */
+    GeometryCollection( GeometryCollection&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -90,10 +110,29 @@ public:
      * [SFA/OGC]add a geometry to the collection (clone instance)
      */
     void                      addGeometry( Geometry const& geometry ) ;
+#ifndef BOOST_NO_CXX11_SMART_PTR
+    /**
+     * [SFA/OGC]add a geometry to the collection (takes ownership)
+     */
+    inline void               addGeometry( std::unique_ptr< Geometry > geometry ) {
+        addGeometry( geometry.release() );
+    }
+#endif
+    /**
+     * Releases the ownership of the geometries to the caller (appended to geometries),
+     * leaving the collection empty. Geometries shared with another collection are cloned.
+     * If a clone fails, the collection and geometries are not modified.
+     */
+    void                      releaseGeometries( boost::ptr_vector< Geometry >& geometries ) ;
+    /**
+     * removes the n-th geometry
+     */
+    void                      removeGeometryN( const size_t& n ) ;
 
     //-- iterators
 
     inline iterator       begin() {
+        _detachGeometries();
         return _geometries.begin() ;
     }
     inline const_iterator begin() const {
@@ -123,7 +162,12 @@ public:
         ar& _geometries;
     }
 private:
-    boost::ptr_vector< Geometry > _geometries ;
+    std::vector< boost::shared_ptr< Geometry > > _geometries ;
+
+    /**
+     * clone the geometries shared with another collection
+     */
+    void _detachGeometries() ;
 
 protected:
     /**
@@ -141,6 +185,6 @@ protected:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -33,7 +33,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -199,5 +199,5 @@ void ConstGeometryVisitor::visit( const Geometry& g )
 
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -23,7 +23,7 @@
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * GeometryVisitor
@@ -79,7 +79,7 @@ public:
 };
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
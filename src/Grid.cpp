@@ -25,7 +25,25 @@
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
+
+namespace {
+const size_t NOT_ADDED = static_cast< size_t >( -1 );
+
+/**
+ * Returns the index in the mesh of the point (row,col), added on first use
+ */
+size_t gridVertex( const Grid& grid, const size_t& row, const size_t& col, std::vector< size_t >& vertexIndex, TriangulatedSurface& mesh )
+{
+    size_t& index = vertexIndex[ row * grid.ncols() + col ] ;
+
+    if ( index == NOT_ADDED ) {
+        index = mesh.addVertex( grid.point( row, col ) );
+    }
+
+    return index ;
+}
+}
 
 ///
 ///
@@ -110,6 +128,9 @@ std::auto_ptr< TriangulatedSurface > Grid::toTrianguledSurface() const
         return result ;
     }
 
+    // the points of the grid are shared by the triangles
+    std::vector< size_t > vertexIndex( nrows() * ncols(), NOT_ADDED );
+
     for ( size_t i = 0; i < nrows() - 1; i++ ) {
         for ( size_t j = 0; j < ncols() - 1; j++ ) {
             /*
@@ -117,17 +138,25 @@ std::auto_ptr< TriangulatedSurface > Grid::toTrianguledSurface() const
              *
              * d    c
              */
-            Point a = point( i,j );
-            Point b = point( i,j+1 );
-            Point c = point( i+1,j+1 );
-            Point d = point( i+1,j );
-
-            if ( d.isMeasured() && c.isMeasured() && b.isMeasured() ) {
-                result->addTriangle( new Triangle( d, c, b ) );
+            const bool a = point( i,j ).isMeasured();
+            const bool b = point( i,j+1 ).isMeasured();
+            const bool c = point( i+1,j+1 ).isMeasured();
+            const bool d = point( i+1,j ).isMeasured();
+
+            if ( d && c && b ) {
+                result->addTriangle(
+                    gridVertex( *this, i+1, j, vertexIndex, *result ),
+                    gridVertex( *this, i+1, j+1, vertexIndex, *result ),
+                    gridVertex( *this, i, j+1, vertexIndex, *result )
+                );
             }
 
-            if ( d.isMeasured() && b.isMeasured() && a.isMeasured() ) {
-                result->addTriangle( new Triangle( d, b, a ) );
+            if ( d && b && a ) {
+                result->addTriangle(
+                    gridVertex( *this, i+1, j, vertexIndex, *result ),
+                    gridVertex( *this, i, j+1, vertexIndex, *result ),
+                    gridVertex( *this, i, j, vertexIndex, *result )
+                );
             }
         }
     }
@@ -135,4 +164,4 @@ std::auto_ptr< TriangulatedSurface > Grid::toTrianguledSurface() const
     return result ;
 }
 
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
@@ -27,7 +27,7 @@
 #include <SFCGAL/Point.h>
 #include <SFCGAL/TriangulatedSurface.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * @brief represents a pixel convention for Grid data
@@ -234,6 +234,6 @@ private:
     PixelConvention _pixelConvention ;
 };
 
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
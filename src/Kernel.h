@@ -21,21 +21,59 @@
 #ifndef _SFCGAL_KERNEL_H_
 #define _SFCGAL_KERNEL_H_
 
+#include <SFCGAL/config.h>
+#include <SFCGAL/Exception.h>
+
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#else
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#endif
+#include <CGAL/Gmpq.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+/**
+ * inexact constructions Kernel (SFCGAL_inexact library, built with SFCGAL_BUILD_INEXACT)
+ *
+ * @warning predicates are exact but constructions are not. Only measures (area, length,
+ * distance) and predicates (intersects, isValid...) are sound with this Kernel. The operations
+ * on polygons and volumes (intersection, union, difference, offset, minkowskiSum...) throw a
+ * NotImplementedException (see requireExactConstructions), the other constructive operations
+ * may give approximate results.
+ */
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel ;
+#else
 /**
  * default Kernel
  */
 typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel ;
+#endif
 
 
+/**
+ * @brief throws a NotImplementedException with the inexact constructions Kernel
+ *
+ * Guards the operations relying on CGAL packages that require exact constructions
+ * (2D boolean set operations, Arrangement_2, Polyhedron_corefinement)
+ */
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+inline void requireExactConstructions( const char* operation )
+{
+    BOOST_THROW_EXCEPTION( NotImplementedException( std::string( operation ) + " requires exact constructions, it is not available in SFCGAL_inexact" ) );
+}
+#else
+inline void requireExactConstructions( const char* )
+{
+}
+#endif
+
 /**
  * Quotient type
  */
 typedef CGAL::Gmpq QT;
 
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,7 +21,7 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -38,11 +38,9 @@ LineString::LineString():
 ///
 LineString::LineString( const std::vector< Point >& points ):
     Geometry(),
-    _points()
+    _points( points )
 {
-    for ( size_t i = 0; i < points.size(); i++ ) {
-        _points.push_back( points[i].clone() ) ;
-    }
+
 }
 
 ///
@@ -52,20 +50,32 @@ LineString::LineString( const Point& startPoint, const Point& endPoint ):
     Geometry(),
     _points()
 {
-    _points.push_back( startPoint.clone() );
-    _points.push_back( endPoint.clone() );
+    _points.reserve( 2 );
+    _points.push_back( startPoint );
+    _points.push_back( endPoint );
 }
 
 ///
 ///
 ///
 LineString::LineString( const LineString& other ):
-    Geometry()
+    Geometry( other ),
+    _points( other._points )
 {
-    for ( size_t i = 0; i < other.numPoints(); i++ ) {
-        _points.push_back( other.pointN( i ).clone() ) ;
-    }
+
+}
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+LineString::LineString( LineString&& other ):
+    Geometry( other ),
+    _points()
+{
+    swap( other );
 }
+#endif
 
 ///
 ///
@@ -164,6 +174,14 @@ void LineString::reverse()
     std::reverse( _points.begin(), _points.end() );
 }
 
+///
+///
+///
+void LineString::removeRepeatedPoints()
+{
+    _points.erase( std::unique( _points.begin(), _points.end() ), _points.end() );
+}
+
 ///
 ///
 ///
@@ -177,6 +195,16 @@ size_t LineString::numSegments() const
     }
 }
 
+///
+///
+///
+void LineString::addPoint( Point* p )
+{
+    BOOST_ASSERT( p != NULL );
+    std::auto_ptr< Point > owned( p );
+    _points.push_back( *owned ) ;
+}
+
 ///
 ///
 ///
@@ -252,5 +280,5 @@ CGAL::Polygon_2< Kernel > LineString::toPolygon_2( bool fixOrientation ) const
 }
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -24,24 +24,28 @@
 #include <vector>
 
 #include <boost/assert.hpp>
-#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/iterator/iterator_facade.hpp>
 #include <boost/serialization/base_object.hpp>
-#include <boost/ptr_container/serialize_ptr_vector.hpp>
+#include <boost/serialization/vector.hpp>
 
 #include <SFCGAL/Point.h>
 
 #include <CGAL/Polygon_2.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A LineString in SFA
+ *
+ * Points are stored by value in a contiguous buffer (no per vertex allocation).
+ *
+ * @warning references and pointers to points are invalidated when points are added
  * @ingroup public_api
  */
 class SFCGAL_API LineString : public Geometry {
 public:
-    typedef boost::ptr_vector< Point >::iterator       iterator ;
-    typedef boost::ptr_vector< Point >::const_iterator const_iterator ;
+    typedef std::vector< Point >::iterator       iterator ;
+    typedef std::vector< Point >::const_iterator const_iterator ;
 
     /**
      * Empty LineString constructor
@@ -59,6 +63,12 @@ public:
      * Copy constructor
      */
     LineString( LineString const& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor (steals the point buffer, other is left empty)
+     */
+    LineString( LineString&& other ) ;
+#endif
 
     /**
      * assign operator
@@ -98,6 +108,11 @@ public:
      */
     void reverse() ;
 
+    /**
+     * remove consecutive duplicated points
+     */
+    void removeRepeatedPoints() ;
+
     /**
      * [SFA/OGC]Returns the number of points
      */
@@ -159,14 +174,13 @@ public:
      * append a Point to the LineString
      */
     inline void            addPoint( const Point& p ) {
-        _points.push_back( p.clone() ) ;
+        _points.push_back( p ) ;
     }
     /**
      * append a Point to the LineString and takes ownership
+     * @warning the point is copied in the LineString storage and deleted
      */
-    inline void            addPoint( Point* p ) {
-        _points.push_back( p ) ;
-    }
+    void                   addPoint( Point* p ) ;
 
 
     //-- methods
@@ -200,7 +214,9 @@ public:
 
     /**
      * Const iterator to 2D points
-     * TODO: replace by boost::tranform_iterator ?
+     *
+     * The point is converted once per position (dereferencing again returns the same
+     * Kernel::Point_2 instead of building a new one from double coordinates).
      */
     class Point_2_const_iterator :
         public boost::iterator_facade<
@@ -208,25 +224,32 @@ public:
         Kernel::Point_2 const,
             boost::bidirectional_traversal_tag > {
     public:
-        Point_2_const_iterator() {}
-        explicit Point_2_const_iterator( const_iterator it ) : it_( it ) {}
+        Point_2_const_iterator() : converted_( false ) {}
+        explicit Point_2_const_iterator( const_iterator it ) : converted_( false ), it_( it ) {}
         //Point_2_const_iterator( const Point_2_const_iterator<K>& other ) : it_(other.it_) {}
     private:
         friend class boost::iterator_core_access;
         void increment() {
             it_++;
+            converted_ = false ;
         }
         void decrement() {
             it_--;
+            converted_ = false ;
         }
         bool equal( const Point_2_const_iterator& other ) const {
             return this->it_ == other.it_;
         }
         const Kernel::Point_2& dereference() const {
-            p_ = it_->toPoint_2();
+            if ( ! converted_ ) {
+                p_ = it_->toPoint_2();
+                converted_ = true ;
+            }
+
             return p_;
         }
         mutable Kernel::Point_2 p_;
+        mutable bool converted_;
         const_iterator it_;
     };
     Point_2_const_iterator points_2_begin() const {
@@ -241,8 +264,7 @@ public:
 
 
     /**
-     * Const iterator to 3D points
-     * TODO: replace by boost::tranform_iterator ?
+     * Const iterator to 3D points (converted once per position, see Point_2_const_iterator)
      */
     class Point_3_const_iterator :
         public boost::iterator_facade<
@@ -250,25 +272,31 @@ public:
         Kernel::Point_3 const,
             boost::bidirectional_traversal_tag > {
     public:
-        Point_3_const_iterator() {}
-        explicit Point_3_const_iterator( const_iterator it ) : it_( it ) {}
-        Point_3_const_iterator( const Point_3_const_iterator& other ) : it_( other.it_ ) {}
+        Point_3_const_iterator() : converted_( false ) {}
+        explicit Point_3_const_iterator( const_iterator it ) : converted_( false ), it_( it ) {}
     private:
         friend class boost::iterator_core_access;
         void increment() {
             it_++;
+            converted_ = false ;
         }
         void decrement() {
             it_--;
+            converted_ = false ;
         }
         bool equal( const Point_3_const_iterator& other ) const {
             return this->it_ == other.it_;
         }
         const Kernel::Point_3& dereference() const {
-            p_ = it_->toPoint_3();
+            if ( ! converted_ ) {
+                p_ = it_->toPoint_3();
+                converted_ = true ;
+            }
+
             return p_;
         }
         mutable Kernel::Point_3 p_;
+        mutable bool converted_;
         const_iterator it_;
     };
 
@@ -304,15 +332,15 @@ public:
         ar& _points;
     }
 private:
-    boost::ptr_vector< Point > _points ;
+    std::vector< Point > _points ;
 
     void swap( LineString& other ) {
-        std::swap( _points, other._points );
+        _points.swap( other._points );
     }
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 
 
@@ -21,7 +21,7 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -41,6 +41,17 @@ MultiLineString::MultiLineString( MultiLineString const& other ):
 
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+MultiLineString::MultiLineString( MultiLineString&& other ):
+    GeometryCollection( std::move( other ) )
+{
+
+}
+#endif
+
 ///
 ///
 ///
@@ -106,5 +117,5 @@ void MultiLineString::accept( ConstGeometryVisitor& visitor ) const
     return visitor.visit( *this );
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
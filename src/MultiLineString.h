@@ -29,7 +29,7 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A MultiLineString in SFA.
@@ -45,6 +45,12 @@ public:
      * Copy constructor
      */
     MultiLineString( const MultiLineString& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor
+     */
+    MultiLineString( MultiLineString&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -96,6 +102,6 @@ protected:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -22,7 +22,7 @@
 #include <SFCGAL/GeometryVisitor.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -42,6 +42,17 @@ MultiPoint::MultiPoint( MultiPoint const& other ):
 
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+MultiPoint::MultiPoint( MultiPoint&& other ):
+    GeometryCollection( std::move( other ) )
+{
+
+}
+#endif
+
 ///
 ///
 ///
@@ -109,5 +120,5 @@ void MultiPoint::accept( ConstGeometryVisitor& visitor ) const
     return visitor.visit( *this );
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
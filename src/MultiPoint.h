@@ -29,7 +29,7 @@
 #include <SFCGAL/Point.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A MultiPoint in SFA.
@@ -45,6 +45,12 @@ public:
      * Copy constructor
      */
     MultiPoint( const MultiPoint& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor
+     */
+    MultiPoint( MultiPoint&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -100,6 +106,6 @@ protected:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,7 +21,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -41,6 +41,17 @@ MultiPolygon::MultiPolygon( MultiPolygon const& other ):
 
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+MultiPolygon::MultiPolygon( MultiPolygon&& other ):
+    GeometryCollection( std::move( other ) )
+{
+
+}
+#endif
+
 ///
 ///
 ///
@@ -106,5 +117,5 @@ void MultiPolygon::accept( ConstGeometryVisitor& visitor ) const
     return visitor.visit( *this );
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -29,7 +29,7 @@
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A MultiPolygon in SFA.
@@ -46,6 +46,12 @@ public:
      * Copy constructor
      */
     MultiPolygon( MultiPolygon const& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor
+     */
+    MultiPolygon( MultiPolygon&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -98,6 +104,6 @@ protected:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,7 +21,7 @@
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -41,6 +41,17 @@ MultiSolid::MultiSolid( MultiSolid const& other ):
 
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+MultiSolid::MultiSolid( MultiSolid&& other ):
+    GeometryCollection( std::move( other ) )
+{
+
+}
+#endif
+
 ///
 ///
 ///
@@ -106,5 +117,5 @@ void MultiSolid::accept( ConstGeometryVisitor& visitor ) const
     return visitor.visit( *this );
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -29,7 +29,7 @@
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A MultiSolid
@@ -45,6 +45,12 @@ public:
      * Copy constructor
      */
     MultiSolid( const MultiSolid& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor
+     */
+    MultiSolid( MultiSolid&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -97,6 +103,6 @@ protected:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
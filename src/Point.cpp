@@ -25,7 +25,7 @@
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -67,6 +67,7 @@ Point::Point( const Kernel::FT& x, const Kernel::FT& y, const Kernel::FT& z, con
 
 }
 
+#ifndef SFCGAL_USE_INEXACT_KERNEL
 ///
 ///
 ///
@@ -99,6 +100,7 @@ Point::Point( const double& x, const double& y, const double& z, const double& m
 {
 
 }
+#endif
 
 ///
 ///
@@ -283,5 +285,5 @@ template CGAL::Point_2<Kernel> Point::toPoint_d<2>() const;
 template CGAL::Point_3<Kernel> Point::toPoint_d<3>() const;
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -28,7 +28,7 @@
 
 #include <boost/serialization/base_object.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A point in SFA.
@@ -55,6 +55,10 @@ public:
      * XY Constructor with exact coordinates
      */
     Point( const Kernel::FT& x, const Kernel::FT& y, const Kernel::FT& z, const double& m = NaN() ) ;
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+    // with the inexact constructions kernel, Kernel::FT is double and the constructors
+    // above are the double constructors
+
     /**
      * XY constructor
      */
@@ -69,6 +73,7 @@ public:
      * XYZM constructor
      */
     Point( const double& x, const double& y, const double& z, const double& m  ) ;
+#endif
 
     /**
      * Constructor from CGAL::Point_2<K>
@@ -226,6 +231,6 @@ private:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
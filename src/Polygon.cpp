@@ -24,7 +24,7 @@
 #include <SFCGAL/Triangle.h>
 #include <SFCGAL/algorithm/orientation.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -69,6 +69,17 @@ Polygon::Polygon( LineString* exteriorRing ):
     _rings.push_back( exteriorRing );
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+Polygon::Polygon( LineString&& exteriorRing ):
+    Surface()
+{
+    _rings.push_back( new LineString( std::move( exteriorRing ) ) );
+}
+#endif
+
 ///
 ///
 ///
@@ -95,6 +106,18 @@ Polygon::Polygon( const Polygon& other ):
     }
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+Polygon::Polygon( Polygon&& other ):
+    Surface( other )
+{
+    _rings.push_back( new LineString() );
+    swap( other );
+}
+#endif
+
 ///
 ///
 ///
@@ -277,5 +300,5 @@ CGAL::Polygon_with_holes_2<Kernel> Polygon::toPolygon_with_holes_2( bool fixOrie
             holes.end() );
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -22,6 +22,7 @@
 #define _SFCGAL_POLYGON_H_
 
 #include <vector>
+#include <utility>
 #include <boost/assert.hpp>
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/serialization/base_object.hpp>
@@ -33,7 +34,7 @@
 #include <SFCGAL/Surface.h>
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A Polygon in SFA with holes
@@ -60,6 +61,12 @@ public:
      * Constructor with an exterior ring (takes ownership)
      */
     Polygon( LineString* exteriorRing ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Constructor with an exterior ring (steals the points of exteriorRing)
+     */
+    Polygon( LineString&& exteriorRing ) ;
+#endif
     /**
      * Constructor with a Triangle
      */
@@ -68,6 +75,12 @@ public:
      * Copy constructor
      */
     Polygon( const Polygon& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor (steals the rings, other is left as an empty Polygon)
+     */
+    Polygon( Polygon&& other ) ;
+#endif
 
     /**
      * Constructor from CGAL::Polygon_with_holes_2<K>
@@ -202,6 +215,21 @@ public:
         BOOST_ASSERT( ls != NULL );
         _rings.push_back( ls ) ;
     }
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * append a ring to the Polygon (steals the points of ls)
+     */
+    inline void            addInteriorRing( LineString&& ls ) {
+        _rings.push_back( new LineString( std::move( ls ) ) ) ;
+    }
+#endif
+    /**
+     * removes the n-th interior ring
+     */
+    inline void            removeInteriorRingN( const size_t& n ) {
+        BOOST_ASSERT( n < numInteriorRings() );
+        _rings.erase( _rings.begin() + n + 1 ) ;
+    }
 
     /**
      * append a ring to the Polygon
@@ -273,11 +301,11 @@ private:
     boost::ptr_vector< LineString > _rings ;
 
     void swap( Polygon& other ) {
-        std::swap( _rings, other._rings );
+        _rings.swap( other._rings );
     }
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
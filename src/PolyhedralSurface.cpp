@@ -23,7 +23,7 @@
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -56,6 +56,18 @@ PolyhedralSurface::PolyhedralSurface( const PolyhedralSurface& other ) :
 
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+PolyhedralSurface::PolyhedralSurface( PolyhedralSurface&& other ):
+    Surface(),
+    _polygons()
+{
+    swap( other );
+}
+#endif
+
 ///
 ///
 ///
@@ -204,6 +216,16 @@ void  PolyhedralSurface::addPolygon( Polygon* polygon )
     _polygons.push_back( polygon );
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+void  PolyhedralSurface::addPolygon( Polygon&& polygon )
+{
+    addPolygon( new Polygon( std::move( polygon ) ) );
+}
+#endif
+
 ///
 ///
 ///
@@ -214,6 +236,15 @@ void  PolyhedralSurface::addPolygons( const PolyhedralSurface& polyhedralSurface
     }
 }
 
+///
+///
+///
+void  PolyhedralSurface::removePolygonN( const size_t& n )
+{
+    BOOST_ASSERT( n < _polygons.size() );
+    _polygons.erase( _polygons.begin() + n );
+}
+
 ///
 ///
 ///
@@ -254,7 +285,7 @@ void PolyhedralSurface::accept( ConstGeometryVisitor& visitor ) const
 {
     return visitor.visit( *this );
 }
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -34,7 +34,7 @@
 
 #include <CGAL/Polyhedron_3.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A PolyhedralSurface in SFA modeled as a Polygon soup
@@ -62,6 +62,12 @@ public:
      * Copy constructor
      */
     PolyhedralSurface( const PolyhedralSurface& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor (steals the polygons, other is left empty)
+     */
+    PolyhedralSurface( PolyhedralSurface&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -126,10 +132,20 @@ public:
      * add a polygon to the PolyhedralSurface
      */
     void                      addPolygon( Polygon* polygon ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * add a polygon to the PolyhedralSurface (steals the rings of polygon)
+     */
+    void                      addPolygon( Polygon&& polygon ) ;
+#endif
     /**
      * add polygons from an other PolyhedralSurface
      */
     void                      addPolygons( const PolyhedralSurface& polyhedralSurface ) ;
+    /**
+     * removes the n-th polygon
+     */
+    void                      removePolygonN( const size_t& n ) ;
 
     //-- SFCGAL::Geometry
     virtual size_t               numGeometries() const ;
@@ -184,9 +200,9 @@ private:
     boost::ptr_vector< Polygon > _polygons ;
 
     void swap( PolyhedralSurface& other ) {
-        std::swap( _polygons, other._polygons );
+        _polygons.swap( other._polygons );
     }
 };
-}
+SFCGAL_END_NAMESPACE
 
 #endif
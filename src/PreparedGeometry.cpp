@@ -20,23 +20,32 @@
 
 #include <SFCGAL/PreparedGeometry.h>
 
+#include <SFCGAL/Exception.h>
 #include <SFCGAL/detail/io/WktWriter.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/algorithm/isValid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 PreparedGeometry::PreparedGeometry() :
-    _srid( 0 )
+    _srid( 0 ),
+    _isValid2D( false ),
+    _isValid3D( false )
 {
 }
 
 PreparedGeometry::PreparedGeometry( std::auto_ptr<Geometry> geometry, srid_t srid ) :
     _geometry( geometry ),
-    _srid( srid )
+    _srid( srid ),
+    _isValid2D( false ),
+    _isValid3D( false )
 {
 }
 
 PreparedGeometry::PreparedGeometry( Geometry* geometry, srid_t srid ) :
     _geometry( geometry ),
-    _srid( srid )
+    _srid( srid ),
+    _isValid2D( false ),
+    _isValid3D( false )
 {
 }
 
@@ -64,6 +73,8 @@ void PreparedGeometry::resetGeometry( Geometry* geom )
 
 const Envelope& PreparedGeometry::envelope() const
 {
+    boost::mutex::scoped_lock lock( _cacheMutex );
+
     if ( ! _envelope ) {
         _envelope.reset( _geometry->envelope() );
     }
@@ -71,9 +82,72 @@ const Envelope& PreparedGeometry::envelope() const
     return *_envelope;
 }
 
+const detail::PreparedGeometrySet<2>& PreparedGeometry::geometrySet2D() const
+{
+    boost::mutex::scoped_lock lock( _cacheMutex );
+
+    if ( ! _geometrySet2D ) {
+        _geometrySet2D.reset( new detail::PreparedGeometrySet<2>( *_geometry ) );
+    }
+
+    return *_geometrySet2D;
+}
+
+const detail::PreparedGeometrySet<3>& PreparedGeometry::geometrySet3D() const
+{
+    boost::mutex::scoped_lock lock( _cacheMutex );
+
+    if ( ! _geometrySet3D ) {
+        _geometrySet3D.reset( new detail::PreparedGeometrySet<3>( *_geometry ) );
+    }
+
+    return *_geometrySet3D;
+}
+
+const detail::PreparedGeometrySet<2>* PreparedGeometry::cachedGeometrySet2D() const
+{
+    boost::mutex::scoped_lock lock( _cacheMutex );
+    return _geometrySet2D.get();
+}
+
+const detail::PreparedGeometrySet<3>* PreparedGeometry::cachedGeometrySet3D() const
+{
+    boost::mutex::scoped_lock lock( _cacheMutex );
+    return _geometrySet3D.get();
+}
+
+void PreparedGeometry::assertValidity2D() const
+{
+    boost::mutex::scoped_lock lock( _cacheMutex );
+
+    // a skipped check is not cached
+    if ( ! _isValid2D && ! algorithm::SKIP_GEOM_VALIDATION ) {
+        // throws if invalid
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( *_geometry );
+        _isValid2D = true ;
+    }
+}
+
+void PreparedGeometry::assertValidity3D() const
+{
+    boost::mutex::scoped_lock lock( _cacheMutex );
+
+    // a skipped check is not cached
+    if ( ! _isValid3D && ! algorithm::SKIP_GEOM_VALIDATION ) {
+        // throws if invalid
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( *_geometry );
+        _isValid3D = true ;
+    }
+}
+
 void PreparedGeometry::invalidateCache()
 {
+    boost::mutex::scoped_lock lock( _cacheMutex );
     _envelope.reset();
+    _geometrySet2D.reset();
+    _geometrySet3D.reset();
+    _isValid2D = false ;
+    _isValid3D = false ;
 }
 
 std::string PreparedGeometry::asEWKT( const int& numDecimals ) const
@@ -99,4 +173,4 @@ std::string PreparedGeometry::asEWKT( const int& numDecimals ) const
     writer.write( *_geometry, exactWrite );
     return oss.str();
 }
-}
+SFCGAL_END_NAMESPACE
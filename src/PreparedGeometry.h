@@ -28,12 +28,17 @@
 #include <boost/serialization/split_member.hpp>
 #include <boost/optional.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <stdint.h> // uint32_t
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 class Geometry;
+namespace detail {
+template <int Dim> class PreparedGeometrySet;
+}
 
 typedef uint32_t srid_t;
 
@@ -43,6 +48,11 @@ typedef uint32_t srid_t;
  *
  * It is noncopyable since it stores a std::auto_ptr<SFCGAL::Geometry>
  *
+ * Cached computations are built on first use, their construction is serialized by a mutex.
+ * The cached decompositions share the lazy exact numbers of the geometry, which are reference counted
+ * without atomic operations : a PreparedGeometry can't be shared between threads (see ExecutionPolicy).
+ *
+ * @warning invalidateCache() must be called after modifying the geometry through geometry()
  */
 class SFCGAL_API PreparedGeometry : public boost::noncopyable {
 public:
@@ -95,6 +105,40 @@ public:
      */
     const Envelope& envelope() const;
 
+    /**
+     * Decomposition of the geometry in 2D primitives with their bounding boxes (using cache)
+     */
+    const detail::PreparedGeometrySet<2>& geometrySet2D() const;
+
+    /**
+     * Decomposition of the geometry in 3D primitives with their bounding boxes (using cache)
+     */
+    const detail::PreparedGeometrySet<3>& geometrySet3D() const;
+
+    /**
+     * Decomposition of the geometry in 2D primitives, NULL if not built yet (doesn't build it)
+     */
+    const detail::PreparedGeometrySet<2>* cachedGeometrySet2D() const;
+
+    /**
+     * Decomposition of the geometry in 3D primitives, NULL if not built yet (doesn't build it)
+     */
+    const detail::PreparedGeometrySet<3>* cachedGeometrySet3D() const;
+
+    /**
+     * Checks the validity of the geometry in 2D (see SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D).
+     * A successful check is cached.
+     * @throw GeometryInvalidityException if the geometry is invalid
+     */
+    void assertValidity2D() const;
+
+    /**
+     * Checks the validity of the geometry in 3D (see SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D).
+     * A successful check is cached.
+     * @throw GeometryInvalidityException if the geometry is invalid
+     */
+    void assertValidity3D() const;
+
     /**
      * Resets the cache
      */
@@ -138,8 +182,19 @@ protected:
 
     // bbox of the geometry
     mutable boost::optional<Envelope> _envelope;
+
+    // decompositions of the geometry
+    mutable boost::scoped_ptr< detail::PreparedGeometrySet<2> > _geometrySet2D;
+    mutable boost::scoped_ptr< detail::PreparedGeometrySet<3> > _geometrySet3D;
+
+    // successful validity checks
+    mutable bool _isValid2D;
+    mutable bool _isValid3D;
+
+    // protects the cache
+    mutable boost::mutex _cacheMutex;
 };
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
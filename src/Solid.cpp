@@ -21,7 +21,7 @@
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -73,6 +73,18 @@ Solid::Solid( const Solid& other ):
     }
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+Solid::Solid( Solid&& other ):
+    Geometry( other )
+{
+    _shells.push_back( new PolyhedralSurface() );
+    swap( other );
+}
+#endif
+
 ///
 ///
 ///
@@ -173,7 +185,7 @@ void Solid::accept( ConstGeometryVisitor& visitor ) const
     return visitor.visit( *this );
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
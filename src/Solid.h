@@ -22,6 +22,7 @@
 #define _SFCGAL_SOLID_H_
 
 #include <vector>
+#include <utility>
 #include <boost/assert.hpp>
 
 #include <boost/ptr_container/ptr_vector.hpp>
@@ -33,7 +34,7 @@
 
 #include <CGAL/Nef_polyhedron_3.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * A Solid modeled with an exteriorShell and interiorShells materialized by PolyhedralSurface.
@@ -67,6 +68,12 @@ public:
      * Copy constructor
      */
     Solid( const Solid& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor (steals the shells, other is left as an empty Solid)
+     */
+    Solid( Solid&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -138,6 +145,14 @@ public:
         BOOST_ASSERT( shell != NULL );
         _shells.push_back( shell );
     }
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * add an interior shell to the Solid (steals the polygons of shell)
+     */
+    inline void                         addInteriorShell( PolyhedralSurface&& shell ) {
+        _shells.push_back( new PolyhedralSurface( std::move( shell ) ) );
+    }
+#endif
 
     /**
      * Returns the number of shells
@@ -202,6 +217,6 @@ private:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
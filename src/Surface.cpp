@@ -21,7 +21,7 @@
 #include <SFCGAL/Surface.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -73,7 +73,7 @@ Surface::Surface( Surface const& other ) :
 //virtual Point pointOnSurface() const = 0 ;
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
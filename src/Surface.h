@@ -23,7 +23,7 @@
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * Abstract Surface class
@@ -64,6 +64,6 @@ protected:
 };
 
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -33,7 +33,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -161,8 +161,9 @@ void Transform::visit( PolyhedralSurface& g )
 ///
 void Transform::visit( TriangulatedSurface& g )
 {
-    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        visit( g.geometryN( i ) ) ;
+    // shared vertices are transformed once
+    for ( size_t i = 0; i < g.numVertices(); i++ ) {
+        visit( g.vertexN( i ) ) ;
     }
 }
 
@@ -170,5 +171,5 @@ void Transform::visit( TriangulatedSurface& g )
 
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
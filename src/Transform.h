@@ -25,7 +25,7 @@
 #include <SFCGAL/GeometryVisitor.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * Represents a coordinate transform
@@ -49,11 +49,16 @@ public:
     virtual void visit( MultiSolid& g );
     virtual void visit( GeometryCollection& g ) ;
     virtual void visit( PolyhedralSurface& g ) ;
+    /**
+     * transforms the vertices of the mesh (shared vertices are transformed once)
+     * @warning visit( Triangle& ) is not called for the triangles of a TriangulatedSurface,
+     * transforms modifying triangles must override this method too
+     */
     virtual void visit( TriangulatedSurface& g ) ;
 };
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -32,7 +32,7 @@
 #include <CGAL/Triangle_2.h>
 #include <CGAL/Triangle_3.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * [OGC/SFA]Triangle
@@ -159,6 +159,6 @@ private:
     Point _vertices[3];
 };
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
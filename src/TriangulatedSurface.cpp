@@ -21,14 +21,41 @@
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+#include <boost/thread/mutex.hpp>
+
+#include <map>
+#include <algorithm>
+
+SFCGAL_BEGIN_NAMESPACE
+
+const size_t TriangulatedSurface::NO_NEIGHBOUR ;
+
+namespace {
+/**
+ * mutexes protecting the construction of the triangle caches. The cache is built once per
+ * TriangulatedSurface, so a small pool indexed by address is shared instead of storing a
+ * mutex in every TriangulatedSurface
+ */
+const size_t NUM_TRIANGLE_CACHE_MUTEXES = 16 ;
+boost::mutex triangleCacheMutexes[ NUM_TRIANGLE_CACHE_MUTEXES ] ;
+
+boost::mutex& triangleCacheMutex( const TriangulatedSurface* surface )
+{
+    const size_t n = reinterpret_cast< size_t >( surface ) / sizeof( TriangulatedSurface ) ;
+    return triangleCacheMutexes[ n % NUM_TRIANGLE_CACHE_MUTEXES ] ;
+}
+}
 
 ///
 ///
 ///
 TriangulatedSurface::TriangulatedSurface():
     Surface(),
-    _triangles()
+    _vertices(),
+    _indices(),
+    _triangles(),
+    _numCachedTriangles( 0 ),
+    _indexed( true )
 {
 
 }
@@ -37,10 +64,14 @@ TriangulatedSurface::TriangulatedSurface():
 ///
 ///
 TriangulatedSurface::TriangulatedSurface( const std::vector< Triangle >& triangles ):
-    Surface()
+    Surface(),
+    _numCachedTriangles( 0 ),
+    _indexed( true )
 {
+    reserve( triangles.size() );
+
     for ( size_t i = 0; i < triangles.size(); i++ ) {
-        _triangles.push_back( triangles[i].clone() ) ;
+        addTriangle( triangles[i] ) ;
     }
 }
 
@@ -49,10 +80,28 @@ TriangulatedSurface::TriangulatedSurface( const std::vector< Triangle >& triangl
 ///
 TriangulatedSurface::TriangulatedSurface( const TriangulatedSurface& other ):
     Surface(),
-    _triangles( other._triangles )
+    _numCachedTriangles( 0 ),
+    _indexed( true )
 {
+    // a copy is always an indexed mesh
+    addTriangles( other );
+}
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+///
+///
+///
+TriangulatedSurface::TriangulatedSurface( TriangulatedSurface&& other ):
+    Surface(),
+    _vertices(),
+    _indices(),
+    _triangles(),
+    _numCachedTriangles( 0 ),
+    _indexed( true )
+{
+    swap( other );
 }
+#endif
 
 ///
 ///
@@ -109,11 +158,11 @@ int TriangulatedSurface::dimension() const
 ///
 int TriangulatedSurface::coordinateDimension() const
 {
-    if ( _triangles.empty() ) {
+    if ( isEmpty() ) {
         return 0 ;
     }
     else {
-        return _triangles[0].coordinateDimension() ;
+        return triangleVertex( 0, 0 ).coordinateDimension() ;
     }
 }
 
@@ -122,7 +171,7 @@ int TriangulatedSurface::coordinateDimension() const
 ///
 bool TriangulatedSurface::isEmpty() const
 {
-    return _triangles.empty() ;
+    return numTriangles() == 0 ;
 }
 
 ///
@@ -130,7 +179,7 @@ bool TriangulatedSurface::isEmpty() const
 ///
 bool TriangulatedSurface::is3D() const
 {
-    return ! _triangles.empty() && _triangles.front().is3D() ;
+    return ! isEmpty() && triangleVertex( 0, 0 ).is3D() ;
 }
 
 ///
@@ -138,17 +187,232 @@ bool TriangulatedSurface::is3D() const
 ///
 bool TriangulatedSurface::isMeasured() const
 {
-    return ! _triangles.empty() && _triangles.front().isMeasured() ;
+    return ! isEmpty() && triangleVertex( 0, 0 ).isMeasured() ;
+}
+
+///
+///
+///
+void  TriangulatedSurface::addTriangle( const Triangle& triangle )
+{
+    if ( ! _indexed ) {
+        _triangles.push_back( triangle.clone() );
+        return ;
+    }
+
+    for ( int i = 0; i < 3; i++ ) {
+        _indices.push_back( _vertices.size() );
+        _vertices.push_back( triangle.vertex( i ) );
+    }
 }
 
+///
+///
+///
+void  TriangulatedSurface::addTriangle( Triangle* triangle )
+{
+    BOOST_ASSERT( triangle != NULL );
+
+    if ( ! _indexed ) {
+        _triangles.push_back( triangle );
+        return ;
+    }
+
+    std::auto_ptr< Triangle > owned( triangle );
+    addTriangle( *owned );
+}
 
 ///
 ///
 ///
 void  TriangulatedSurface::addTriangles( const TriangulatedSurface& other )
 {
-    for ( TriangulatedSurface::const_iterator it = other.begin(); it != other.end(); ++it ) {
-        addTriangle( *it ) ;
+    const size_t numVertices  = other.numVertices() ;
+    const size_t numTriangles = other.numTriangles() ;
+
+    if ( ! _indexed ) {
+        for ( size_t i = 0; i < numTriangles; i++ ) {
+            _triangles.push_back( new Triangle( other.triangleN( i ).toTriangle() ) );
+        }
+
+        return ;
+    }
+
+    // shared vertices of other remain shared
+    const size_t offset = _vertices.size() ;
+    _vertices.reserve( offset + numVertices );
+
+    for ( size_t i = 0; i < numVertices; i++ ) {
+        _vertices.push_back( other.vertexN( i ) );
+    }
+
+    _indices.reserve( _indices.size() + 3 * numTriangles );
+
+    for ( size_t i = 0; i < numTriangles; i++ ) {
+        for ( size_t j = 0; j < 3; j++ ) {
+            _indices.push_back( offset + other.vertexIndex( i, j ) );
+        }
+    }
+}
+
+///
+///
+///
+void  TriangulatedSurface::releaseTriangles( boost::ptr_vector< Triangle >& triangles )
+{
+    _buildTriangles();
+    triangles.transfer( triangles.end(), _triangles );
+
+    // no triangle left, back to an (empty) indexed mesh
+    _numCachedTriangles.store( 0, boost::memory_order_relaxed );
+    _vertices.clear();
+    _indices.clear();
+    _indexed = true ;
+}
+
+///
+///
+///
+size_t  TriangulatedSurface::addVertex( const Point& p )
+{
+    if ( ! _indexed ) {
+        BOOST_THROW_EXCEPTION( Exception( "can't add a vertex to a TriangulatedSurface stored as a triangle soup" ) );
+    }
+
+    _vertices.push_back( p );
+    return _vertices.size() - 1 ;
+}
+
+///
+///
+///
+void  TriangulatedSurface::addTriangle( const size_t& a, const size_t& b, const size_t& c )
+{
+    if ( ! _indexed ) {
+        BOOST_THROW_EXCEPTION( Exception( "can't add an indexed triangle to a TriangulatedSurface stored as a triangle soup" ) );
+    }
+
+    BOOST_ASSERT( a < _vertices.size() && b < _vertices.size() && c < _vertices.size() );
+    _indices.push_back( a );
+    _indices.push_back( b );
+    _indices.push_back( c );
+}
+
+///
+///
+///
+void  TriangulatedSurface::reverseTriangle( const size_t& n )
+{
+    BOOST_ASSERT( n < numTriangles() );
+
+    if ( ! _indexed ) {
+        _triangles[n].reverse();
+        return ;
+    }
+
+    // the read-only triangles would be out of date
+    clearTriangleCache();
+    std::swap( _indices[ 3 * n + 1 ], _indices[ 3 * n + 2 ] );
+}
+
+///
+///
+///
+Point&  TriangulatedSurface::vertexN( size_t const& n )
+{
+    BOOST_ASSERT( n < numVertices() );
+
+    if ( ! _indexed ) {
+        return _triangles[ n / 3 ].vertex( n % 3 ) ;
+    }
+
+    // the read-only triangles would be out of date
+    clearTriangleCache();
+    return _vertices[n] ;
+}
+
+///
+///
+///
+void  TriangulatedSurface::clearTriangleCache()
+{
+    if ( ! _indexed ) {
+        return ;
+    }
+
+    _triangles.clear();
+    _numCachedTriangles.store( 0, boost::memory_order_relaxed );
+}
+
+///
+///
+///
+void  TriangulatedSurface::weldVertices()
+{
+    if ( ! _indexed ) {
+        return ;
+    }
+
+    // Point comparison ignores m
+    typedef std::map< std::pair< Point, double >, size_t > VertexMap ;
+    VertexMap merged ;
+    std::vector< Point > vertices ;
+    std::vector< size_t > newIndex( _vertices.size() );
+
+    for ( size_t i = 0; i < _vertices.size(); i++ ) {
+        const Point& p = _vertices[i] ;
+        const std::pair< VertexMap::iterator, bool > inserted = merged.insert(
+                    std::make_pair( std::make_pair( p, p.isMeasured() ? p.m() : 0.0 ), vertices.size() )
+                );
+
+        if ( inserted.second ) {
+            vertices.push_back( p );
+        }
+
+        newIndex[i] = inserted.first->second ;
+    }
+
+    if ( vertices.size() == _vertices.size() ) {
+        return ;
+    }
+
+    for ( size_t i = 0; i < _indices.size(); i++ ) {
+        _indices[i] = newIndex[ _indices[i] ];
+    }
+
+    // the read-only triangles remain valid (same points)
+    _vertices.swap( vertices );
+}
+
+///
+///
+///
+void  TriangulatedSurface::computeNeighbours( std::vector< size_t >& neighbours ) const
+{
+    const size_t numTriangles = this->numTriangles() ;
+    neighbours.assign( 3 * numTriangles, NO_NEIGHBOUR );
+
+    // edge (smaller vertex index, larger vertex index) => 3 * triangle + edge, for unmatched edges
+    typedef std::map< std::pair< size_t, size_t >, size_t > EdgeMap ;
+    EdgeMap openEdges ;
+
+    for ( size_t t = 0; t < numTriangles; t++ ) {
+        for ( size_t i = 0; i < 3; i++ ) {
+            const size_t a = vertexIndex( t, i ) ;
+            const size_t b = vertexIndex( t, ( i + 1 ) % 3 ) ;
+            const std::pair< size_t, size_t > edge( std::min( a, b ), std::max( a, b ) );
+
+            EdgeMap::iterator found = openEdges.find( edge );
+
+            if ( found == openEdges.end() ) {
+                openEdges.insert( std::make_pair( edge, 3 * t + i ) );
+            }
+            else {
+                neighbours[ 3 * t + i ]      = found->second / 3 ;
+                neighbours[ found->second ] = t ;
+                openEdges.erase( found );
+            }
+        }
     }
 }
 
@@ -158,7 +422,7 @@ void  TriangulatedSurface::addTriangles( const TriangulatedSurface& other )
 ///
 size_t  TriangulatedSurface::numGeometries() const
 {
-    return _triangles.size();
+    return numTriangles();
 }
 
 ///
@@ -167,6 +431,7 @@ size_t  TriangulatedSurface::numGeometries() const
 const Triangle&    TriangulatedSurface::geometryN( size_t const& n ) const
 {
     BOOST_ASSERT( n < numGeometries() );
+    _buildTriangles();
     return _triangles[n];
 }
 
@@ -176,6 +441,7 @@ const Triangle&    TriangulatedSurface::geometryN( size_t const& n ) const
 Triangle&    TriangulatedSurface::geometryN( size_t const& n )
 {
     BOOST_ASSERT( n < numGeometries() );
+    _toTriangleSoup();
     return _triangles[n];
 }
 
@@ -184,7 +450,12 @@ Triangle&    TriangulatedSurface::geometryN( size_t const& n )
 ///
 void TriangulatedSurface::reserve( const size_t& n )
 {
-    _triangles.reserve( n );
+    if ( _indexed ) {
+        _indices.reserve( 3 * n );
+    }
+    else {
+        _triangles.reserve( n );
+    }
 }
 
 ///
@@ -203,6 +474,50 @@ void TriangulatedSurface::accept( ConstGeometryVisitor& visitor ) const
     return visitor.visit( *this );
 }
 
+///
+///
+///
+void TriangulatedSurface::_buildTriangles() const
+{
+    if ( ! _indexed ) {
+        return ;
+    }
+
+    const size_t numTriangles = this->numTriangles() ;
+
+    // fast path, the cache is complete (acquire : the triangles published below are visible)
+    if ( _numCachedTriangles.load( boost::memory_order_acquire ) == numTriangles ) {
+        return ;
+    }
+
+    boost::mutex::scoped_lock lock( triangleCacheMutex( this ) );
+
+    // the cache is a prefix of the triangles (triangles may have been added since)
+    _triangles.reserve( numTriangles );
+
+    for ( size_t i = _triangles.size(); i < numTriangles; i++ ) {
+        _triangles.push_back( new Triangle( triangleN( i ).toTriangle() ) );
+    }
+
+    _numCachedTriangles.store( numTriangles, boost::memory_order_release );
+}
+
+///
+///
+///
+void TriangulatedSurface::_toTriangleSoup()
+{
+    if ( ! _indexed ) {
+        return ;
+    }
+
+    _buildTriangles();
+
+    std::vector< Point >().swap( _vertices );
+    std::vector< size_t >().swap( _indices );
+    _indexed = false ;
+}
+
 
 // Private class
 // A modifier creating triangles from a TriangulatedSurface with the incremental builder.
@@ -215,26 +530,41 @@ public:
     typedef typename Vertex::Point              Point;
     typedef typename HDS::Traits                K;
     typedef std::map<Point, size_t>             PointMap;
-    typedef std::set< std::pair<Point, Point> > HalfedgeSet;
+    typedef std::set< std::pair<size_t, size_t> > HalfedgeSet;
 
     void operator()( HDS& hds ) {
         // Postcondition: `hds' is a valid polyhedral surface.
         CGAL::Polyhedron_incremental_builder_3<HDS> B( hds, true );
-        B.begin_surface( /* vertices */ surf.numGeometries() * 3,
-                                        /* facets */ surf.numGeometries(),
-                                        /* halfedges */ surf.numGeometries() * 3 );
+        B.begin_surface( /* vertices */ surf.numVertices(),
+                                        /* facets */ surf.numTriangles(),
+                                        /* halfedges */ surf.numTriangles() * 3 );
 
         size_t vertex_idx = 0;
 
         // first pass: insert vertices, only if they are not shared between faces
-        // thanks to a binary tree (PointMap)
-        for ( size_t i = 0; i < surf.numGeometries(); i++ ) {
+        // thanks to a binary tree (PointMap). Each vertex of the mesh is looked up once,
+        // equal points are merged even if they don't share the same index in the mesh
+        const size_t notInserted = static_cast< size_t >( -1 );
+        std::vector< size_t > polyhedronVertex( surf.numVertices(), notInserted );
+
+        for ( size_t i = 0; i < surf.numTriangles(); i++ ) {
             for ( size_t j = 0; j < 3; j++ ) {
-                Point p = surf.geometryN( i ).vertex( j ).toPoint_3();
+                const size_t v = surf.vertexIndex( i, j );
 
-                if ( points.find( p ) == points.end() ) {
+                if ( polyhedronVertex[v] != notInserted ) {
+                    continue;
+                }
+
+                Point p = surf.vertexN( v ).toPoint_3();
+                typename PointMap::const_iterator found = points.find( p );
+
+                if ( found == points.end() ) {
                     B.add_vertex( p );
-                    points[p] = vertex_idx++;
+                    points[p] = vertex_idx;
+                    polyhedronVertex[v] = vertex_idx++;
+                }
+                else {
+                    polyhedronVertex[v] = found->second;
                 }
             }
         }
@@ -246,24 +576,23 @@ public:
         // "The convention is that the halfedges are oriented counterclockwise
         // around facets as seen from the outside of the polyhedron"
 
-        for ( size_t i = 0; i < surf.numGeometries(); i++ ) {
+        for ( size_t i = 0; i < surf.numTriangles(); i++ ) {
             B.begin_facet();
-            CGAL::Triangle_3<K> tri( surf.geometryN( i ).toTriangle_3() );
-            CGAL::Point_3<K> pa( tri[0] );
-            CGAL::Point_3<K> pb( tri[1] );
-            CGAL::Point_3<K> pc( tri[2] );
+            const size_t pa = polyhedronVertex[ surf.vertexIndex( i, 0 ) ];
+            const size_t pb = polyhedronVertex[ surf.vertexIndex( i, 1 ) ];
+            const size_t pc = polyhedronVertex[ surf.vertexIndex( i, 2 ) ];
 
             if ( edges.find( std::make_pair( pa, pb ) ) != edges.end() ||
                     edges.find( std::make_pair( pb, pc ) ) != edges.end() ||
                     edges.find( std::make_pair( pc, pa ) ) != edges.end() ) {
                 BOOST_THROW_EXCEPTION( Exception( "When trying to build a CGAL::Polyhedron_3 from a TriangulatedSurface: bad orientation for "
-                                                  + surf.geometryN( i ).asText()
+                                                  + surf.triangleN( i ).toTriangle().asText()
                                                   + " consider using ConsistentOrientationBuilder first" ) );
             }
 
-            B.add_vertex_to_facet( points[pa] );
-            B.add_vertex_to_facet( points[pb] );
-            B.add_vertex_to_facet( points[pc] );
+            B.add_vertex_to_facet( pa );
+            B.add_vertex_to_facet( pb );
+            B.add_vertex_to_facet( pc );
             edges.insert( std::make_pair( pa, pb ) );
             edges.insert( std::make_pair( pb, pc ) );
             edges.insert( std::make_pair( pc, pa ) );
@@ -304,6 +633,6 @@ std::auto_ptr<Polyhedron> TriangulatedSurface::toPolyhedron_3() const
 template SFCGAL_API std::auto_ptr< detail::MarkedPolyhedron > TriangulatedSurface::toPolyhedron_3<Kernel, detail::MarkedPolyhedron >() const;
 template SFCGAL_API std::auto_ptr< CGAL::Polyhedron_3<Kernel> > TriangulatedSurface::toPolyhedron_3<Kernel, CGAL::Polyhedron_3<Kernel> >() const;
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
@@ -26,7 +26,9 @@
 #include <boost/assert.hpp>
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/serialization/base_object.hpp>
-#include <boost/ptr_container/serialize_ptr_vector.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/atomic.hpp>
 
 
 #include <CGAL/Polyhedron_3.h>
@@ -37,18 +39,96 @@
 #include <SFCGAL/Triangle.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
- * A TriangulatedSurface in SFA modeled as a Triangle soup
+ * A TriangulatedSurface in SFA modeled as an indexed mesh
+ *
+ * Vertices are stored once in a vertex buffer and triangles are index triples into this
+ * buffer. Triangle objects (geometryN(), iterators, visitors) are only built on demand :
+ *
+ * - const access builds them once, as a read-only cache consistent with the mesh (later const
+ * accesses only test an atomic counter, they do not lock). The cache holds a copy of the vertices
+ * of every triangle, it is kept until the mesh is modified or clearTriangleCache() is called ;
+ * - non-const access to a Triangle (non-const geometryN(), triangleN(), begin() and end())
+ * switches the TriangulatedSurface to a "triangle soup" where the Triangle objects are the
+ * storage and the vertex buffer is released (see isIndexed()).
+ *
+ * Vertex accessors (numVertices(), vertexN(), vertexIndex(), triangleVertex()) are valid
+ * in both modes (a triangle soup behaves as a mesh with three vertices per triangle), they
+ * should be preferred by algorithms on large TINs.
+ *
  * @ingroup public_api
- * @todo do better than a "triangle soup" or add topological view?
  */
 class SFCGAL_API TriangulatedSurface : public Surface {
 public:
     typedef boost::ptr_vector< Triangle >::iterator       iterator ;
     typedef boost::ptr_vector< Triangle >::const_iterator const_iterator ;
 
+    /**
+     * value returned by computeNeighbours() for a border edge
+     */
+    static const size_t NO_NEIGHBOUR = static_cast< size_t >( -1 ) ;
+
+    /**
+     * Read-only view on the n-th triangle of a TriangulatedSurface (no copy of the vertices)
+     * @warning invalidated when the TriangulatedSurface is modified
+     */
+    class SFCGAL_API TriangleView {
+    public:
+        TriangleView( const TriangulatedSurface& surface, const size_t& n ):
+            _surface( &surface ),
+            _n( n ) {
+        }
+
+        /**
+         * returns the i-th vertex
+         */
+        inline const Point& vertex( const int& i ) const {
+            return _surface->triangleVertex( _n, i % 3 ) ;
+        }
+
+        inline bool isEmpty() const {
+            return vertex( 0 ).isEmpty() ;
+        }
+        inline bool is3D() const {
+            return vertex( 0 ).is3D() ;
+        }
+
+        /**
+         * Convert to CGAL::Triangle_2
+         */
+        inline Kernel::Triangle_2 toTriangle_2() const {
+            return Kernel::Triangle_2( vertex( 0 ).toPoint_2(), vertex( 1 ).toPoint_2(), vertex( 2 ).toPoint_2() );
+        }
+        /**
+         * Convert to CGAL::Triangle_3
+         */
+        inline Kernel::Triangle_3 toTriangle_3() const {
+            return Kernel::Triangle_3( vertex( 0 ).toPoint_3(), vertex( 1 ).toPoint_3(), vertex( 2 ).toPoint_3() );
+        }
+        /**
+         * Convert to CGAL::Triangle_2 or CGAL::Triangle_3
+         */
+        template < int D >
+        inline typename detail::TypeForDimension<D>::Triangle toTriangle_d() const {
+            return typename detail::TypeForDimension<D>::Triangle( vertex( 0 ).toPoint_d<D>(), vertex( 1 ).toPoint_d<D>(), vertex( 2 ).toPoint_d<D>() );
+        }
+        /**
+         * Copy to a Triangle
+         */
+        inline Triangle toTriangle() const {
+            if ( isEmpty() ) {
+                return Triangle();
+            }
+
+            return Triangle( vertex( 0 ), vertex( 1 ), vertex( 2 ) );
+        }
+    private:
+        const TriangulatedSurface* _surface ;
+        size_t _n ;
+    };
+
     /**
      * Empty TriangulatedSurface constructor
      */
@@ -61,6 +141,12 @@ public:
      * Copy constructor
      */
     TriangulatedSurface( const TriangulatedSurface& other ) ;
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Move constructor (steals the triangles, other is left empty)
+     */
+    TriangulatedSurface( TriangulatedSurface&& other ) ;
+#endif
     /**
      * assign operator
      */
@@ -89,51 +175,135 @@ public:
     virtual bool           isMeasured() const ;
 
     /**
-     * [SFA/OGC]Returns the number of points
+     * [SFA/OGC]Returns the number of triangles
      * @deprecated see numGeometries()
      */
     inline size_t             numTriangles() const {
-        return _triangles.size();
+        return _indexed ? _indices.size() / 3 : _triangles.size() ;
     }
     /**
-     * [SFA/OGC]Returns the n-th point
+     * [SFA/OGC]Returns a view on the n-th triangle
      * @deprecated see geometryN()
      */
-    inline const Triangle&    triangleN( size_t const& n ) const {
-        BOOST_ASSERT( n < _triangles.size() );
-        return _triangles[n];
+    inline TriangleView       triangleN( size_t const& n ) const {
+        BOOST_ASSERT( n < numTriangles() );
+        return TriangleView( *this, n );
     }
     /**
-     * [SFA/OGC]Returns the n-th point
+     * [SFA/OGC]Returns the n-th triangle
      * @deprecated see geometryN()
+     * @warning switches to a triangle soup (see isIndexed())
      */
     inline Triangle&          triangleN( size_t const& n ) {
-        BOOST_ASSERT( n < _triangles.size() );
-        return _triangles[n];
+        BOOST_ASSERT( n < numTriangles() );
+        return geometryN( n );
     }
     /**
     * add a Triangle to the TriangulatedSurface
     */
-    inline void               addTriangle( const Triangle& triangle ) {
-        addTriangle( triangle.clone() );
-    }
+    void                      addTriangle( const Triangle& triangle ) ;
     /**
-    * add a Triangle to the TriangulatedSurface
+    * add a Triangle to the TriangulatedSurface (takes ownership)
     */
-    inline void               addTriangle( Triangle* triangle ) {
-        _triangles.push_back( triangle );
-    }
+    void                      addTriangle( Triangle* triangle ) ;
     /**
      * add triangles from an other TriangulatedSurface
      */
     void                      addTriangles( const TriangulatedSurface& other ) ;
+    /**
+     * Releases the ownership of the triangles to the caller (appended to triangles),
+     * leaving the TriangulatedSurface empty
+     */
+    void                      releaseTriangles( boost::ptr_vector< Triangle >& triangles ) ;
+
+
+    //-- indexed mesh
+
+    /**
+     * Returns true if the TriangulatedSurface is stored as an indexed mesh,
+     * false if it has been switched to a triangle soup
+     */
+    inline bool               isIndexed() const {
+        return _indexed ;
+    }
+    /**
+     * Returns the number of vertices (three per triangle for a triangle soup)
+     */
+    inline size_t             numVertices() const {
+        return _indexed ? _vertices.size() : 3 * _triangles.size() ;
+    }
+    /**
+     * Returns the n-th vertex
+     */
+    inline const Point&       vertexN( size_t const& n ) const {
+        BOOST_ASSERT( n < numVertices() );
+        return _indexed ? _vertices[n] : _triangles[ n / 3 ].vertex( n % 3 ) ;
+    }
+    /**
+     * Returns the n-th vertex (modifying a vertex modifies every triangle sharing it)
+     * @warning invalidates the triangles returned by the const geometryN() of an indexed mesh
+     */
+    Point&                    vertexN( size_t const& n ) ;
+    /**
+     * Returns the index of the i-th vertex of the n-th triangle
+     */
+    inline size_t             vertexIndex( size_t const& n, size_t const& i ) const {
+        BOOST_ASSERT( n < numTriangles() && i < 3 );
+        return _indexed ? _indices[ 3 * n + i ] : 3 * n + i ;
+    }
+    /**
+     * Returns the i-th vertex of the n-th triangle
+     */
+    inline const Point&       triangleVertex( size_t const& n, size_t const& i ) const {
+        return vertexN( vertexIndex( n, i ) );
+    }
+    /**
+     * add a vertex to the vertex buffer and returns its index
+     * @pre isIndexed()
+     */
+    size_t                    addVertex( const Point& p ) ;
+    /**
+     * add a triangle given by the indices of its vertices
+     * @pre isIndexed() and a, b, c < numVertices()
+     */
+    void                      addTriangle( const size_t& a, const size_t& b, const size_t& c ) ;
+    /**
+     * reverse the orientation of the n-th triangle (see Triangle::reverse())
+     */
+    void                      reverseTriangle( const size_t& n ) ;
+    /**
+     * Merges equal vertices (same coordinates and same m), so that triangles sharing a vertex
+     * share its index (no effect on a triangle soup)
+     */
+    void                      weldVertices() ;
+    /**
+     * Returns the number of triangles in the read-only cache of an indexed mesh
+     * (see geometryN() const)
+     */
+    inline size_t             numCachedTriangles() const {
+        return _indexed ? _numCachedTriangles.load( boost::memory_order_acquire ) : 0 ;
+    }
+    /**
+     * Frees the read-only cache of triangles of an indexed mesh
+     * @warning invalidates the triangles returned by the const geometryN() and iterators
+     */
+    void                      clearTriangleCache() ;
+    /**
+     * Fills neighbours with the triangle sharing the edge (i, i+1) of the n-th triangle
+     * at 3 * n + i, or NO_NEIGHBOUR on a border. Triangles are neighbours when they share
+     * the two vertex indices of an edge (see weldVertices()).
+     */
+    void                      computeNeighbours( std::vector< size_t >& neighbours ) const ;
 
 
     //-- SFCGAL::Geometry
     virtual size_t               numGeometries() const ;
     //-- SFCGAL::Geometry
     virtual const Triangle&     geometryN( size_t const& n ) const ;
-    //-- SFCGAL::Geometry
+    /**
+     * Returns the n-th triangle
+     * @warning switches to a triangle soup (see isIndexed())
+     */
     virtual Triangle&            geometryN( size_t const& n ) ;
 
 
@@ -143,17 +313,27 @@ public:
 
     //-- iterators
 
+    /**
+     * @warning switches to a triangle soup (see isIndexed())
+     */
     inline iterator       begin() {
+        _toTriangleSoup();
         return _triangles.begin() ;
     }
     inline const_iterator begin() const {
+        _buildTriangles();
         return _triangles.begin() ;
     }
 
+    /**
+     * @warning switches to a triangle soup (see isIndexed())
+     */
     inline iterator       end() {
+        _toTriangleSoup();
         return _triangles.end() ;
     }
     inline const_iterator end() const {
+        _buildTriangles();
         return _triangles.end() ;
     }
 
@@ -174,20 +354,85 @@ public:
     std::auto_ptr<Polyhedron> toPolyhedron_3() const;
 
     /**
-     * Serializer
+     * Serializer (saved as an indexed mesh)
      */
     template <class Archive>
-    void serialize( Archive& ar, const unsigned int /*version*/ ) {
+    void save( Archive& ar, const unsigned int /*version*/ ) const {
         ar& boost::serialization::base_object<Geometry>( *this );
-        ar& _triangles;
+
+        if ( _indexed ) {
+            ar& _vertices;
+            ar& _indices;
+        }
+        else {
+            std::vector< Point > vertices ;
+            std::vector< size_t > indices ;
+
+            for ( size_t i = 0; i < numVertices(); i++ ) {
+                vertices.push_back( vertexN( i ) );
+                indices.push_back( i );
+            }
+
+            ar& vertices;
+            ar& indices;
+        }
+    }
+    /**
+     * Unserializer
+     */
+    template <class Archive>
+    void load( Archive& ar, const unsigned int /*version*/ ) {
+        ar& boost::serialization::base_object<Geometry>( *this );
+        _triangles.clear();
+        _numCachedTriangles.store( 0, boost::memory_order_relaxed );
+        _indexed = true ;
+        ar& _vertices;
+        ar& _indices;
     }
+    BOOST_SERIALIZATION_SPLIT_MEMBER()
 private:
-    boost::ptr_vector< Triangle > _triangles ;
+    /**
+     * shared vertices (indexed mesh)
+     */
+    std::vector< Point > _vertices ;
+    /**
+     * three indices in _vertices per triangle (indexed mesh)
+     */
+    std::vector< size_t > _indices ;
+    /**
+     * triangle soup, or read-only cache of the triangles of the indexed mesh (empty or complete)
+     */
+    mutable boost::ptr_vector< Triangle > _triangles ;
+    /**
+     * number of triangles in the read-only cache of an indexed mesh, published once they
+     * are built (lock-free test of a complete cache)
+     */
+    mutable boost::atomic< size_t > _numCachedTriangles ;
+    /**
+     * true when the mesh is the storage, false for a triangle soup
+     */
+    bool _indexed ;
+
+    /**
+     * builds the read-only cache of triangles of the indexed mesh (under a mutex shared
+     * with other TriangulatedSurfaces, see TriangulatedSurface.cpp)
+     */
+    void _buildTriangles() const ;
+    /**
+     * switches to a triangle soup
+     */
+    void _toTriangleSoup() ;
 
     void swap( TriangulatedSurface& other ) {
-        std::swap( _triangles, other._triangles );
+        _vertices.swap( other._vertices );
+        _indices.swap( other._indices );
+        _triangles.swap( other._triangles );
+        const size_t numCachedTriangles = _numCachedTriangles.load();
+        _numCachedTriangles.store( other._numCachedTriangles.load() );
+        other._numCachedTriangles.store( numCachedTriangles );
+        std::swap( _indexed, other._indexed );
     }
 };
-}
+SFCGAL_END_NAMESPACE
 
 #endif
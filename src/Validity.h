@@ -22,7 +22,9 @@
 #ifndef _SFCGAL_VALIDITY_H_
 #define _SFCGAL_VALIDITY_H_
 
-namespace SFCGAL {
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * @brief the class, convertible to bool, that stores the reason why a geom is invalid
@@ -59,5 +61,5 @@ private:
     }
 };
 
-}
+SFCGAL_END_NAMESPACE
 #endif
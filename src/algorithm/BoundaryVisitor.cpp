@@ -37,7 +37,7 @@
 #include <complex>
 #include <SFCGAL/detail/ComplexComparator.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -317,5 +317,5 @@ void BoundaryVisitor::getBoundaryFromPolygons( const graph::GeometryGraph& g )
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -27,7 +27,7 @@
 #include <SFCGAL/detail/graph/GeometryGraphBuilder.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 
@@ -95,7 +95,7 @@ private:
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
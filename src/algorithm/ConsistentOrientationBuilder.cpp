@@ -21,7 +21,7 @@
 #include <SFCGAL/algorithm/ConsistentOrientationBuilder.h>
 #include <SFCGAL/detail/graph/algorithm/orientation.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -48,8 +48,8 @@ void ConsistentOrientationBuilder::addTriangle( const Triangle& triangle )
 ///
 void ConsistentOrientationBuilder::addTriangulatedSurface( const TriangulatedSurface& triangulatedSurface )
 {
-    for ( size_t i = 0; i < triangulatedSurface.numGeometries(); i++ ) {
-        addTriangle( triangulatedSurface.geometryN( i ) ) ;
+    for ( size_t i = 0; i < triangulatedSurface.numTriangles(); i++ ) {
+        addTriangle( triangulatedSurface.triangleN( i ).toTriangle() ) ;
     }
 }
 
@@ -228,5 +228,5 @@ int ConsistentOrientationBuilder::_findNextTriangle()
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -28,7 +28,7 @@
 #include <SFCGAL/detail/graph/GeometryGraph.h>
 #include <SFCGAL/detail/graph/GeometryGraphBuilder.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -108,7 +108,7 @@ private:
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -26,13 +26,14 @@
 
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/algorithm/convexPolygons.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/intersection.h>
 #include <SFCGAL/detail/triangulate/triangulateInGeometrySet.h>
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 // local function : get the number of intersection points between rings of a polygon
@@ -103,6 +104,14 @@ void intersection( const PrimitiveHandle<2>& pa, const PrimitiveHandle<2>& pb,
             return;
         }
 
+        // shortcut for convex polygons
+        detail::algorithm::ConvexVertices convex1, convex2;
+
+        if ( detail::algorithm::convexVertices( *poly1, convex1 ) && detail::algorithm::convexVertices( *poly2, convex2 ) ) {
+            detail::algorithm::intersectionConvex( convex1, convex2, output );
+            return;
+        }
+
         // CGAL::intersection does not work when the intersection is a point or a segment
         // We have to call intersection on boundaries first
 
@@ -124,6 +133,7 @@ void intersection( const PrimitiveHandle<2>& pa, const PrimitiveHandle<2>& pb,
         }
 
         // now call on polygon's interiors
+        requireExactConstructions( "polygon intersection" );
         CGAL::intersection( *poly1,
                             *poly2,
                             std::back_inserter( output.surfaces() ) );
@@ -161,4 +171,4 @@ void intersection( const PrimitiveHandle<2>& pa, const PrimitiveHandle<2>& pb,
     }
 }
 } // algorithm
-} // SFCGAL
+SFCGAL_END_NAMESPACE
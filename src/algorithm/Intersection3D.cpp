@@ -36,7 +36,7 @@
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 void _intersection_solid_segment( const PrimitiveHandle<3>& pa, const PrimitiveHandle<3>& pb, GeometrySet<3>& output )
@@ -273,6 +273,7 @@ void _intersection_solid_solid( const MarkedPolyhedron& pa, const MarkedPolyhedr
 
     // 2. find intersections in volumes
     {
+        requireExactConstructions( "volume intersection" );
         typedef CGAL::Polyhedron_corefinement<MarkedPolyhedron> Corefinement;
         MarkedPolyhedron& polya = const_cast<MarkedPolyhedron&>( pa );
         MarkedPolyhedron& polyb = const_cast<MarkedPolyhedron&>( pb );
@@ -347,4 +348,4 @@ void intersection( const PrimitiveHandle<3>& pa, const PrimitiveHandle<3>& pb,
 }
 
 } // algorithm
-} // SFCGAL
+SFCGAL_END_NAMESPACE
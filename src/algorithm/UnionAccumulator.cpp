@@ -0,0 +1,225 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/UnionAccumulator.h>
+#include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/differencePrimitives.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/snapRound.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/detail/GeometrySet.h>
+
+#include <CGAL/Polygon_set_2.h>
+
+#include <vector>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+
+//
+// union of the batches [begin,end) (not empty range) through a balanced binary tree : each
+// primitive goes through O(log n) unions, instead of one union per add
+template <int Dim>
+void unionBatches( const std::vector< detail::GeometrySet<Dim> >& batches, size_t begin, size_t end, detail::GeometrySet<Dim>& output )
+{
+    if ( end - begin == 1 ) {
+        output = batches[begin] ;
+        return ;
+    }
+
+    if ( end - begin == 2 ) {
+        union_( batches[begin], batches[begin + 1], output );
+        return ;
+    }
+
+    const size_t middle = begin + ( end - begin ) / 2 ;
+    detail::GeometrySet<Dim> left, right ;
+    unionBatches( batches, begin, middle, left );
+    unionBatches( batches, middle, end, right );
+    union_( left, right, output );
+}
+
+//
+// union of all the batches (empty if there is none)
+template <int Dim>
+void unionBatches( const std::vector< detail::GeometrySet<Dim> >& batches, detail::GeometrySet<Dim>& output )
+{
+    if ( ! batches.empty() ) {
+        unionBatches( batches, 0, batches.size(), output );
+    }
+}
+
+}
+
+///
+/// 2D surfaces, and the primitives added since the last finish()
+///
+struct UnionAccumulator::Impl {
+    // 2D surfaces
+    CGAL::Polygon_set_2< Kernel > polygons ;
+    // 2D points and segments, one batch per add
+    std::vector< detail::GeometrySet<2> > batches ;
+    // 3D primitives, one batch per add
+    std::vector< detail::GeometrySet<3> > batches3D ;
+};
+
+///
+///
+///
+UnionAccumulator::UnionAccumulator( bool is3D ):
+    _is3D( is3D ),
+    _impl( new Impl )
+{
+}
+
+///
+///
+///
+UnionAccumulator::~UnionAccumulator()
+{
+}
+
+///
+///
+///
+void UnionAccumulator::add( const Geometry& g )
+{
+    if ( _is3D ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+    }
+    else {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+    }
+
+    add( g, NoValidityCheck() );
+}
+
+///
+///
+///
+void UnionAccumulator::add( const Geometry& g, NoValidityCheck )
+{
+    if ( g.isEmpty() ) {
+        return ;
+    }
+
+    if ( _is3D ) {
+        _impl->batches3D.push_back( detail::GeometrySet<3>() );
+        _impl->batches3D.back().addGeometry( g );
+        return ;
+    }
+
+    detail::GeometrySet<2> primitives( g );
+
+    // the surfaces are joined in the polygon set, the other primitives are merged by finish()
+    if ( ! primitives.surfaces().empty() ) {
+        requireExactConstructions( "polygon union" );
+    }
+
+    for ( detail::GeometrySet<2>::SurfaceCollection::const_iterator it = primitives.surfaces().begin();
+            it != primitives.surfaces().end(); ++it ) {
+        _impl->polygons.join( fix_sfs_valid_polygon( it->primitive() ) );
+    }
+
+    primitives.surfaces().clear();
+
+    if ( primitives.dimension() != -1 ) {
+        _impl->batches.push_back( primitives );
+    }
+}
+
+///
+///
+///
+void UnionAccumulator::merge( const UnionAccumulator& other )
+{
+    if ( _is3D != other._is3D ) {
+        BOOST_THROW_EXCEPTION( Exception( "UnionAccumulator::merge() : the accumulators are not of the same dimension" ) );
+    }
+
+    if ( _is3D ) {
+        _impl->batches3D.insert( _impl->batches3D.end(), other._impl->batches3D.begin(), other._impl->batches3D.end() );
+        return ;
+    }
+
+    _impl->polygons.join( other._impl->polygons );
+    _impl->batches.insert( _impl->batches.end(), other._impl->batches.begin(), other._impl->batches.end() );
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > UnionAccumulator::finish()
+{
+    std::auto_ptr< Geometry > result ;
+
+    if ( _is3D ) {
+        detail::GeometrySet<3> primitives ;
+        unionBatches( _impl->batches3D, primitives );
+        result = primitives.recompose();
+        _impl->batches3D.clear();
+    }
+    else {
+        detail::GeometrySet<2> primitives ;
+        unionBatches( _impl->batches, primitives );
+
+        // the points and segments on the surfaces are removed by a last union_
+        std::vector< PolygonWH_2 > polygons ;
+        _impl->polygons.polygons_with_holes( std::back_inserter( polygons ) );
+
+        detail::GeometrySet<2> surfaces ;
+
+        for ( std::vector< PolygonWH_2 >::const_iterator it = polygons.begin(); it != polygons.end(); ++it ) {
+            fix_cgal_valid_polygon( *it, std::back_inserter( surfaces.surfaces() ) );
+        }
+
+        if ( primitives.dimension() == -1 ) {
+            result = surfaces.recompose();
+        }
+        else {
+            detail::GeometrySet<2> output ;
+            union_( primitives, surfaces, output );
+            result = output.recompose();
+        }
+
+        _impl->polygons.clear();
+        _impl->batches.clear();
+    }
+
+    applyResultPrecision( *result );
+    return result ;
+}
+
+///
+///
+///
+bool UnionAccumulator::isEmpty() const
+{
+    if ( _is3D ) {
+        return _impl->batches3D.empty() ;
+    }
+
+    return _impl->polygons.is_empty() && _impl->batches.empty() ;
+}
+
+}//algorithm
+SFCGAL_END_NAMESPACE
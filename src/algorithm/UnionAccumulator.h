@@ -0,0 +1,105 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_UNIONACCUMULATOR_H_
+#define _SFCGAL_ALGORITHM_UNIONACCUMULATOR_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Geometry.h>
+
+#include <boost/scoped_ptr.hpp>
+
+#include <memory>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * Incremental union of a stream of geometries (streaming dissolve).
+ *
+ * The geometries are decomposed when they are added, but the union is only recomposed
+ * by finish() : in 2D, the surfaces are joined in a CGAL::Polygon_set_2 ; the points and
+ * segments (and all the primitives in 3D) are kept as added, they are merged by a balanced
+ * tree of unions in finish().
+ *
+ * Accumulators filled in parallel (one per thread) can be merged.
+ *
+ * @ingroup public_api
+ */
+class SFCGAL_API UnionAccumulator {
+public:
+    /**
+     * empty accumulator, for union_ (2D) or union3D (3D, assume z = 0 if needed)
+     */
+    explicit UnionAccumulator( bool is3D = false ) ;
+    /**
+     * destructor
+     */
+    ~UnionAccumulator() ;
+
+    /**
+     * adds g to the union
+     * @pre g is a valid geometry
+     */
+    void add( const Geometry& g ) ;
+    /**
+     * adds g to the union. No validity check variant
+     * @pre g is a valid geometry
+     * @warning No actual validity check is done.
+     */
+    void add( const Geometry& g, NoValidityCheck ) ;
+
+    /**
+     * adds the content of another accumulator (left unchanged) to the union
+     * @throw SFCGAL::Exception if the accumulators are not of the same dimension
+     */
+    void merge( const UnionAccumulator& other ) ;
+
+    /**
+     * returns the union of the added geometries and clears the accumulator
+     */
+    std::auto_ptr< Geometry > finish() ;
+
+    /**
+     * true for a 3D union
+     */
+    inline bool is3D() const {
+        return _is3D ;
+    }
+
+    /**
+     * true if nothing was added since the construction (or the last finish())
+     */
+    bool isEmpty() const ;
+
+private:
+    // the polygon set and the primitives (keeps CGAL out of this header)
+    struct Impl ;
+
+    bool _is3D ;
+    boost::scoped_ptr< Impl > _impl ;
+};
+
+}//algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
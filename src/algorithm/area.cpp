@@ -43,7 +43,7 @@
 #include <SFCGAL/Exception.h>
 #include <boost/format.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 typedef CGAL::Point_2< SFCGAL::Kernel >    Point_2 ;
@@ -170,7 +170,7 @@ double area( const TriangulatedSurface& g )
     double result = 0.0 ;
 
     for ( size_t i = 0; i < g.numTriangles(); i++ ) {
-        result += area( g.triangleN( i ) ) ;
+        result += CGAL::to_double( CGAL::abs( g.triangleN( i ).toTriangle_2().area() ) ) ;
     }
 
     return result ;
@@ -343,10 +343,27 @@ double area3D( const PolyhedralSurface& g )
 ///
 double area3D( const TriangulatedSurface& g )
 {
+    // each (shared) vertex is converted once
+    std::vector< CGAL::Point_3< Kernel > > points ;
+    points.reserve( g.numVertices() );
+
+    for ( size_t i = 0; i < g.numVertices(); i++ ) {
+        points.push_back( g.vertexN( i ).toPoint_3() );
+    }
+
     double result = 0.0 ;
 
-    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        result += area3D( g.geometryN( i ) ) ;
+    for ( size_t i = 0; i < g.numTriangles(); i++ ) {
+        if ( g.triangleN( i ).isEmpty() ) {
+            continue ;
+        }
+
+        CGAL::Triangle_3< Kernel > triangle(
+            points[ g.vertexIndex( i, 0 ) ],
+            points[ g.vertexIndex( i, 1 ) ],
+            points[ g.vertexIndex( i, 2 ) ]
+        );
+        result += sqrt( CGAL::to_double( triangle.squared_area() ) ) ;
     }
 
     return result ;
@@ -354,6 +371,6 @@ double area3D( const TriangulatedSurface& g )
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
@@ -24,7 +24,7 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -136,7 +136,7 @@ SFCGAL_API double         area3D( const TriangulatedSurface& g ) ;
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -0,0 +1,258 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/algorithm/batch.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/FilterStatistics.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/detail/parallelFor.h>
+#include <SFCGAL/detail/deepCopy.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
+using namespace SFCGAL::detail;
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+
+//
+// the probe, decomposed once and shared by the tests against the candidates
+struct Probe : boost::noncopyable {
+    explicit Probe( const Geometry& g ):
+        geometry( g ),
+        envelope( g.envelope() ),
+        geometrySet( g ) {
+    }
+
+    const Geometry& geometry ;
+    const Envelope envelope ;
+    const PreparedGeometrySet<2> geometrySet ;
+};
+
+//
+// the probe decomposed once per thread : the threads can't share the lazy exact numbers
+// of the decomposition, nor the exact coordinates of the probe (deep copies)
+class ThreadProbes : boost::noncopyable {
+public:
+    ThreadProbes( const Geometry& probe, const size_t& numThreads ):
+        _geometries( numThreads, &probe ),
+        _probes( numThreads ) {
+        if ( numThreads > 1 && sharesLazyExact( probe ) ) {
+            for ( size_t t = 1; t < numThreads; t++ ) {
+                _copies.push_back( deepClone( probe ).release() );
+                _geometries[t] = &_copies.back();
+            }
+        }
+    }
+
+    // the probe of the t-th thread, decomposed by this thread on its first call
+    const Probe& probe( const size_t& t ) {
+        if ( ! _probes[t] ) {
+            _probes[t].reset( new Probe( *_geometries[t] ) );
+        }
+
+        return *_probes[t] ;
+    }
+
+private:
+    boost::ptr_vector< Geometry > _copies ;
+    std::vector< const Geometry* > _geometries ;
+    std::vector< boost::shared_ptr< Probe > > _probes ;
+};
+
+// true if the 2D envelopes overlap (false if one of them is empty)
+bool overlaps2D( const Envelope& a, const Envelope& b )
+{
+    if ( a.isEmpty() || b.isEmpty() ) {
+        return false;
+    }
+
+    return CGAL::do_overlap( a.toBbox_2(), b.toBbox_2() );
+}
+
+// true if the 2D envelope a contains b (false if one of them is empty)
+bool contains2D( const Envelope& a, const Envelope& b )
+{
+    if ( a.isEmpty() || b.isEmpty() ) {
+        return false;
+    }
+
+    return b.xMin() >= a.xMin() &&
+           b.xMax() <= a.xMax() &&
+           b.yMin() >= a.yMin() &&
+           b.yMax() <= a.yMax();
+}
+
+//
+// Note : envelopes are rounded with to_double, which preserves the order of the bounds :
+// rejections based on envelopes are exact.
+
+struct IntersectsTest {
+    // std::vector< bool > elements can't be written by concurrent threads
+    typedef char result_type ;
+
+    result_type operator()( const Probe& probe, const Geometry& candidate ) const {
+        if ( ! overlaps2D( probe.envelope, candidate.envelope() ) ) {
+            return false;
+        }
+
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( candidate );
+
+        SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
+        const PreparedGeometrySet<2> gsb( candidate );
+        return intersects( probe.geometrySet, gsb );
+    }
+};
+
+struct CoversTest {
+    typedef char result_type ;
+
+    result_type operator()( const Probe& probe, const Geometry& candidate ) const {
+        // empty geometries are neither covered, nor covering (see covers)
+        if ( ! contains2D( probe.envelope, candidate.envelope() ) ) {
+            return false;
+        }
+
+        SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
+        const PreparedGeometrySet<2> gsb( candidate );
+        return covers( probe.geometrySet, gsb );
+    }
+};
+
+struct DistanceTest {
+    typedef double result_type ;
+
+    result_type operator()( const Probe& probe, const Geometry& candidate ) const {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( candidate );
+
+        if ( overlaps2D( probe.envelope, candidate.envelope() ) ) {
+            const PreparedGeometrySet<2> gsb( candidate );
+
+            if ( intersects( probe.geometrySet, gsb ) ) {
+                return 0.0;
+            }
+        }
+
+        return distance( probe.geometry, candidate, NoValidityCheck() );
+    }
+};
+
+//
+// evaluates the i-th candidate in the t-th thread
+template < typename Test >
+struct EvaluateCandidate {
+    EvaluateCandidate(
+        ThreadProbes& probes,
+        const std::vector< const Geometry* >& candidates,
+        std::vector< typename Test::result_type >& results
+    ):
+        _probes( probes ),
+        _candidates( candidates ),
+        _results( results ) {
+    }
+
+    void operator()( const size_t& i, const size_t& t ) const {
+        BOOST_ASSERT( _candidates[i] != NULL );
+        _results[i] = Test()( _probes.probe( t ), *_candidates[i] );
+    }
+
+private:
+    ThreadProbes& _probes ;
+    const std::vector< const Geometry* >& _candidates ;
+    std::vector< typename Test::result_type >& _results ;
+};
+
+template < typename Test >
+void evaluate(
+    const Geometry& probe,
+    const std::vector< const Geometry* >& candidates,
+    std::vector< typename Test::result_type >& results,
+    const size_t& numThreads
+)
+{
+    // refuses numThreads != 1 without thread support
+    const ExecutionPolicy policy( numThreads, 2 );
+    const size_t threads = policy.threadsFor( candidates.size() );
+
+    // a candidate with exact coordinates would share them between threads, it is copied
+    std::vector< const Geometry* > threadCandidates( candidates );
+    boost::ptr_vector< Geometry > copies ;
+
+    for ( size_t i = 0; threads > 1 && i < candidates.size(); i++ ) {
+        if ( candidates[i] != NULL && sharesLazyExact( *candidates[i] ) ) {
+            copies.push_back( deepClone( *candidates[i] ).release() );
+            threadCandidates[i] = &copies.back();
+        }
+    }
+
+    ThreadProbes probes( probe, threads );
+
+    results.assign( candidates.size(), typename Test::result_type() );
+    parallelForThreads( candidates.size(), EvaluateCandidate< Test >( probes, threadCandidates, results ), threads );
+}
+
+}
+
+///
+///
+///
+void intersectsMany( const Geometry& probe, const std::vector< const Geometry* >& candidates, std::vector< bool >& out, size_t numThreads )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( probe );
+
+    std::vector< char > results ;
+    evaluate< IntersectsTest >( probe, candidates, results, numThreads );
+    out.assign( results.begin(), results.end() );
+}
+
+///
+///
+///
+void coversMany( const Geometry& probe, const std::vector< const Geometry* >& candidates, std::vector< bool >& out, size_t numThreads )
+{
+    std::vector< char > results ;
+    evaluate< CoversTest >( probe, candidates, results, numThreads );
+    out.assign( results.begin(), results.end() );
+}
+
+///
+///
+///
+void distanceMany( const Geometry& probe, const std::vector< const Geometry* >& candidates, std::vector< double >& out, size_t numThreads )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( probe );
+
+    evaluate< DistanceTest >( probe, candidates, out, numThreads );
+}
+
+}//namespace algorithm
+SFCGAL_END_NAMESPACE
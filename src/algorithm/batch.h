@@ -0,0 +1,83 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_BATCH_H_
+#define _SFCGAL_ALGORITHM_BATCH_H_
+
+#include <SFCGAL/config.h>
+
+#include <vector>
+#include <cstddef>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+/**
+ * @brief Robust intersection tests of a probe geometry against a list of candidates.
+ * Force projection to z=0 if needed.
+ *
+ * The probe is checked for validity and decomposed once. Candidates whose envelope doesn't
+ * overlap the envelope of the probe are rejected without being checked for validity or decomposed.
+ *
+ * @param probe the geometry tested against each candidate
+ * @param candidates the tested geometries (not NULL)
+ * @param out receives intersects( probe, *candidates[i] ) in out[i]
+ * @param numThreads number of threads sharing the tests (0 for one thread per core)
+ * @pre probe and the candidates are valid geometries
+ * @throw NotImplementedException if numThreads != 1 and CGAL is built without thread support (see ExecutionPolicy)
+ * @warning the candidates must not be modified by other threads during the call
+ * @ingroup public_api
+ */
+SFCGAL_API void intersectsMany( const Geometry& probe, const std::vector< const Geometry* >& candidates, std::vector< bool >& out, size_t numThreads = 1 );
+
+/**
+ * @brief Cover tests of a probe geometry against a list of candidates.
+ * Checks if the probe covers each candidate. Force projection to z=0 if needed.
+ *
+ * The probe is decomposed once. Candidates whose envelope is not contained in the envelope
+ * of the probe are rejected without being decomposed.
+ *
+ * @param out receives covers( probe, *candidates[i] ) in out[i]
+ * @see intersectsMany for the other parameters
+ * @ingroup public_api
+ */
+SFCGAL_API void coversMany( const Geometry& probe, const std::vector< const Geometry* >& candidates, std::vector< bool >& out, size_t numThreads = 1 );
+
+/**
+ * @brief Distances between a probe geometry and a list of candidates.
+ *
+ * The probe is checked for validity and decomposed once. Candidates whose envelope overlaps
+ * the envelope of the probe are first tested for intersection with the decomposed probe,
+ * the distance is only computed if they don't intersect.
+ *
+ * @param out receives distance( probe, *candidates[i] ) in out[i]
+ * @see intersectsMany for the other parameters
+ * @ingroup public_api
+ */
+SFCGAL_API void distanceMany( const Geometry& probe, const std::vector< const Geometry* >& candidates, std::vector< double >& out, size_t numThreads = 1 );
+
+}//namespace algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
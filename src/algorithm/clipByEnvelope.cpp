@@ -0,0 +1,750 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/algorithm/clipByEnvelope.h>
+
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/MultiPoint.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/isValid.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+
+typedef std::vector< Point > PointVector ;
+
+//
+// axis-aligned box with exact bounds, on the 2 (x,y) or 3 axes
+struct ClipBox {
+    ClipBox( const Envelope& envelope_, const int& numAxes_ ):
+        envelope( envelope_ ),
+        numAxes( numAxes_ ) {
+        lo[0] = envelope.xMin();
+        hi[0] = envelope.xMax();
+        lo[1] = envelope.yMin();
+        hi[1] = envelope.yMax();
+
+        if ( numAxes == 3 ) {
+            lo[2] = envelope.zMin();
+            hi[2] = envelope.zMax();
+        }
+    }
+
+    Envelope envelope ;
+    int numAxes ;
+    Kernel::FT lo[3] ;
+    Kernel::FT hi[3] ;
+};
+
+// coordinate of a point on an axis (z = 0 for 2D points)
+inline Kernel::FT coordinate( const Point& p, const int& axis )
+{
+    switch ( axis ) {
+    case 0:
+        return p.x();
+
+    case 1:
+        return p.y();
+
+    default:
+        return p.z();
+    }
+}
+
+// true if p and q have the same coordinates on the clipped axes
+bool samePosition( const Point& p, const Point& q, const int& numAxes )
+{
+    for ( int axis = 0; axis < numAxes; axis++ ) {
+        if ( coordinate( p, axis ) != coordinate( q, axis ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// point of [p,q] at the parameter t, p and q are returned as is for t = 0 and t = 1
+// (z is interpolated when p and q have a z, measures are not)
+Point interpolate( const Point& p, const Point& q, const Kernel::FT& t )
+{
+    if ( t == 0 ) {
+        return p;
+    }
+
+    if ( t == 1 ) {
+        return q;
+    }
+
+    const Kernel::FT x = p.x() + t * ( q.x() - p.x() );
+    const Kernel::FT y = p.y() + t * ( q.y() - p.y() );
+
+    if ( p.is3D() && q.is3D() ) {
+        return Point( x, y, p.z() + t * ( q.z() - p.z() ) );
+    }
+
+    return Point( x, y );
+}
+
+//
+// Liang-Barsky : the part of [p,q] in the box is [t0,t1] (false if [p,q] doesn't intersect the box)
+bool clipSegment( const Point& p, const Point& q, const ClipBox& box, Kernel::FT& t0, Kernel::FT& t1 )
+{
+    t0 = 0 ;
+    t1 = 1 ;
+
+    for ( int axis = 0; axis < box.numAxes; axis++ ) {
+        const Kernel::FT a = coordinate( p, axis );
+        const Kernel::FT d = coordinate( q, axis ) - a ;
+
+        if ( d == 0 ) {
+            if ( a < box.lo[axis] || a > box.hi[axis] ) {
+                return false;
+            }
+
+            continue;
+        }
+
+        Kernel::FT tlo = ( box.lo[axis] - a ) / d ;
+        Kernel::FT thi = ( box.hi[axis] - a ) / d ;
+
+        if ( d < 0 ) {
+            std::swap( tlo, thi );
+        }
+
+        if ( tlo > t0 ) {
+            t0 = tlo ;
+        }
+
+        if ( thi < t1 ) {
+            t1 = thi ;
+        }
+
+        if ( t0 > t1 ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+enum RingClipResult {
+    RING_INSIDE,
+    RING_OUTSIDE,
+    RING_CLIPPED,
+    // the ring leaves and reenters the half-space, Sutherland-Hodgman would create degenerate edges
+    RING_UNSUPPORTED
+};
+
+//
+// Sutherland-Hodgman step : clips an open ring by the half-space coordinate(axis) >= bound
+// (or <= bound if ! isMin)
+RingClipResult clipRing( PointVector& ring, const int& axis, const Kernel::FT& bound, const bool& isMin, const int& numAxes )
+{
+    const size_t n = ring.size();
+    std::vector< char > inside( n );
+    size_t numInside = 0 ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const Kernel::FT c = coordinate( ring[i], axis );
+        inside[i] = isMin ? ( c >= bound ) : ( c <= bound );
+        numInside += inside[i] ? 1 : 0 ;
+    }
+
+    if ( numInside == n ) {
+        return RING_INSIDE;
+    }
+
+    if ( numInside == 0 ) {
+        return RING_OUTSIDE;
+    }
+
+    size_t numExits = 0 ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        if ( inside[i] && ! inside[ ( i + 1 ) % n ] ) {
+            numExits++ ;
+        }
+    }
+
+    if ( numExits > 1 ) {
+        return RING_UNSUPPORTED;
+    }
+
+    PointVector clipped ;
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const size_t j = ( i + 1 ) % n ;
+        const Point& s = ring[i] ;
+        const Point& e = ring[j] ;
+
+        if ( inside[i] != inside[j] ) {
+            const Kernel::FT cs = coordinate( s, axis );
+            clipped.push_back( interpolate( s, e, ( bound - cs ) / ( coordinate( e, axis ) - cs ) ) );
+        }
+
+        if ( inside[j] ) {
+            clipped.push_back( e );
+        }
+    }
+
+    // removes the repeated points (a vertex on the bound is also an intersection)
+    ring.clear();
+
+    for ( size_t i = 0; i < clipped.size(); i++ ) {
+        if ( ring.empty() || ! samePosition( ring.back(), clipped[i], numAxes ) ) {
+            ring.push_back( clipped[i] );
+        }
+    }
+
+    while ( ring.size() > 1 && samePosition( ring.front(), ring.back(), numAxes ) ) {
+        ring.pop_back();
+    }
+
+    return RING_CLIPPED;
+}
+
+// true if the points of the ring are aligned (on the clipped axes)
+bool isDegenerate( const PointVector& ring, const int& numAxes )
+{
+    if ( ring.size() < 3 ) {
+        return true;
+    }
+
+    for ( size_t i = 2; i < ring.size(); i++ ) {
+        if ( numAxes == 2 ) {
+            if ( ! CGAL::collinear( ring[0].toPoint_2(), ring[1].toPoint_2(), ring[i].toPoint_2() ) ) {
+                return false;
+            }
+        }
+        else if ( ! CGAL::collinear( ring[0].toPoint_3(), ring[1].toPoint_3(), ring[i].toPoint_3() ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+enum RingPosition {
+    // in the interior of the box
+    RING_IN_INTERIOR,
+    // the interior of the ring doesn't intersect the box
+    RING_IN_EXTERIOR,
+    RING_ON_BOUNDARY
+};
+
+// position of a hole, from its vertices
+RingPosition ringPosition( const LineString& ring, const ClipBox& box )
+{
+    bool inInterior = true ;
+
+    for ( int axis = 0; axis < box.numAxes; axis++ ) {
+        bool belowMin = true ;
+        bool aboveMax = true ;
+
+        for ( size_t i = 0; i < ring.numPoints(); i++ ) {
+            const Kernel::FT c = coordinate( ring.pointN( i ), axis );
+            inInterior = inInterior && c > box.lo[axis] && c < box.hi[axis] ;
+            belowMin = belowMin && c <= box.lo[axis] ;
+            aboveMax = aboveMax && c >= box.hi[axis] ;
+        }
+
+        if ( belowMin || aboveMax ) {
+            return RING_IN_EXTERIOR;
+        }
+    }
+
+    return inInterior ? RING_IN_INTERIOR : RING_ON_BOUNDARY ;
+}
+
+//
+// Clips the parts of a geometry, the configurations that can't be clipped directly go through intersection
+class Clipper : boost::noncopyable {
+public:
+    explicit Clipper( const ClipBox& box ):
+        _box( box ) {
+    }
+
+    ~Clipper() {
+        for ( size_t i = 0; i < _output.size(); i++ ) {
+            delete _output[i] ;
+        }
+    }
+
+    void clip( const Geometry& g ) {
+        if ( g.isEmpty() ) {
+            return ;
+        }
+
+        const size_t numOutput = _output.size();
+        bool clipped = true ;
+
+        switch ( g.geometryTypeId() ) {
+        case TYPE_POINT:
+            clipPoint( g.as< Point >() );
+            break;
+
+        case TYPE_LINESTRING:
+            clipped = clipLineString( g.as< LineString >() );
+            break;
+
+        case TYPE_POLYGON:
+            clipped = clipPolygon( g.as< Polygon >() );
+            break;
+
+        case TYPE_TRIANGLE:
+            clipped = clipTriangle( g.as< Triangle >() );
+            break;
+
+        case TYPE_MULTIPOINT:
+        case TYPE_MULTILINESTRING:
+        case TYPE_MULTIPOLYGON:
+        case TYPE_GEOMETRYCOLLECTION:
+            for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+                clip( g.geometryN( i ) );
+            }
+
+            break;
+
+        case TYPE_POLYHEDRALSURFACE:
+        case TYPE_TRIANGULATEDSURFACE:
+        case TYPE_SOLID:
+        case TYPE_MULTISOLID:
+            clipped = false ;
+            break;
+        }
+
+        if ( ! clipped ) {
+            for ( size_t i = numOutput; i < _output.size(); i++ ) {
+                delete _output[i] ;
+            }
+
+            _output.resize( numOutput );
+            clipByIntersection( g );
+        }
+    }
+
+    // the clipped parts, assembled as GeometrySet::recompose does
+    std::auto_ptr< Geometry > result() {
+        std::vector< Geometry* > parts ;
+        parts.swap( _output );
+
+        if ( parts.empty() ) {
+            return std::auto_ptr< Geometry >( new GeometryCollection );
+        }
+
+        if ( parts.size() == 1 ) {
+            return std::auto_ptr< Geometry >( parts[0] );
+        }
+
+        std::stable_sort( parts.begin(), parts.end(), LessDimension() );
+
+        bool hasCommonType = true ;
+
+        for ( size_t i = 1; i < parts.size(); i++ ) {
+            hasCommonType = hasCommonType && parts[i]->geometryTypeId() == parts[0]->geometryTypeId() ;
+        }
+
+        std::auto_ptr< GeometryCollection > collection ;
+
+        switch ( hasCommonType ? parts[0]->geometryTypeId() : TYPE_GEOMETRYCOLLECTION ) {
+        case TYPE_POINT:
+            collection.reset( new MultiPoint );
+            break;
+
+        case TYPE_LINESTRING:
+            collection.reset( new MultiLineString );
+            break;
+
+        case TYPE_POLYGON:
+            collection.reset( new MultiPolygon );
+            break;
+
+        case TYPE_SOLID:
+            collection.reset( new MultiSolid );
+            break;
+
+        default:
+            collection.reset( new GeometryCollection );
+            break;
+        }
+
+        for ( size_t i = 0; i < parts.size(); i++ ) {
+            collection->addGeometry( parts[i] );
+        }
+
+        return std::auto_ptr< Geometry >( collection.release() );
+    }
+
+private:
+    const ClipBox& _box ;
+    std::vector< Geometry* > _output ;
+
+    struct LessDimension {
+        bool operator()( const Geometry* a, const Geometry* b ) const {
+            return a->dimension() < b->dimension();
+        }
+    };
+
+    void clipPoint( const Point& point ) {
+        for ( int axis = 0; axis < _box.numAxes; axis++ ) {
+            const Kernel::FT c = coordinate( point, axis );
+
+            if ( c < _box.lo[axis] || c > _box.hi[axis] ) {
+                return ;
+            }
+        }
+
+        _output.push_back( point.clone() );
+    }
+
+    // false if a part of the line string only touches the box
+    bool clipLineString( const LineString& line ) {
+        std::auto_ptr< LineString > current ;
+
+        for ( size_t i = 0; i + 1 < line.numPoints(); i++ ) {
+            const Point& p = line.pointN( i );
+            const Point& q = line.pointN( i + 1 );
+
+            if ( samePosition( p, q, _box.numAxes ) ) {
+                continue;
+            }
+
+            Kernel::FT t0, t1 ;
+
+            if ( ! clipSegment( p, q, _box, t0, t1 ) ) {
+                flush( current );
+                continue;
+            }
+
+            if ( t0 == t1 ) {
+                // isolated point, unless it ends the current piece
+                if ( current.get() && t0 == 0 ) {
+                    continue;
+                }
+
+                return false;
+            }
+
+            if ( ! current.get() || t0 != 0 ) {
+                flush( current );
+                current.reset( new LineString );
+                current->addPoint( interpolate( p, q, t0 ) );
+            }
+
+            current->addPoint( interpolate( p, q, t1 ) );
+
+            if ( t1 != 1 ) {
+                flush( current );
+            }
+        }
+
+        flush( current );
+        return true;
+    }
+
+    void flush( std::auto_ptr< LineString >& line ) {
+        if ( line.get() ) {
+            _output.push_back( line.release() );
+        }
+    }
+
+    // clips an open ring by the sides of the box, the ring is unchanged if it is inside
+    RingClipResult clipRingByBox( PointVector& ring ) const {
+        RingClipResult result = RING_INSIDE ;
+
+        for ( int axis = 0; axis < _box.numAxes; axis++ ) {
+            for ( int side = 0; side < 2; side++ ) {
+                switch ( clipRing( ring, axis, side == 0 ? _box.lo[axis] : _box.hi[axis], side == 0, _box.numAxes ) ) {
+                case RING_INSIDE:
+                    break;
+
+                case RING_OUTSIDE:
+                    return RING_OUTSIDE;
+
+                case RING_CLIPPED:
+                    result = RING_CLIPPED ;
+                    break;
+
+                case RING_UNSUPPORTED:
+                    return RING_UNSUPPORTED;
+                }
+            }
+        }
+
+        if ( result == RING_CLIPPED && isDegenerate( ring, _box.numAxes ) ) {
+            return RING_UNSUPPORTED;
+        }
+
+        return result;
+    }
+
+    // false if the polygon can't be clipped directly
+    bool clipPolygon( const Polygon& polygon ) {
+        const LineString& exteriorRing = polygon.exteriorRing();
+        PointVector ring( exteriorRing.begin(), exteriorRing.end() - 1 );
+
+        switch ( clipRingByBox( ring ) ) {
+        case RING_INSIDE:
+            _output.push_back( polygon.clone() );
+            return true;
+
+        case RING_OUTSIDE:
+            return true;
+
+        case RING_UNSUPPORTED:
+            return false;
+
+        case RING_CLIPPED:
+            break;
+        }
+
+        std::auto_ptr< Polygon > clipped( new Polygon( makeRing( ring ) ) );
+
+        for ( size_t i = 0; i < polygon.numInteriorRings(); i++ ) {
+            switch ( ringPosition( polygon.interiorRingN( i ), _box ) ) {
+            case RING_IN_INTERIOR:
+                clipped->addInteriorRing( polygon.interiorRingN( i ) );
+                break;
+
+            case RING_IN_EXTERIOR:
+                break;
+
+            case RING_ON_BOUNDARY:
+                return false;
+            }
+        }
+
+        _output.push_back( clipped.release() );
+        return true;
+    }
+
+    // false if the triangle can't be clipped directly
+    bool clipTriangle( const Triangle& triangle ) {
+        PointVector ring ;
+
+        for ( int i = 0; i < 3; i++ ) {
+            ring.push_back( triangle.vertex( i ) );
+        }
+
+        switch ( clipRingByBox( ring ) ) {
+        case RING_INSIDE:
+            _output.push_back( triangle.clone() );
+            return true;
+
+        case RING_OUTSIDE:
+            return true;
+
+        case RING_UNSUPPORTED:
+            return false;
+
+        case RING_CLIPPED:
+            break;
+        }
+
+        _output.push_back( new Polygon( makeRing( ring ) ) );
+        return true;
+    }
+
+    static LineString makeRing( const PointVector& ring ) {
+        LineString result ;
+        result.reserve( ring.size() + 1 );
+
+        for ( size_t i = 0; i < ring.size(); i++ ) {
+            result.addPoint( ring[i] );
+        }
+
+        result.addPoint( ring[0] );
+        return result;
+    }
+
+    void clipByIntersection( const Geometry& g ) {
+        std::auto_ptr< Geometry > result ;
+
+        if ( _box.numAxes == 2 ) {
+            result = intersection( g, *_box.envelope.toPolygon(), NoValidityCheck() );
+        }
+        else {
+            result = intersection3D( g, *_box.envelope.toSolid(), NoValidityCheck() );
+        }
+
+        if ( result->isEmpty() ) {
+            return ;
+        }
+
+        if ( ! result->is< GeometryCollection >() ) {
+            _output.push_back( result.release() );
+            return ;
+        }
+
+        for ( size_t i = 0; i < result->numGeometries(); i++ ) {
+            _output.push_back( result->geometryN( i ).clone() );
+        }
+    }
+};
+
+// checks that the envelope can be used as a clipping box
+void checkClipEnvelope( const Envelope& envelope, const int& numAxes )
+{
+    if ( numAxes == 3 && ! envelope.is3D() ) {
+        BOOST_THROW_EXCEPTION( Exception( "clipByEnvelope3D requires a 3D envelope" ) );
+    }
+
+    if ( envelope.xMin() >= envelope.xMax() || envelope.yMin() >= envelope.yMax()
+            || ( numAxes == 3 && envelope.zMin() >= envelope.zMax() ) ) {
+        BOOST_THROW_EXCEPTION( Exception( "clipByEnvelope : the envelope is collapsed" ) );
+    }
+}
+
+std::auto_ptr< Geometry > clip( const Geometry& g, const Envelope& envelope, const int& numAxes )
+{
+    if ( envelope.isEmpty() ) {
+        return std::auto_ptr< Geometry >( new GeometryCollection );
+    }
+
+    checkClipEnvelope( envelope, numAxes );
+
+    const ClipBox box( envelope, numAxes );
+    Clipper clipper( box );
+    clipper.clip( g );
+    return clipper.result();
+}
+
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > clipByEnvelope( const Geometry& g, const Envelope& envelope, NoValidityCheck )
+{
+    return clip( g, envelope, 2 );
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > clipByEnvelope( const Geometry& g, const Envelope& envelope )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+
+    return clipByEnvelope( g, envelope, NoValidityCheck() );
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > clipByEnvelope3D( const Geometry& g, const Envelope& envelope, NoValidityCheck )
+{
+    return clip( g, envelope, 3 );
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > clipByEnvelope3D( const Geometry& g, const Envelope& envelope )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+
+    return clipByEnvelope3D( g, envelope, NoValidityCheck() );
+}
+
+///
+///
+///
+ClipByGridVisitor::~ClipByGridVisitor()
+{
+
+}
+
+///
+///
+///
+void clipByGrid(
+    const Geometry& g,
+    const Envelope& extent,
+    const size_t& numColumns,
+    const size_t& numRows,
+    ClipByGridVisitor& visitor
+)
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+
+    const Envelope envelope = g.envelope();
+
+    if ( envelope.isEmpty() || extent.isEmpty() || numColumns == 0 || numRows == 0 ) {
+        return ;
+    }
+
+    checkClipEnvelope( extent, 2 );
+
+    // bounds of the tiles, shared by the neighbor tiles
+    std::vector< double > xs( numColumns + 1 ), ys( numRows + 1 );
+
+    for ( size_t i = 0; i <= numColumns; i++ ) {
+        xs[i] = i == numColumns ? extent.xMax() : extent.xMin() + ( extent.xMax() - extent.xMin() ) * i / numColumns ;
+    }
+
+    for ( size_t j = 0; j <= numRows; j++ ) {
+        ys[j] = j == numRows ? extent.yMax() : extent.yMin() + ( extent.yMax() - extent.yMin() ) * j / numRows ;
+    }
+
+    for ( size_t i = 0; i < numColumns; i++ ) {
+        if ( xs[i + 1] < envelope.xMin() || xs[i] > envelope.xMax() ) {
+            continue;
+        }
+
+        std::auto_ptr< Geometry > column( clipByEnvelope( g, Envelope( xs[i], xs[i + 1], ys[0], ys[numRows] ), NoValidityCheck() ) );
+
+        if ( column->isEmpty() ) {
+            continue;
+        }
+
+        const Envelope columnEnvelope = column->envelope();
+
+        for ( size_t j = 0; j < numRows; j++ ) {
+            if ( ys[j + 1] < columnEnvelope.yMin() || ys[j] > columnEnvelope.yMax() ) {
+                continue;
+            }
+
+            std::auto_ptr< Geometry > tile( clipByEnvelope( *column, Envelope( xs[i], xs[i + 1], ys[j], ys[j + 1] ), NoValidityCheck() ) );
+
+            if ( ! tile->isEmpty() ) {
+                visitor.visit( i, j, tile );
+            }
+        }
+    }
+}
+
+}//namespace algorithm
+SFCGAL_END_NAMESPACE
@@ -0,0 +1,119 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_CLIPBYENVELOPE_H_
+#define _SFCGAL_ALGORITHM_CLIPBYENVELOPE_H_
+
+#include <SFCGAL/config.h>
+
+#include <memory>
+#include <cstddef>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+class Envelope ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * @brief Intersection of a geometry with an axis-aligned rectangle.
+ * Force projection to z=0 if needed (the z of the vertices are kept, interpolated on the new vertices).
+ *
+ * Points, line strings and polygons are clipped directly against the sides of the rectangle
+ * (Liang-Barsky for the segments, Sutherland-Hodgman for the rings), in exact arithmetic.
+ * The configurations these clippers can't represent (a polygon leaving and reentering the
+ * rectangle, holes crossing a side, parts touching the rectangle) and the other geometry types
+ * go through intersection().
+ *
+ * The result is the same point set as intersection( g, *envelope.toPolygon() ).
+ *
+ * @pre g is a valid geometry
+ * @pre the envelope is not collapsed (xMin < xMax, yMin < yMax)
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr< Geometry > clipByEnvelope( const Geometry& g, const Envelope& envelope );
+
+/**
+ * @brief Intersection of a geometry with an axis-aligned rectangle, no validity check variant
+ * @ingroup detail
+ * @warning No actual validity check is done
+ */
+SFCGAL_API std::auto_ptr< Geometry > clipByEnvelope( const Geometry& g, const Envelope& envelope, NoValidityCheck );
+
+/**
+ * @brief Intersection of a geometry with an axis-aligned box. Assume z = 0 if needed
+ *
+ * Same as clipByEnvelope with the box envelope.toSolid() (see intersection3D).
+ *
+ * @pre g is a valid geometry
+ * @pre the envelope is 3D and not collapsed
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr< Geometry > clipByEnvelope3D( const Geometry& g, const Envelope& envelope );
+
+/**
+ * @brief Intersection of a geometry with an axis-aligned box, no validity check variant
+ * @ingroup detail
+ * @warning No actual validity check is done
+ */
+SFCGAL_API std::auto_ptr< Geometry > clipByEnvelope3D( const Geometry& g, const Envelope& envelope, NoValidityCheck );
+
+/**
+ * @brief Receives the tiles of a clipByGrid
+ */
+class SFCGAL_API ClipByGridVisitor {
+public:
+    virtual ~ClipByGridVisitor();
+
+    /**
+     * called for each non empty tile, column by column
+     * @param clipped the part of the geometry in the tile (ownership is transferred)
+     */
+    virtual void visit( const size_t& column, const size_t& row, std::auto_ptr< Geometry > clipped ) = 0 ;
+};
+
+/**
+ * @brief Clips a geometry by the tiles of a regular grid (2D, see clipByEnvelope)
+ *
+ * The geometry is checked once, clipped by the columns of the grid it overlaps, then
+ * each column strip is clipped by the rows it overlaps.
+ *
+ * @param extent the extent of the grid
+ * @param numColumns the number of tiles along x
+ * @param numRows the number of tiles along y
+ * @param visitor receives the non empty tiles
+ * @pre g is a valid geometry
+ * @ingroup public_api
+ */
+SFCGAL_API void clipByGrid(
+    const Geometry& g,
+    const Envelope& extent,
+    const size_t& numColumns,
+    const size_t& numRows,
+    ClipByGridVisitor& visitor
+);
+
+}//namespace algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -26,7 +26,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 std::auto_ptr<Geometry> collect( const Geometry& ga, const Geometry& gb )
 {
@@ -64,4 +64,4 @@ std::auto_ptr<Geometry> collect( const Geometry& ga, const Geometry& gb )
     return std::auto_ptr<Geometry>( coll );
 }
 }
-}
+SFCGAL_END_NAMESPACE
@@ -26,7 +26,7 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 /**
  * Returns an aggregate of ga and gb
@@ -52,6 +52,6 @@ std::auto_ptr<Geometry> collect( GeometryIterator begin, GeometryIterator end )
     return std::auto_ptr<Geometry>( coll );
 }
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -25,10 +25,11 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/TriangulatedSurface.h>
 
 #include <SFCGAL/detail/transform/ForceZ.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 // Use of auto_ptr :
@@ -53,7 +54,7 @@ std::auto_ptr<Geometry> collectionExtractPolygons( std::auto_ptr<Geometry> g )
     // copy each geometry
     for ( size_t i = 0; i < coll.numGeometries(); ++i ) {
 
-        Geometry* gi = coll.geometryN( i ).clone();
+        const Geometry* gi = &coll.geometryN( i );
 
         switch ( gi->geometryTypeId() ) {
         case TYPE_TRIANGLE:
@@ -61,8 +62,10 @@ std::auto_ptr<Geometry> collectionExtractPolygons( std::auto_ptr<Geometry> g )
             break;
 
         case TYPE_TRIANGULATEDSURFACE: {
-            for ( size_t j = 0; j < gi->numGeometries(); ++j ) {
-                ret_geo->addGeometry( Polygon( gi->geometryN( j ).as<Triangle>() ) );
+            const TriangulatedSurface& tin = gi->as<TriangulatedSurface>();
+
+            for ( size_t j = 0; j < tin.numTriangles(); ++j ) {
+                ret_geo->addGeometry( Polygon( tin.triangleN( j ).toTriangle() ) );
             }
         }
         break;
@@ -88,4 +91,4 @@ std::auto_ptr<Geometry> collectionExtractPolygons( std::auto_ptr<Geometry> g )
 }
 
 }
-}
+SFCGAL_END_NAMESPACE
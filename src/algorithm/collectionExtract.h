@@ -26,7 +26,7 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 /*
  * Given a geometry collection
@@ -37,6 +37,6 @@ namespace algorithm {
  */
 SFCGAL_API std::auto_ptr<Geometry> collectionExtractPolygons( std::auto_ptr<Geometry> coll );
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -26,7 +26,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 // Use of auto_ptr :
@@ -46,7 +46,10 @@ std::auto_ptr<Geometry> collectionHomogenize( std::auto_ptr<Geometry> g )
 
     // test if it is a singleton
     if ( coll.numGeometries() == 1 ) {
-        return std::auto_ptr<Geometry>( coll.geometryN( 0 ).clone() );
+        // we own the collection, its geometry is moved (cloned only if shared)
+        boost::ptr_vector< Geometry > parts;
+        g->as<GeometryCollection>().releaseGeometries( parts );
+        return std::auto_ptr<Geometry>( parts.pop_back().release() );
     }
 
     for ( size_t i = 0; i < coll.numGeometries(); ++i ) {
@@ -68,28 +71,44 @@ std::auto_ptr<Geometry> collectionHomogenize( std::auto_ptr<Geometry> g )
         return g;
     }
 
-    GeometryCollection* ret_geo = 0;
+    std::auto_ptr<GeometryCollection> ret_geo;
 
     if ( common_type == TYPE_POINT ) {
-        ret_geo = new MultiPoint;
+        ret_geo.reset( new MultiPoint );
     }
     else if ( common_type == TYPE_LINESTRING ) {
-        ret_geo = new MultiLineString;
+        ret_geo.reset( new MultiLineString );
     }
     else if ( common_type == TYPE_POLYGON ) {
-        ret_geo = new MultiPolygon;
+        ret_geo.reset( new MultiPolygon );
     }
     else if ( common_type == TYPE_SOLID ) {
-        ret_geo = new MultiSolid;
+        ret_geo.reset( new MultiSolid );
     }
 
-    // copy each geometry
-    for ( size_t i = 0; i < coll.numGeometries(); ++i ) {
-        ret_geo->addGeometry( coll.geometryN( i ) );
+    if ( ret_geo.get() == NULL ) {
+        // no multi type for this common type, give back
+        return g;
     }
 
-    return std::auto_ptr<Geometry>( ret_geo );
-}
+    // move each geometry. They stay owned by a ptr_vector until they are added, they are
+    // popped from the back of a reversed copy to keep their order
+    boost::ptr_vector< Geometry > parts;
+    g->as<GeometryCollection>().releaseGeometries( parts );
 
+    boost::ptr_vector< Geometry > reversed;
+    reversed.reserve( parts.size() );
+
+    while ( ! parts.empty() ) {
+        reversed.push_back( parts.pop_back().release() );
+    }
+
+    while ( ! reversed.empty() ) {
+        ret_geo->addGeometry( reversed.pop_back().release() );
+    }
+
+    return std::auto_ptr<Geometry>( ret_geo.release() );
 }
+
 }
+SFCGAL_END_NAMESPACE
@@ -28,7 +28,7 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/GeometryCollection.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 /**
  * Given a geometry collection, returns the "simplest" representation of the contents.
@@ -40,6 +40,6 @@ namespace algorithm {
  */
 SFCGAL_API std::auto_ptr<Geometry> collectionHomogenize( std::auto_ptr<Geometry> coll );
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
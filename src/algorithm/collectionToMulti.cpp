@@ -25,15 +25,22 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
 
 #include <SFCGAL/detail/transform/ForceZ.h>
 
-namespace SFCGAL {
+#include <boost/move/utility.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 // Use of auto_ptr :
 // If nothing has to be built, g will be moved to the result without copy and new allocation.
-// Otherwise, a new geometry is built and the old one is deleted
+// Otherwise, a new geometry is built from the parts of the old one (moved, not copied)
+// and the old one is deleted
 std::auto_ptr<Geometry> collectionToMulti( std::auto_ptr<Geometry> g )
 {
     if ( ! g->is<GeometryCollection>() ) {
@@ -73,12 +80,17 @@ std::auto_ptr<Geometry> collectionToMulti( std::auto_ptr<Geometry> g )
 
     bool force3d = has2d && has3d;
 
-    MultiPolygon* ret_geo = new MultiPolygon;
+    // we own the collection, so its parts are moved to the result instead of being copied.
+    // The geometries stay owned by a ptr_vector until they are added to the result : nothing
+    // leaks if it can't be built.
+    boost::ptr_vector< Geometry > parts;
+    g->as<GeometryCollection>().releaseGeometries( parts );
 
-    // copy each geometry
-    for ( size_t i = 0; i < coll.numGeometries(); ++i ) {
+    // the polygons of the result, in reverse order (parts are popped from the back)
+    boost::ptr_vector< Geometry > polygons;
 
-        Geometry* gi = coll.geometryN( i ).clone();
+    while ( ! parts.empty() ) {
+        boost::ptr_vector< Geometry >::auto_type gi = parts.pop_back();
 
         if ( force3d && !gi->is3D() ) {
             transform::ForceZ forceZ;
@@ -87,19 +99,23 @@ std::auto_ptr<Geometry> collectionToMulti( std::auto_ptr<Geometry> g )
 
         switch ( gi->geometryTypeId() ) {
         case TYPE_TRIANGLE:
-            ret_geo->addGeometry( Polygon( gi->as<Triangle>() ) );
+            polygons.push_back( new Polygon( gi->as<Triangle>() ) );
             break;
 
         case TYPE_TRIANGULATEDSURFACE: {
-            for ( size_t j = 0; j < gi->numGeometries(); ++j ) {
-                ret_geo->addGeometry( Polygon( gi->geometryN( j ).as<Triangle>() ) );
+            const TriangulatedSurface& surface = gi->as<TriangulatedSurface>();
+
+            for ( size_t j = surface.numTriangles(); j > 0; --j ) {
+                polygons.push_back( new Polygon( surface.triangleN( j - 1 ).toTriangle() ) );
             }
         }
         break;
 
         case TYPE_POLYHEDRALSURFACE: {
-            for ( size_t j = 0; j < gi->numGeometries(); ++j ) {
-                ret_geo->addGeometry( gi->geometryN( j ) );
+            PolyhedralSurface& surface = gi->as<PolyhedralSurface>();
+
+            for ( size_t j = surface.numPolygons(); j > 0; --j ) {
+                polygons.push_back( new Polygon( boost::move( surface.polygonN( j - 1 ) ) ) );
             }
         }
         break;
@@ -112,12 +128,18 @@ std::auto_ptr<Geometry> collectionToMulti( std::auto_ptr<Geometry> g )
             }
 
         default:
-            ret_geo->addGeometry( *gi );
+            polygons.push_back( gi.release() );
         }
     }
 
-    return std::auto_ptr<Geometry>( ret_geo );
-}
+    std::auto_ptr<MultiPolygon> ret_geo( new MultiPolygon );
+
+    while ( ! polygons.empty() ) {
+        ret_geo->addGeometry( polygons.pop_back().release() );
+    }
 
+    return std::auto_ptr<Geometry>( ret_geo.release() );
 }
+
 }
+SFCGAL_END_NAMESPACE
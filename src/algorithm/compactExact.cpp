@@ -0,0 +1,69 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/compactExact.h>
+#include <SFCGAL/detail/transform/CompactExact.h>
+#include <SFCGAL/Geometry.h>
+
+#include <boost/atomic.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+///
+/// read on each boolean result : atomic, reading it does not lock
+///
+boost::atomic< bool > autoCompactExactEnabled( false ) ;
+}
+
+///
+///
+///
+CompactExactStatistics compactExact( Geometry& g, const bool& roundToDouble )
+{
+    transform::CompactExact t( roundToDouble ) ;
+    g.accept( t ) ;
+
+    CompactExactStatistics statistics ;
+    statistics.numCoordinates = t.numCoordinates() ;
+    statistics.numDoubles     = t.numDoubles() ;
+    return statistics ;
+}
+
+///
+///
+///
+void setAutoCompactExact( const bool& enabled )
+{
+    autoCompactExactEnabled.store( enabled ) ;
+}
+
+///
+///
+///
+bool autoCompactExact()
+{
+    return autoCompactExactEnabled.load() ;
+}
+
+} // namespace algorithm
+SFCGAL_END_NAMESPACE
+
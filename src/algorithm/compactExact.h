@@ -0,0 +1,84 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_COMPACTEXACT_H_
+#define _SFCGAL_ALGORITHM_COMPACTEXACT_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+/**
+ * @brief Statistics of a compactExact call
+ */
+struct SFCGAL_API CompactExactStatistics {
+    CompactExactStatistics():
+        numCoordinates( 0 ),
+        numDoubles( 0 ) {
+    }
+
+    /**
+     * number of compacted coordinates
+     */
+    size_t numCoordinates ;
+    /**
+     * number of coordinates stored as doubles (the others keep their exact value)
+     */
+    size_t numDoubles ;
+};
+
+/**
+ * @brief Drops the lazy exact construction history (expression DAG) of the coordinates
+ * of a geometry.
+ *
+ * Each coordinate is reduced to its exact value, or to doubles when they are the exact value.
+ * Constructive operations (intersection, union, difference) build coordinates that keep
+ * the operations they come from until their exact value is computed, compacting their results
+ * bounds the memory when they are used as inputs of the next operations.
+ *
+ * @param roundToDouble store the nearest doubles even if they are not the exact values (lossy)
+ */
+SFCGAL_API CompactExactStatistics compactExact( Geometry& g, const bool& roundToDouble = false );
+
+/**
+ * @brief Enables the automatic (exact) compaction of the results of intersection, union
+ * and difference (disabled by default, ignored when a fixed precision is set, see setFixedPrecision)
+ *
+ * The option is global and atomic : operations running in other threads use the new value
+ * from their next result on.
+ */
+SFCGAL_API void setAutoCompactExact( const bool& enabled );
+
+/**
+ * @brief Tests if the automatic compaction of the results is enabled
+ */
+SFCGAL_API bool autoCompactExact();
+
+} // namespace algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
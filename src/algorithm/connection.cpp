@@ -28,7 +28,7 @@
 #include <SFCGAL/PolyhedralSurface.h>
 #include <SFCGAL/TriangulatedSurface.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 void SurfaceGraph::addRing( const LineString& ring, FaceIndex faceIndex )
@@ -134,8 +134,15 @@ SurfaceGraph::SurfaceGraph( const TriangulatedSurface& tin ) :
         const FaceIndex idx = boost::add_vertex( _graph );
         BOOST_ASSERT( idx == t );
         ( void )idx;
-        const Triangle& triangle = tin.triangleN( t ) ;
-        addRing( triangle.toPolygon().exteriorRing(), t );
+        LineString ring ;
+
+        if ( ! tin.triangleN( t ).isEmpty() ) {
+            for ( size_t i = 0; i < 4; i++ ) {
+                ring.addPoint( tin.triangleVertex( t, i % 3 ) );
+            }
+        }
+
+        addRing( ring, t );
     }
 }
 
@@ -160,5 +167,5 @@ bool isClosed( const SurfaceGraph& graph )
 }
 
 }
-}
+SFCGAL_END_NAMESPACE
 
@@ -29,7 +29,7 @@
 #include <boost/noncopyable.hpp>
 #include <map>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -100,5 +100,5 @@ SFCGAL_API bool isConnected( const SurfaceGraph& graph );
 SFCGAL_API bool isClosed( const SurfaceGraph& graph );
 
 }
-}
+SFCGAL_END_NAMESPACE
 #endif
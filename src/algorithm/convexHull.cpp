@@ -39,7 +39,7 @@
 #include <CGAL/convex_hull_3.h>
 #include <vector>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 typedef CGAL::Point_3< Kernel >                              Point_3;
@@ -181,4 +181,4 @@ std::auto_ptr<Geometry> convexHull3D( const Geometry& g )
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
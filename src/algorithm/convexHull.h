@@ -25,7 +25,7 @@
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -43,7 +43,7 @@ SFCGAL_API std::auto_ptr<Geometry> convexHull3D( const Geometry& g ) ;
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -0,0 +1,286 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/coverageOverlay.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/algorithm/differencePrimitives.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/snapRound.h>
+
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_consolidated_curve_data_traits_2.h>
+#include <CGAL/Arr_extended_dcel.h>
+#include <CGAL/Arrangement_2.h>
+
+#include <algorithm>
+#include <deque>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+
+const size_t NO_INDEX = static_cast< size_t >( -1 );
+
+//
+// polygon bounded by an edge of the arrangement
+struct RingEdgeData {
+    RingEdgeData( int layer_ = 0, size_t index_ = 0, bool isInteriorOnLeft_ = false ):
+        layer( layer_ ),
+        index( index_ ),
+        isInteriorOnLeft( isInteriorOnLeft_ ) {
+    }
+
+    bool operator == ( const RingEdgeData& other ) const {
+        return layer == other.layer && index == other.index && isInteriorOnLeft == other.isInteriorOnLeft ;
+    }
+
+    // 0 for a, 1 for b
+    int layer ;
+    size_t index ;
+    // side of the interior of the polygon, the edge going from its xy-smallest end
+    bool isInteriorOnLeft ;
+};
+
+//
+// polygons of a and b covering a face of the arrangement
+struct FaceData {
+    FaceData():
+        isVisited( false ) {
+        indices[0] = NO_INDEX ;
+        indices[1] = NO_INDEX ;
+    }
+
+    bool isVisited ;
+    size_t indices[2] ;
+};
+
+typedef CGAL::Arr_segment_traits_2< Kernel > Segment_traits_2 ;
+typedef CGAL::Arr_consolidated_curve_data_traits_2< Segment_traits_2, RingEdgeData > Traits_2 ;
+typedef CGAL::Arr_face_extended_dcel< Traits_2, FaceData > Dcel ;
+typedef CGAL::Arrangement_2< Traits_2, Dcel > Arrangement_2 ;
+
+//
+// appends the edges of a ring, the interior of the polygon being on the left of the ring
+void addRing( const Polygon_2& ring, int layer, size_t index, std::vector< Traits_2::Curve_2 >& curves )
+{
+    for ( Polygon_2::Edge_const_iterator e = ring.edges_begin(); e != ring.edges_end(); ++e ) {
+        if ( e->is_degenerate() ) {
+            continue;
+        }
+
+        const bool isLeftToRight = CGAL::compare_xy( e->source(), e->target() ) == CGAL::SMALLER ;
+        curves.push_back( Traits_2::Curve_2( *e, RingEdgeData( layer, index, isLeftToRight ) ) );
+    }
+}
+
+//
+// appends the edges of the polygons of a layer
+void addLayer( const MultiPolygon& polygons, int layer, std::vector< Traits_2::Curve_2 >& curves )
+{
+    for ( size_t i = 0; i < polygons.numGeometries(); i++ ) {
+        const Polygon& polygon = polygons.polygonN( i );
+
+        if ( polygon.isEmpty() ) {
+            continue;
+        }
+
+        // counterclockwise exterior ring, clockwise holes
+        const PolygonWH_2 p = polygon.toPolygon_with_holes_2();
+        addRing( p.outer_boundary(), layer, i, curves );
+
+        for ( PolygonWH_2::Hole_const_iterator hole = p.holes_begin(); hole != p.holes_end(); ++hole ) {
+            addRing( *hole, layer, i, curves );
+        }
+    }
+}
+
+//
+// labels the face on the other side of h, from the face of h (on its left)
+void crossEdge( Arrangement_2::Halfedge_handle h )
+{
+    const FaceData& from = h->face()->data();
+    const bool isLeftToRight = h->direction() == CGAL::ARR_LEFT_TO_RIGHT ;
+
+    FaceData to ;
+    to.isVisited = true ;
+    bool isCrossed[2] = { false, false };
+
+    for ( Traits_2::Data_iterator it = h->curve().data().begin(); it != h->curve().data().end(); ++it ) {
+        isCrossed[it->layer] = true ;
+
+        // the interior of the polygon is on the right of h
+        if ( it->isInteriorOnLeft != isLeftToRight ) {
+            to.indices[it->layer] = it->index ;
+        }
+    }
+
+    for ( int layer = 0; layer < 2; layer++ ) {
+        if ( ! isCrossed[layer] ) {
+            to.indices[layer] = from.indices[layer] ;
+        }
+    }
+
+    h->twin()->face()->set_data( to );
+}
+
+//
+// labels the unvisited faces on the other side of a boundary of a visited face
+void crossCcb( Arrangement_2::Ccb_halfedge_circulator first, std::deque< Arrangement_2::Face_handle >& faces )
+{
+    Arrangement_2::Ccb_halfedge_circulator h = first ;
+
+    do {
+        Arrangement_2::Face_handle neighbour = h->twin()->face();
+
+        if ( ! neighbour->data().isVisited ) {
+            crossEdge( h );
+            faces.push_back( neighbour );
+        }
+    }
+    while ( ++h != first );
+}
+
+//
+// ring from a boundary of a face (counterclockwise for the outer boundary, clockwise for the holes)
+Polygon_2 ccbToRing( Arrangement_2::Ccb_halfedge_const_circulator first )
+{
+    Polygon_2 ring ;
+    Arrangement_2::Ccb_halfedge_const_circulator h = first ;
+
+    do {
+        ring.push_back( h->source()->point() );
+    }
+    while ( ++h != first );
+
+    return ring ;
+}
+
+typedef std::pair< std::pair< size_t, size_t >, PolygonWH_2 > OverlayFace ;
+
+bool compareProvenance( const OverlayFace& a, const OverlayFace& b )
+{
+    return a.first < b.first ;
+}
+
+}
+
+///
+///
+///
+std::auto_ptr< MultiPolygon > coverageOverlay(
+    const MultiPolygon& a,
+    const MultiPolygon& b,
+    std::vector< std::pair< size_t, size_t > >& provenance
+)
+{
+    // a coverage shares edges between its polygons, they are checked one by one
+    for ( size_t i = 0; i < a.numGeometries(); i++ ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( a.polygonN( i ) );
+    }
+
+    for ( size_t j = 0; j < b.numGeometries(); j++ ) {
+        SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( b.polygonN( j ) );
+    }
+
+    return coverageOverlay( a, b, provenance, NoValidityCheck() );
+}
+
+///
+///
+///
+std::auto_ptr< MultiPolygon > coverageOverlay(
+    const MultiPolygon& a,
+    const MultiPolygon& b,
+    std::vector< std::pair< size_t, size_t > >& provenance,
+    NoValidityCheck
+)
+{
+    requireExactConstructions( "coverageOverlay" );
+
+    provenance.clear();
+
+    std::vector< Traits_2::Curve_2 > curves ;
+    addLayer( a, 0, curves );
+    addLayer( b, 1, curves );
+
+    Arrangement_2 arrangement ;
+    CGAL::insert( arrangement, curves.begin(), curves.end() );
+
+    // breadth first traversal of the faces, the holes of a face lead to the connected components it contains
+    std::deque< Arrangement_2::Face_handle > faces ;
+    FaceData outside ;
+    outside.isVisited = true ;
+    arrangement.unbounded_face()->set_data( outside );
+    faces.push_back( arrangement.unbounded_face() );
+
+    while ( ! faces.empty() ) {
+        Arrangement_2::Face_handle f = faces.front();
+        faces.pop_front();
+
+        if ( ! f->is_unbounded() ) {
+            crossCcb( f->outer_ccb(), faces );
+        }
+
+        for ( Arrangement_2::Hole_iterator hole = f->holes_begin(); hole != f->holes_end(); ++hole ) {
+            crossCcb( *hole, faces );
+        }
+    }
+
+    // the faces covered by both layers
+    std::vector< OverlayFace > overlayFaces ;
+
+    for ( Arrangement_2::Face_const_iterator f = arrangement.faces_begin(); f != arrangement.faces_end(); ++f ) {
+        if ( f->is_unbounded() || f->data().indices[0] == NO_INDEX || f->data().indices[1] == NO_INDEX ) {
+            continue;
+        }
+
+        PolygonWH_2 face( ccbToRing( f->outer_ccb() ) );
+
+        for ( Arrangement_2::Hole_const_iterator hole = f->holes_begin(); hole != f->holes_end(); ++hole ) {
+            face.add_hole( ccbToRing( *hole ) );
+        }
+
+        // the rings of a face may touch themselves at a vertex
+        std::vector< PolygonWH_2 > parts ;
+        fix_cgal_valid_polygon( face, std::back_inserter( parts ) );
+
+        for ( std::vector< PolygonWH_2 >::const_iterator it = parts.begin(); it != parts.end(); ++it ) {
+            overlayFaces.push_back( OverlayFace( std::make_pair( f->data().indices[0], f->data().indices[1] ), *it ) );
+        }
+    }
+
+    std::stable_sort( overlayFaces.begin(), overlayFaces.end(), compareProvenance );
+
+    std::auto_ptr< MultiPolygon > result( new MultiPolygon );
+    provenance.reserve( overlayFaces.size() );
+
+    for ( std::vector< OverlayFace >::const_iterator it = overlayFaces.begin(); it != overlayFaces.end(); ++it ) {
+        result->addGeometry( new Polygon( it->second ) );
+        provenance.push_back( it->first );
+    }
+
+    applyResultPrecision( *result );
+    return result ;
+}
+
+}//algorithm
+SFCGAL_END_NAMESPACE
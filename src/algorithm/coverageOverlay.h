@@ -0,0 +1,81 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_COVERAGEOVERLAY_H_
+#define _SFCGAL_ALGORITHM_COVERAGEOVERLAY_H_
+
+#include <SFCGAL/config.h>
+
+#include <memory>
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+SFCGAL_BEGIN_NAMESPACE
+class MultiPolygon ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * @brief Overlay of two polygon coverages : the intersection of a and b, where each polygon of the
+ * result keeps the indices of the polygons of a and b it comes from. Force projection to z=0 if needed
+ *
+ * The rings of both layers are inserted in one CGAL arrangement (a single sweep), each edge knowing
+ * the polygons it bounds. The faces are then labelled by a traversal starting from the unbounded face :
+ * crossing an edge of a layer enters or leaves a polygon of this layer, the edges of the other layer
+ * keep the label of this layer.
+ *
+ * This replaces the intersection() of each pair of polygons with overlapping envelopes, and gives
+ * the same point set for each pair (without the parts of dimension lower than 2).
+ *
+ * @param a the first layer (ex : parcels)
+ * @param b the second layer (ex : zoning)
+ * @param provenance receives, for each polygon of the result, the indices (i,j) of a.polygonN(i)
+ * and b.polygonN(j). The polygons are sorted on these pairs, a pair may have several polygons.
+ * @pre the polygons of a and b are valid
+ * @pre the polygons of a layer have disjoint interiors. They may share edges (the layers don't have
+ * to be valid MultiPolygons)
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr< MultiPolygon > coverageOverlay(
+    const MultiPolygon& a,
+    const MultiPolygon& b,
+    std::vector< std::pair< size_t, size_t > >& provenance
+);
+
+/**
+ * @brief Overlay of two polygon coverages, no validity check variant
+ * @ingroup detail
+ * @warning No actual validity check is done
+ */
+SFCGAL_API std::auto_ptr< MultiPolygon > coverageOverlay(
+    const MultiPolygon& a,
+    const MultiPolygon& b,
+    std::vector< std::pair< size_t, size_t > >& provenance,
+    NoValidityCheck
+);
+
+}//algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -21,17 +21,25 @@
 
 #include <SFCGAL/algorithm/covers.h>
 #include <SFCGAL/Geometry.h>
+#include <SFCGAL/FilterStatistics.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/intersection.h>
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/detail/TypeForDimension.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/detail/triangulate/triangulateInGeometrySet.h>
+#include <SFCGAL/PreparedGeometry.h>
 
 #include <CGAL/box_intersection_d.h>
+#include <CGAL/intersections.h>
+
+#include <algorithm>
+#include <map>
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 bool covers( const PrimitiveHandle<3>&, const PrimitiveHandle<3>& )
@@ -193,8 +201,10 @@ bool equalLength( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, int dim
     return true;
 }
 
+//
+// false if a can't cover b, given their dimensions
 template <int Dim>
-bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
+bool canCover( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
 {
     int dimA = a.dimension();
     int dimB = b.dimension();
@@ -207,15 +217,16 @@ bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
         return false;
     }
 
-    //
-    // This is a very naive (not efficient) implementation of covers() !
-    //
-    // covers(A,B) <=> A inter B == B
-    // '==' is here implemented with comparison of length, area and volumes
-    // TODO use only predicates if possible
-    GeometrySet<Dim> inter;
-    algorithm::intersection( a, b, inter );
+    return true;
+}
 
+//
+// covers(A,B) <=> A inter B == B
+// '==' is here implemented with comparison of length, area and volumes
+// (only used for the surfaces and the volumes in 3D, see coversPrimitive)
+template <int Dim>
+bool equalsIntersection( const GeometrySet<Dim>& b, const GeometrySet<Dim>& inter )
+{
     if ( b.hasPoints() && ! equalLength( b, inter, 0 ) ) {
         return false;
     }
@@ -235,11 +246,479 @@ bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
     return true;
 }
 
+namespace {
+
+typedef CGAL::Point_2< Kernel > Point_2 ;
+typedef CGAL::Segment_2< Kernel > Segment_2 ;
+typedef CGAL::Polygon_2< Kernel > Polygon_2 ;
+typedef CGAL::Polygon_with_holes_2< Kernel > Polygon_with_holes_2 ;
+
+//
+// primitives of A whose boxes overlap the box of a primitive of B
+template <int Dim>
+struct Candidates {
+    typedef std::vector< const PrimitiveHandle<Dim>* > Type ;
+};
+
+template <int Dim>
+struct CandidateMap {
+    typedef std::map< const PrimitiveHandle<Dim>*, typename Candidates<Dim>::Type > Type ;
+};
+
+template <int Dim>
+struct collect_candidates_cb {
+    typename CandidateMap<Dim>::Type& candidates ;
+
+    collect_candidates_cb( typename CandidateMap<Dim>::Type& candidates_ ) : candidates( candidates_ ) {}
+
+    void operator()( const typename PrimitiveBox<Dim>::Type& a,
+                     const typename PrimitiveBox<Dim>::Type& b ) {
+        candidates[ b.handle() ].push_back( a.handle() );
+    }
+};
+
+//
+// adds the points of a point or segment intersection
+template <int Dim>
+void addIntersectionPoints( const CGAL::Object& object, std::vector< typename Point_d<Dim>::Type >& points )
+{
+    typedef typename Point_d<Dim>::Type Point ;
+    typedef typename Segment_d<Dim>::Type Segment ;
+
+    if ( const Point* p = CGAL::object_cast< Point >( &object ) ) {
+        points.push_back( *p );
+    }
+    else if ( const Segment* s = CGAL::object_cast< Segment >( &object ) ) {
+        points.push_back( s->source() );
+        points.push_back( s->target() );
+    }
+}
+
+template <int Dim>
+bool coversPoint( const typename Candidates<Dim>::Type& candidates, const typename Point_d<Dim>::Type& point )
+{
+    const PrimitiveHandle<Dim> handle( &point );
+
+    for ( typename Candidates<Dim>::Type::const_iterator it = candidates.begin(); it != candidates.end(); ++it ) {
+        if ( algorithm::intersects( **it, handle ) ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void addSplitPoints( const Segment_2& segment, const Polygon_2& ring, std::vector< Point_2 >& points )
+{
+    const CGAL::Bbox_2 box = segment.bbox();
+
+    for ( Polygon_2::Edge_const_iterator eit = ring.edges_begin(); eit != ring.edges_end(); ++eit ) {
+        const Segment_2 edge = *eit ;
+
+        if ( CGAL::do_overlap( box, edge.bbox() ) ) {
+            addIntersectionPoints<2>( CGAL::intersection( segment, edge ), points );
+        }
+    }
+}
+
+//
+// adds the points where segment enters or leaves the candidate
+void addSplitPoints( const Segment_2& segment, const PrimitiveHandle<2>& candidate, std::vector< Point_2 >& points )
+{
+    switch ( candidate.handle.which() ) {
+    case PrimitiveSegment:
+        addIntersectionPoints<2>( CGAL::intersection( segment, *candidate.as< Segment_2 >() ), points );
+        break;
+
+    case PrimitiveSurface: {
+        const Polygon_with_holes_2& polygon = *candidate.as< Polygon_with_holes_2 >();
+        addSplitPoints( segment, polygon.outer_boundary(), points );
+
+        for ( Polygon_with_holes_2::Hole_const_iterator hit = polygon.holes_begin(); hit != polygon.holes_end(); ++hit ) {
+            addSplitPoints( segment, *hit, points );
+        }
+
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void addSplitPoints( const CGAL::Segment_3< Kernel >& segment, const PrimitiveHandle<3>& candidate, std::vector< CGAL::Point_3< Kernel > >& points )
+{
+    switch ( candidate.handle.which() ) {
+    case PrimitiveSegment:
+        addIntersectionPoints<3>( CGAL::intersection( segment, *candidate.as< CGAL::Segment_3< Kernel > >() ), points );
+        break;
+
+    case PrimitiveSurface:
+        addIntersectionPoints<3>( CGAL::intersection( *candidate.as< CGAL::Triangle_3< Kernel > >(), segment ), points );
+        break;
+
+    case PrimitiveVolume: {
+        GeometrySet<3> triangles ;
+        triangulate::triangulate( *candidate.as< MarkedPolyhedron >(), triangles );
+
+        const CGAL::Bbox_3 box = segment.bbox();
+
+        for ( GeometrySet<3>::SurfaceCollection::const_iterator it = triangles.surfaces().begin(); it != triangles.surfaces().end(); ++it ) {
+            const CGAL::Triangle_3< Kernel >& triangle = it->primitive();
+
+            if ( ! triangle.is_degenerate() && CGAL::do_overlap( box, triangle.bbox() ) ) {
+                addIntersectionPoints<3>( CGAL::intersection( triangle, segment ), points );
+            }
+        }
+
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+//
+// the segment is split where it enters or leaves the candidates : each piece is either
+// entirely covered by a candidate or not covered by it, its midpoint tells which.
+template <int Dim>
+bool coversSegment( const typename Candidates<Dim>::Type& candidates, const typename Segment_d<Dim>::Type& segment )
+{
+    typedef typename Point_d<Dim>::Type Point ;
+
+    if ( segment.is_degenerate() ) {
+        return coversPoint<Dim>( candidates, segment.source() );
+    }
+
+    std::vector< Point > points ;
+    points.push_back( segment.source() );
+    points.push_back( segment.target() );
+
+    for ( typename Candidates<Dim>::Type::const_iterator it = candidates.begin(); it != candidates.end(); ++it ) {
+        addSplitPoints( segment, **it, points );
+    }
+
+    // the points are on the segment, the lexicographic order is the order along the segment
+    std::sort( points.begin(), points.end() );
+    points.erase( std::unique( points.begin(), points.end() ), points.end() );
+
+    for ( size_t i = 0; i + 1 < points.size(); i++ ) {
+        if ( ! coversPoint<Dim>( candidates, CGAL::midpoint( points[i], points[i + 1] ) ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// sides of an edge, walking from its lower (xy) end to its upper one
+enum EdgeSide {
+    SIDE_NONE = 0,
+    SIDE_LEFT = 1,
+    SIDE_RIGHT = 2,
+    SIDE_BOTH = SIDE_LEFT | SIDE_RIGHT
+};
+
+int edgeInteriorSide( bool isHole, bool isCounterClockwise, const Segment_2& edge )
+{
+    const bool isLeft = ( isHole != isCounterClockwise ) == ( CGAL::compare_xy( edge.source(), edge.target() ) == CGAL::SMALLER ) ;
+    return isLeft ? SIDE_LEFT : SIDE_RIGHT ;
+}
+
+//
+// A polygon with the orientation of its rings
+struct OrientedPolygon {
+    explicit OrientedPolygon( const Polygon_with_holes_2& polygon ) :
+        bbox( polygon.outer_boundary().bbox() ) {
+        rings.push_back( &polygon.outer_boundary() );
+
+        for ( Polygon_with_holes_2::Hole_const_iterator hit = polygon.holes_begin(); hit != polygon.holes_end(); ++hit ) {
+            rings.push_back( &*hit );
+        }
+
+        for ( size_t i = 0; i < rings.size(); i++ ) {
+            isCounterClockwise.push_back( CGAL::sign( rings[i]->area() ) == CGAL::POSITIVE );
+        }
+    }
+
+    //
+    // sides of a piece of edge covered by the polygon, given the midpoint m of the piece
+    // (the pieces are split where they cross the rings, m is on a ring only if the piece lies on it)
+    int coveredSides( const Point_2& m ) const {
+        if ( ! CGAL::do_overlap( bbox, m.bbox() ) ) {
+            return SIDE_NONE;
+        }
+
+        for ( size_t i = 0; i < rings.size(); i++ ) {
+            for ( Polygon_2::Edge_const_iterator eit = rings[i]->edges_begin(); eit != rings[i]->edges_end(); ++eit ) {
+                const Segment_2 edge = *eit ;
+
+                if ( edge.has_on( m ) ) {
+                    return edgeInteriorSide( i > 0, isCounterClockwise[i], edge );
+                }
+            }
+        }
+
+        if ( rings[0]->bounded_side( m ) != CGAL::ON_BOUNDED_SIDE ) {
+            return SIDE_NONE;
+        }
+
+        for ( size_t i = 1; i < rings.size(); i++ ) {
+            if ( rings[i]->bounded_side( m ) == CGAL::ON_BOUNDED_SIDE ) {
+                return SIDE_NONE;
+            }
+        }
+
+        return SIDE_BOTH;
+    }
+
+    // exterior ring first
+    std::vector< const Polygon_2* > rings ;
+    std::vector< bool > isCounterClockwise ;
+    CGAL::Bbox_2 bbox ;
+};
+
+struct RingEdge {
+    RingEdge( const Segment_2& segment_, int interiorSide_ ) :
+        segment( segment_ ), interiorSide( interiorSide_ ) {
+        points.push_back( segment.source() );
+        points.push_back( segment.target() );
+    }
+
+    Segment_2 segment ;
+    // side of the covered polygon, SIDE_NONE on the edges of the covering polygons
+    int interiorSide ;
+    // split points
+    std::vector< Point_2 > points ;
+};
+
+typedef CGAL::Box_intersection_d::Box_with_handle_d< double, 2, RingEdge* > RingEdgeBox ;
+
+struct split_ring_edges_cb {
+    void operator()( const RingEdgeBox& a, const RingEdgeBox& b ) const {
+        const CGAL::Object object = CGAL::intersection( a.handle()->segment, b.handle()->segment );
+        addIntersectionPoints<2>( object, a.handle()->points );
+        addIntersectionPoints<2>( object, b.handle()->points );
+    }
+};
+
+//
+// adds the edges of polygon overlapping bbox, tagged with the interior side if isCovered
+void addRingEdges( const OrientedPolygon& polygon, bool isCovered, const CGAL::Bbox_2& bbox, std::vector< RingEdge >& edges )
+{
+    for ( size_t i = 0; i < polygon.rings.size(); i++ ) {
+        for ( Polygon_2::Edge_const_iterator eit = polygon.rings[i]->edges_begin(); eit != polygon.rings[i]->edges_end(); ++eit ) {
+            const Segment_2 edge = *eit ;
+
+            if ( edge.is_degenerate() || ! CGAL::do_overlap( edge.bbox(), bbox ) ) {
+                continue;
+            }
+
+            edges.push_back( RingEdge( edge, isCovered ? edgeInteriorSide( i > 0, polygon.isCounterClockwise[i], edge ) : int( SIDE_NONE ) ) );
+        }
+    }
+}
+
+//
+// The covering polygons leave a part of the covered polygon uncovered if and only if
+// the boundary of this part has an uncovered side. This boundary is made of pieces of
+// edges of the covered polygon (the interior side must be covered) and of pieces of
+// edges of the covering polygons inside the covered one (both sides must be covered).
+bool coversSurface( const Candidates<2>::Type& candidates, const Polygon_with_holes_2& polygon )
+{
+    const OrientedPolygon covered( polygon );
+
+    std::vector< OrientedPolygon > covering ;
+    size_t numEdges = 0 ;
+
+    for ( size_t i = 0; i < covered.rings.size(); i++ ) {
+        numEdges += covered.rings[i]->size();
+    }
+
+    for ( Candidates<2>::Type::const_iterator it = candidates.begin(); it != candidates.end(); ++it ) {
+        if ( ( *it )->handle.which() == PrimitiveSurface ) {
+            covering.push_back( OrientedPolygon( *( *it )->as< Polygon_with_holes_2 >() ) );
+
+            for ( size_t i = 0; i < covering.back().rings.size(); i++ ) {
+                numEdges += covering.back().rings[i]->size();
+            }
+        }
+    }
+
+    if ( covering.empty() ) {
+        return false;
+    }
+
+    // the boxes point to the edges : no reallocation is allowed while they are filled
+    std::vector< RingEdge > edges ;
+    edges.reserve( numEdges );
+
+    addRingEdges( covered, true, covered.bbox, edges );
+
+    for ( std::vector< OrientedPolygon >::const_iterator it = covering.begin(); it != covering.end(); ++it ) {
+        addRingEdges( *it, false, covered.bbox, edges );
+    }
+
+    std::vector< RingEdgeBox > boxes ;
+    boxes.reserve( edges.size() );
+
+    for ( std::vector< RingEdge >::iterator it = edges.begin(); it != edges.end(); ++it ) {
+        boxes.push_back( RingEdgeBox( it->segment.bbox(), &*it ) );
+    }
+
+    CGAL::box_self_intersection_d( boxes.begin(), boxes.end(), split_ring_edges_cb() );
+
+    // the edges of the covered polygon come first
+    for ( std::vector< RingEdge >::iterator it = edges.begin(); it != edges.end(); ++it ) {
+        std::vector< Point_2 >& points = it->points ;
+        std::sort( points.begin(), points.end() );
+        points.erase( std::unique( points.begin(), points.end() ), points.end() );
+
+        for ( size_t i = 0; i + 1 < points.size(); i++ ) {
+            const Point_2 m = CGAL::midpoint( points[i], points[i + 1] );
+
+            int required = it->interiorSide ;
+
+            if ( required == SIDE_NONE ) {
+                if ( covered.coveredSides( m ) != SIDE_BOTH ) {
+                    continue;
+                }
+
+                required = SIDE_BOTH ;
+            }
+
+            int sides = SIDE_NONE ;
+
+            for ( std::vector< OrientedPolygon >::const_iterator cit = covering.begin();
+                    cit != covering.end() && ( sides & required ) != required; ++cit ) {
+                sides |= cit->coveredSides( m );
+            }
+
+            if ( ( sides & required ) != required ) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool coversPrimitive( const Candidates<2>::Type& candidates, const PrimitiveHandle<2>& primitive )
+{
+    switch ( primitive.handle.which() ) {
+    case PrimitivePoint:
+        return coversPoint<2>( candidates, *primitive.as< Point_2 >() );
+
+    case PrimitiveSegment:
+        return coversSegment<2>( candidates, *primitive.as< Segment_2 >() );
+
+    case PrimitiveSurface:
+        return coversSurface( candidates, *primitive.as< Polygon_with_holes_2 >() );
+
+    default:
+        return false;
+    }
+}
+
+bool coversPrimitive( const Candidates<3>::Type& candidates, const PrimitiveHandle<3>& primitive )
+{
+    switch ( primitive.handle.which() ) {
+    case PrimitivePoint:
+        return coversPoint<3>( candidates, *primitive.as< CGAL::Point_3< Kernel > >() );
+
+    case PrimitiveSegment:
+        return coversSegment<3>( candidates, *primitive.as< CGAL::Segment_3< Kernel > >() );
+
+    default: {
+        // triangles and volumes : the intersection with the candidates is compared with the primitive
+        GeometrySet<3> a, b ;
+
+        for ( Candidates<3>::Type::const_iterator it = candidates.begin(); it != candidates.end(); ++it ) {
+            a.addPrimitive( **it );
+        }
+
+        b.addPrimitive( primitive );
+
+        GeometrySet<3> inter ;
+        algorithm::intersection( a, b, inter );
+
+        return equalsIntersection( b, inter );
+    }
+    }
+}
+
+}
+
+//
+// covers(A,B) <=> each primitive of B is covered by the primitives of A whose boxes overlap its box
+// (boxes are reordered by the traversal)
+template <int Dim>
+bool coversBoxes( typename BoxCollection<Dim>::Type& aboxes, typename BoxCollection<Dim>::Type& bboxes )
+{
+    // the boxes come by increasing dimension before the traversal : the cheapest tests first
+    std::vector< const PrimitiveHandle<Dim>* > primitives ;
+    primitives.reserve( bboxes.size() );
+
+    for ( typename BoxCollection<Dim>::Type::const_iterator it = bboxes.begin(); it != bboxes.end(); ++it ) {
+        primitives.push_back( it->handle() );
+    }
+
+    typename CandidateMap<Dim>::Type candidates ;
+    CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                              bboxes.begin(), bboxes.end(),
+                              collect_candidates_cb<Dim>( candidates ) );
+
+    for ( size_t i = 0; i < primitives.size(); i++ ) {
+        typename CandidateMap<Dim>::Type::const_iterator found = candidates.find( primitives[i] );
+
+        if ( found == candidates.end() || ! coversPrimitive( found->second, *primitives[i] ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <int Dim>
+bool covers( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
+{
+    if ( ! canCover( a, b ) ) {
+        return false;
+    }
+
+    typename HandleCollection<Dim>::Type ahandles, bhandles;
+    typename BoxCollection<Dim>::Type aboxes, bboxes;
+    a.computeBoundingBoxes( ahandles, aboxes );
+    b.computeBoundingBoxes( bhandles, bboxes );
+
+    return coversBoxes<Dim>( aboxes, bboxes );
+}
+
+template <int Dim>
+bool covers( const PreparedGeometrySet<Dim>& a, const PreparedGeometrySet<Dim>& b )
+{
+    if ( ! canCover( a.geometrySet(), b.geometrySet() ) ) {
+        return false;
+    }
+
+    // the prepared boxes are shared, they must not be reordered
+    typename BoxCollection<Dim>::Type aboxes( a.boxes() ), bboxes( b.boxes() );
+
+    return coversBoxes<Dim>( aboxes, bboxes );
+}
+
 template bool covers<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
 template bool covers<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
 
+template bool covers<2>( const PreparedGeometrySet<2>& a, const PreparedGeometrySet<2>& b );
+template bool covers<3>( const PreparedGeometrySet<3>& a, const PreparedGeometrySet<3>& b );
+
 bool covers( const Geometry& ga, const Geometry& gb )
 {
+    SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
     if ( ga.isEmpty() || gb.isEmpty() ) {
         return false;
     }
@@ -252,6 +731,8 @@ bool covers( const Geometry& ga, const Geometry& gb )
 
 bool covers3D( const Geometry& ga, const Geometry& gb )
 {
+    SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
     if ( ga.isEmpty() || gb.isEmpty() ) {
         return false;
     }
@@ -261,5 +742,53 @@ bool covers3D( const Geometry& ga, const Geometry& gb )
 
     return covers( gsa, gsb );
 }
+
+bool covers( const PreparedGeometry& ga, const Geometry& gb )
+{
+    SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
+    if ( ga.geometry().isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    const PreparedGeometrySet<2> gsb( gb );
+
+    return covers( ga.geometrySet2D(), gsb );
+}
+
+bool covers( const PreparedGeometry& ga, const PreparedGeometry& gb )
+{
+    SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
+    if ( ga.geometry().isEmpty() || gb.geometry().isEmpty() ) {
+        return false;
+    }
+
+    return covers( ga.geometrySet2D(), gb.geometrySet2D() );
+}
+
+bool covers3D( const PreparedGeometry& ga, const Geometry& gb )
+{
+    SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
+    if ( ga.geometry().isEmpty() || gb.isEmpty() ) {
+        return false;
+    }
+
+    const PreparedGeometrySet<3> gsb( gb );
+
+    return covers( ga.geometrySet3D(), gsb );
+}
+
+bool covers3D( const PreparedGeometry& ga, const PreparedGeometry& gb )
+{
+    SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+
+    if ( ga.geometry().isEmpty() || gb.geometry().isEmpty() ) {
+        return false;
+    }
+
+    return covers( ga.geometrySet3D(), gb.geometrySet3D() );
 }
 }
+SFCGAL_END_NAMESPACE
@@ -25,12 +25,14 @@
 
 #include <vector>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
 class Solid;
 class Point;
+class PreparedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
+template <int Dim> class PreparedGeometrySet;
 template <int Dim> struct PrimitiveHandle;
 }
 
@@ -46,18 +48,46 @@ SFCGAL_API bool covers( const Geometry& ga, const Geometry& gb );
  */
 SFCGAL_API bool covers3D( const Geometry& ga, const Geometry& gb );
 
+/**
+ * Cover test on 2D geometries, reusing the decomposition cached in the prepared geometry.
+ * Checks if gA covers gB. Force projection to z=0 if needed
+ */
+SFCGAL_API bool covers( const PreparedGeometry& ga, const Geometry& gb );
+
+/**
+ * Cover test on 2D prepared geometries. Checks if gA covers gB. Force projection to z=0 if needed
+ */
+SFCGAL_API bool covers( const PreparedGeometry& ga, const PreparedGeometry& gb );
+
+/**
+ * Cover test on 3D geometries, reusing the decomposition cached in the prepared geometry.
+ * Checks if gA covers gB. Assume z = 0 if needed
+ */
+SFCGAL_API bool covers3D( const PreparedGeometry& ga, const Geometry& gb );
+
+/**
+ * Cover test on 3D prepared geometries. Checks if gA covers gB. Assume z = 0 if needed
+ */
+SFCGAL_API bool covers3D( const PreparedGeometry& ga, const PreparedGeometry& gb );
+
 /**
  * @ingroup@ detail
  */
 template <int Dim>
 bool covers( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b );
 
+/**
+ * @ingroup@ detail
+ */
+template <int Dim>
+bool covers( const detail::PreparedGeometrySet<Dim>& a, const detail::PreparedGeometrySet<Dim>& b );
+
 /**
  * @ingroup@ detail
  */
 template <int Dim>
 bool covers( const detail::PrimitiveHandle<Dim>& a, const detail::PrimitiveHandle<Dim>& b );
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -22,7 +22,11 @@
 #include <SFCGAL/algorithm/difference.h>
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/parallelFor.h>
+#include <SFCGAL/detail/PrimitiveCopies.h>
+#include <SFCGAL/ExecutionPolicy.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/snapRound.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/TriangulatedSurface.h>
@@ -34,12 +38,15 @@
 #include <CGAL/corefinement_operations.h>
 #include <CGAL/Point_inside_polyhedron_3.h>
 
+#include <boost/noncopyable.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
 //
 // Intersection kernel
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 namespace algorithm {
 
@@ -299,6 +306,103 @@ void appendDifference( const PrimitiveHandle<3>& pa,
     }
 }
 
+//
+// true if a primitive of the operation is a volume
+template <int Dim>
+bool hasVolume( const typename CollisionMapper<Dim>::Map::value_type& operation )
+{
+    if ( operation.first->handle.which() == PrimitiveVolume ) {
+        return true;
+    }
+
+    for ( typename CollisionMapper<Dim>::PrimitiveHandleSet::const_iterator it = operation.second.begin();
+            it != operation.second.end(); ++it ) {
+        if ( ( *it )->handle.which() == PrimitiveVolume ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//
+// a share of the operations, computed by a thread on its own copies of the primitives
+template <int Dim>
+struct OperationBlock : boost::noncopyable {
+    PrimitiveCopies<Dim> copies;
+    // primitive to substract from and primitives to substract, for each operation
+    std::vector< std::pair< PrimitiveHandle<Dim>*, typename CollisionMapper<Dim>::PrimitiveHandleSet > > operations;
+    // index of each operation in the map (and in the outputs)
+    std::vector< size_t > indices;
+};
+
+//
+// difference of the operations of the k-th block, each in its own output
+template <int Dim>
+struct OperationDifference {
+    OperationDifference( const boost::ptr_vector< OperationBlock<Dim> >& blocks, std::vector< GeometrySet<Dim> >& outputs ) :
+        _blocks( blocks ), _outputs( outputs ) {}
+
+    void operator()( const size_t& k ) const {
+        const OperationBlock<Dim>& block = _blocks[k];
+
+        for ( size_t j = 0; j < block.operations.size(); j++ ) {
+            appendDifference( *block.operations[j].first, block.operations[j].second.begin(), block.operations[j].second.end(), _outputs[block.indices[j]] );
+        }
+    }
+
+private:
+    const boost::ptr_vector< OperationBlock<Dim> >& _blocks;
+    std::vector< GeometrySet<Dim> >& _outputs;
+};
+
+//
+// operations shared between threads, the outputs are merged in the order of the map
+template <int Dim>
+void appendDifferences( const typename CollisionMapper<Dim>::Map& map, const size_t& numThreads, GeometrySet<Dim>& output )
+{
+    std::vector< const typename CollisionMapper<Dim>::Map::value_type* > shared;
+    std::vector< size_t > sharedIndices;
+    std::vector< GeometrySet<Dim> > outputs( map.size() );
+    size_t i = 0;
+
+    for ( typename CollisionMapper<Dim>::Map::const_iterator cbit = map.begin(); cbit != map.end(); ++cbit, ++i ) {
+        // the corefinement modifies the polyhedra, the operations with a volume are computed in this thread
+        if ( hasVolume<Dim>( *cbit ) ) {
+            appendDifference( *cbit->first, cbit->second.begin(), cbit->second.end(), outputs[i] );
+        }
+        else {
+            shared.push_back( &( *cbit ) );
+            sharedIndices.push_back( i );
+        }
+    }
+
+    // the threads can't share the lazy exact numbers, each block of operations gets its own copies
+    const size_t numBlocks = numCopyBlocks( shared.size(), numThreads );
+    boost::ptr_vector< OperationBlock<Dim> > blocks;
+
+    for ( size_t b = 0; b < numBlocks; b++ ) {
+        blocks.push_back( new OperationBlock<Dim>() );
+        OperationBlock<Dim>& block = blocks.back();
+
+        for ( size_t k = shared.size() * b / numBlocks; k < shared.size() * ( b + 1 ) / numBlocks; k++ ) {
+            typename CollisionMapper<Dim>::PrimitiveHandleSet copies;
+
+            for ( typename CollisionMapper<Dim>::PrimitiveHandleSet::const_iterator it = shared[k]->second.begin();
+                    it != shared[k]->second.end(); ++it ) {
+                copies.push_back( block.copies.copy( *it ) );
+            }
+
+            block.operations.push_back( std::make_pair( block.copies.copy( shared[k]->first ), copies ) );
+            block.indices.push_back( sharedIndices[k] );
+        }
+    }
+
+    detail::parallelFor( blocks.size(), OperationDifference<Dim>( blocks, outputs ), numThreads );
+
+    output.merge( outputs );
+}
+
 /**
  * difference post processing
  */
@@ -375,7 +479,12 @@ void difference( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, GeometryS
     }
 
     // then we delegate the operations according to type
-    {
+    const size_t numThreads = ExecutionPolicy::current().threadsFor( map.size() );
+
+    if ( numThreads > 1 ) {
+        appendDifferences<Dim>( map, numThreads, temp );
+    }
+    else {
         typename CollisionMapper<Dim>::Map::const_iterator cbit = map.begin();
         const typename CollisionMapper<Dim>::Map::const_iterator end = map.end();
 
@@ -398,7 +507,10 @@ std::auto_ptr<Geometry> difference( const Geometry& ga, const Geometry& gb, NoVa
 
     GeometrySet<2> filtered;
     output.filterCovered( filtered );
-    return filtered.recompose();
+    std::auto_ptr<Geometry> result( filtered.recompose() );
+    applyResultPrecision( *result );
+
+    return result;
 }
 
 std::auto_ptr<Geometry> difference( const Geometry& ga, const Geometry& gb )
@@ -417,7 +529,10 @@ std::auto_ptr<Geometry> difference3D( const Geometry& ga, const Geometry& gb, No
     GeometrySet<3> filtered;
     output.filterCovered( filtered );
 
-    return filtered.recompose();
+    std::auto_ptr<Geometry> result( filtered.recompose() );
+    applyResultPrecision( *result );
+
+    return result;
 }
 
 std::auto_ptr<Geometry> difference3D( const Geometry& ga, const Geometry& gb )
@@ -428,4 +543,4 @@ std::auto_ptr<Geometry> difference3D( const Geometry& ga, const Geometry& gb )
     return difference3D( ga, gb, NoValidityCheck() );
 }
 }
-}
+SFCGAL_END_NAMESPACE
@@ -25,7 +25,7 @@
 
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
 namespace detail {
 template <int Dim> class GeometrySet;
@@ -72,6 +72,6 @@ template <int Dim>
 void difference( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b, detail::GeometrySet<Dim>& );
 
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
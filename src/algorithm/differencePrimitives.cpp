@@ -21,12 +21,12 @@
 #include <SFCGAL/Triangle.h>
 // GOTCHA do not include the header, this is a trick to avoid ambiguous def in CGAL
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 CGAL::Object intersection( const CGAL::Triangle_3<Kernel>& a, const CGAL::Triangle_3<Kernel>& b )
 {
     return CGAL::intersection( a, b );
 }
 }
-}
+SFCGAL_END_NAMESPACE
 
@@ -36,7 +36,7 @@
 
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 namespace algorithm {
 
@@ -524,6 +524,7 @@ OutputIteratorType difference( const Triangle_3& p, const Triangle_3& q, OutputI
 template < typename VolumeOutputIteratorType>
 VolumeOutputIteratorType difference( const MarkedPolyhedron& a, const MarkedPolyhedron& b, VolumeOutputIteratorType out )
 {
+    requireExactConstructions( "volume difference" );
     MarkedPolyhedron& p = const_cast<MarkedPolyhedron&>( a );
     MarkedPolyhedron& q = const_cast<MarkedPolyhedron&>( b );
     typedef CGAL::Polyhedron_corefinement<MarkedPolyhedron> Corefinement;
@@ -786,6 +787,7 @@ TriangleOutputIteratorType difference( const Triangle_3& triangle, const MarkedP
 template < typename PolygonOutputIteratorType>
 PolygonOutputIteratorType difference( const PolygonWH_2& a, const PolygonWH_2& b, PolygonOutputIteratorType out )
 {
+    requireExactConstructions( "polygon difference" );
     CGAL::Gps_segment_traits_2<Kernel> traits;
 
     std::vector< PolygonWH_2 > temp;
@@ -805,5 +807,5 @@ PolygonOutputIteratorType difference( const PolygonWH_2& a, const PolygonWH_2& b
 
 
 }
-}
+SFCGAL_END_NAMESPACE
 #endif
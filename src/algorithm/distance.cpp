@@ -28,6 +28,7 @@
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/PreparedGeometry.h>
 
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/Kernel.h>
@@ -38,6 +39,7 @@
 
 #include <SFCGAL/detail/transform/AffineTransform3.h>
 #include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
 
@@ -50,7 +52,7 @@ typedef CGAL::Polygon_with_holes_2< SFCGAL::Kernel >              Polygon_with_h
 
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -97,6 +99,38 @@ double distance( const Geometry& gA, const Geometry& gB )
     return distance( gA, gB, NoValidityCheck() );
 }
 
+///
+///
+///
+double distance( const PreparedGeometry& gA, const Geometry& gB )
+{
+    gA.assertValidity2D();
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gB );
+
+    const detail::PreparedGeometrySet<2> gsb( gB );
+
+    if ( intersects( gA.geometrySet2D(), gsb ) ) {
+        return 0.0 ;
+    }
+
+    return distance( gA.geometry(), gB, NoValidityCheck() );
+}
+
+///
+///
+///
+double distance( const PreparedGeometry& gA, const PreparedGeometry& gB )
+{
+    gA.assertValidity2D();
+    gB.assertValidity2D();
+
+    if ( intersects( gA.geometrySet2D(), gB.geometrySet2D() ) ) {
+        return 0.0 ;
+    }
+
+    return distance( gA.geometry(), gB.geometry(), NoValidityCheck() );
+}
+
 ///
 ///
 ///
@@ -609,4 +643,4 @@ double distanceSegmentSegment( const Point& a, const Point& b, const Point& c, c
 
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
@@ -26,7 +26,8 @@
 #include <SFCGAL/Geometry.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
+class PreparedGeometry;
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -47,6 +48,23 @@ SFCGAL_API double distance( const Geometry& gA, const Geometry& gB ) ;
  */
 SFCGAL_API double distance( const Geometry& gA, const Geometry& gB, NoValidityCheck ) ;
 
+/**
+ * Compute the distance between two Geometries, reusing the decomposition and the validity check
+ * cached in the prepared geometry (intersecting geometries are detected without computing distances)
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance( const PreparedGeometry& gA, const Geometry& gB ) ;
+
+/**
+ * Compute the distance between two prepared Geometries
+ * @ingroup public_api
+ * @pre gA is a valid geometry
+ * @pre gB is a valid geometry
+ */
+SFCGAL_API double distance( const PreparedGeometry& gA, const PreparedGeometry& gB ) ;
+
 /**
  * dispatch distance from Point to Geometry
  * @ingroup detail
@@ -137,6 +155,6 @@ SFCGAL_API double distancePointSegment( const Point& p, const Point& a, const Po
 SFCGAL_API double distanceSegmentSegment( const Point& a, const Point& b, const Point& c, const Point& d );
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
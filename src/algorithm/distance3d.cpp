@@ -32,8 +32,6 @@
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/detail/tools/Log.h>
 
-#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
-
 #include <SFCGAL/detail/transform/AffineTransform3.h>
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/isValid.h>
@@ -41,7 +39,7 @@
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
 
-typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel ;
+typedef SFCGAL::Kernel                                    Kernel ;
 typedef Kernel::FT                                        squared_distance_t ;
 
 typedef Kernel::Point_3                                   Point_3 ;
@@ -50,7 +48,7 @@ typedef Kernel::Segment_3                                 Segment_3 ;
 typedef Kernel::Triangle_3                                Triangle_3 ;
 typedef Kernel::Plane_3                                   Plane_3 ;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -874,4 +872,4 @@ double distanceTriangleTriangle3D( const Triangle& gA, const Triangle& gB )
 
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
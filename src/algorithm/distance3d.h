@@ -25,7 +25,7 @@
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -173,6 +173,6 @@ SFCGAL_API double distanceTriangleTriangle3D( const Triangle& gA, const Triangle
 
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
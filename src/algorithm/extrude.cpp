@@ -43,7 +43,7 @@
 #include <SFCGAL/detail/tools/Log.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 //-- private interface
@@ -244,12 +244,12 @@ Solid*    extrude( const TriangulatedSurface& g, const Kernel::Vector_3& v )
 
     //bottom and top
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        Triangle bottomPart( g.geometryN( i ) );
+        Triangle bottomPart( g.triangleN( i ).toTriangle() );
         force3D( bottomPart );
         bottomPart.reverse() ;
         result->exteriorShell().addPolygon( bottomPart );
 
-        Triangle topPart( g.geometryN( i ) );
+        Triangle topPart( g.triangleN( i ).toTriangle() );
         force3D( topPart );
         translate( topPart, v );
         result->exteriorShell().addPolygon( topPart );
@@ -366,6 +366,7 @@ std::auto_ptr< Geometry > extrude( const Geometry& g, Kernel::FT dx, Kernel::FT
     return extrude( g, dx, dy, dz, NoValidityCheck() );
 }
 
+#ifndef SFCGAL_USE_INEXACT_KERNEL
 SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, const double& dx, const double& dy, const double& dz )
 {
     if ( !std::isfinite( dx ) || !std::isfinite( dy ) || !std::isfinite( dz ) ) {
@@ -374,7 +375,8 @@ SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, const double& d
 
     return extrude( g, Kernel::FT( dx ), Kernel::FT( dy ), Kernel::FT( dz ) );
 }
+#endif
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
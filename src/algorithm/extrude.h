@@ -26,7 +26,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -45,6 +45,7 @@ SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, Kernel::FT dx,
  */
 SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, Kernel::FT dx, Kernel::FT dy, Kernel::FT dz, NoValidityCheck ) ;
 
+#ifndef SFCGAL_USE_INEXACT_KERNEL
 /**
  * extrude a Geometry with a direction
  * @pre g is a valid geometry
@@ -53,6 +54,7 @@ SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, Kernel::FT dx,
  * @warning No actual validity check is done.
  */
 SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, const double& dx, const double& dy, const double& dz );
+#endif
 
 /**
  * @brief extrude a Geometry by a given vector
@@ -63,6 +65,6 @@ SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, const double& d
 SFCGAL_API std::auto_ptr< Geometry > extrude( const Geometry& g, const Kernel::Vector_3& v ) ;
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
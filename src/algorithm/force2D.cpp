@@ -21,7 +21,7 @@
 #include <SFCGAL/algorithm/force2D.h>
 #include <SFCGAL/detail/transform/Force2D.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -34,5 +34,5 @@ void force2D( Geometry& g )
 }
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
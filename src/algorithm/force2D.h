@@ -25,11 +25,11 @@
 
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -39,6 +39,6 @@ namespace algorithm {
 SFCGAL_API void force2D( Geometry& g );
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,7 +21,7 @@
 #include <SFCGAL/algorithm/force3D.h>
 #include <SFCGAL/detail/transform/ForceZ.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -34,5 +34,5 @@ void force3D( Geometry& g, const Kernel::FT& defaultZ )
 }
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -25,19 +25,28 @@
 #include <SFCGAL/algorithm/collectionHomogenize.h>
 #include <SFCGAL/detail/tools/Registry.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/detail/parallelFor.h>
+#include <SFCGAL/detail/PrimitiveCopies.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/ExecutionPolicy.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/snapRound.h>
 
 #include <CGAL/Boolean_set_operations_2.h>
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 #include <CGAL/box_intersection_d.h>
 
+#include <boost/noncopyable.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
 //
 // Intersection kernel
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 typedef CGAL::Point_2<Kernel> Point_2;
 typedef CGAL::Segment_2<Kernel> Segment_2;
@@ -86,6 +95,98 @@ struct intersection_cb {
     GeometrySet<Dim>& output;
 };
 
+//
+// gathers the candidate pairs, in the order of CGAL::box_intersection_d
+template <int Dim>
+struct collect_pairs_cb {
+    typedef std::vector< std::pair< const PrimitiveHandle<Dim>*, const PrimitiveHandle<Dim>* > > Pairs ;
+
+    collect_pairs_cb( Pairs& pairs_ ) : pairs( pairs_ ) {}
+
+    void operator()( const typename PrimitiveBox<Dim>::Type& a,
+                     const typename PrimitiveBox<Dim>::Type& b ) {
+        pairs.push_back( std::make_pair( a.handle(), b.handle() ) );
+    }
+
+    Pairs& pairs;
+};
+
+//
+// a share of the candidate pairs, computed by a thread on its own copies of the primitives
+template <int Dim>
+struct PairBlock : boost::noncopyable {
+    PrimitiveCopies<Dim> copies;
+    typename collect_pairs_cb<Dim>::Pairs pairs;
+    // index of each pair in the candidate pairs (and in the outputs)
+    std::vector< size_t > indices;
+};
+
+//
+// intersection of the pairs of the k-th block, each in its own output
+template <int Dim>
+struct block_intersection {
+    block_intersection( const boost::ptr_vector< PairBlock<Dim> >& blocks_,
+                        std::vector< GeometrySet<Dim> >& outputs_ ) :
+        blocks( blocks_ ), outputs( outputs_ ) {}
+
+    void operator()( const size_t& k ) const {
+        const PairBlock<Dim>& block = blocks[k];
+
+        for ( size_t j = 0; j < block.pairs.size(); j++ ) {
+            dispatch_intersection_sym<Dim>( *block.pairs[j].first, *block.pairs[j].second, outputs[block.indices[j]] );
+        }
+    }
+
+    const boost::ptr_vector< PairBlock<Dim> >& blocks;
+    std::vector< GeometrySet<Dim> >& outputs;
+};
+
+//
+// intersection of the candidate pairs shared between threads, the outputs are merged in the order of the pairs
+template <int Dim>
+void intersection( const typename collect_pairs_cb<Dim>::Pairs& pairs, const size_t& numThreads, GeometrySet<Dim>& output )
+{
+    if ( numThreads <= 1 ) {
+        for ( size_t i = 0; i < pairs.size(); i++ ) {
+            dispatch_intersection_sym<Dim>( *pairs[i].first, *pairs[i].second, output );
+        }
+
+        return ;
+    }
+
+    std::vector< GeometrySet<Dim> > outputs( pairs.size() );
+    std::vector< size_t > shared ;
+
+    for ( size_t i = 0; i < pairs.size(); i++ ) {
+        // the corefinement modifies the polyhedra, the pairs with a volume are computed in this thread
+        if ( pairs[i].first->handle.which() == PrimitiveVolume || pairs[i].second->handle.which() == PrimitiveVolume ) {
+            dispatch_intersection_sym<Dim>( *pairs[i].first, *pairs[i].second, outputs[i] );
+        }
+        else {
+            shared.push_back( i );
+        }
+    }
+
+    // the threads can't share the lazy exact numbers, each block of pairs gets its own copies
+    const size_t numBlocks = numCopyBlocks( shared.size(), numThreads );
+    boost::ptr_vector< PairBlock<Dim> > blocks ;
+
+    for ( size_t b = 0; b < numBlocks; b++ ) {
+        blocks.push_back( new PairBlock<Dim>() );
+        PairBlock<Dim>& block = blocks.back();
+
+        for ( size_t k = shared.size() * b / numBlocks; k < shared.size() * ( b + 1 ) / numBlocks; k++ ) {
+            const size_t i = shared[k];
+            block.pairs.push_back( std::make_pair( block.copies.copy( pairs[i].first ), block.copies.copy( pairs[i].second ) ) );
+            block.indices.push_back( i );
+        }
+    }
+
+    detail::parallelFor( blocks.size(), block_intersection<Dim>( blocks, outputs ), numThreads );
+
+    output.merge( outputs );
+}
+
 /**
  * intersection post processing
  */
@@ -129,6 +230,36 @@ void post_intersection( const GeometrySet<3>& input, GeometrySet<3>& output )
     output = input;
 }
 
+//
+// intersection of the primitives of boxes (reordered by CGAL::box_intersection_d)
+template <int Dim>
+void intersection( typename SFCGAL::detail::BoxCollection<Dim>::Type& aboxes,
+                   typename SFCGAL::detail::BoxCollection<Dim>::Type& bboxes,
+                   GeometrySet<Dim>& output )
+{
+    GeometrySet<Dim> temp, temp2;
+    const ExecutionPolicy policy = ExecutionPolicy::current();
+
+    if ( policy.numThreads() == 1 ) {
+        intersection_cb<Dim> cb( temp );
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                                  bboxes.begin(), bboxes.end(),
+                                  cb );
+    }
+    else {
+        typename collect_pairs_cb<Dim>::Pairs pairs;
+        collect_pairs_cb<Dim> cb( pairs );
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                                  bboxes.begin(), bboxes.end(),
+                                  cb );
+
+        intersection<Dim>( pairs, policy.threadsFor( pairs.size() ), temp );
+    }
+
+    post_intersection( temp, temp2 );
+    output.merge( temp2 );
+}
+
 template <int Dim>
 void intersection( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, GeometrySet<Dim>& output )
 {
@@ -137,19 +268,41 @@ void intersection( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b, Geometr
     a.computeBoundingBoxes( ahandles, aboxes );
     b.computeBoundingBoxes( bhandles, bboxes );
 
-    GeometrySet<Dim> temp, temp2;
-    intersection_cb<Dim> cb( temp );
-    CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
-                              bboxes.begin(), bboxes.end(),
-                              cb );
+    intersection<Dim>( aboxes, bboxes, output );
+}
 
-    post_intersection( temp, temp2 );
-    output.merge( temp2 );
+template <int Dim>
+void intersection( const PreparedGeometrySet<Dim>& a, const PreparedGeometrySet<Dim>& b, GeometrySet<Dim>& output )
+{
+    // the prepared boxes are shared, they must not be reordered
+    typename SFCGAL::detail::BoxCollection<Dim>::Type aboxes( a.boxes() ), bboxes( b.boxes() );
+
+    intersection<Dim>( aboxes, bboxes, output );
 }
 
 template void intersection<2>( const GeometrySet<2>& a, const GeometrySet<2>& b, GeometrySet<2>& );
 template void intersection<3>( const GeometrySet<3>& a, const GeometrySet<3>& b, GeometrySet<3>& );
 
+template void intersection<2>( const PreparedGeometrySet<2>& a, const PreparedGeometrySet<2>& b, GeometrySet<2>& );
+template void intersection<3>( const PreparedGeometrySet<3>& a, const PreparedGeometrySet<3>& b, GeometrySet<3>& );
+
+//
+// filters and recomposes the intersection of prepared sets
+template <int Dim>
+std::auto_ptr<Geometry> intersection( const PreparedGeometrySet<Dim>& a, const PreparedGeometrySet<Dim>& b )
+{
+    GeometrySet<Dim> output;
+    algorithm::intersection( a, b, output );
+
+    GeometrySet<Dim> filtered;
+    output.filterCovered( filtered );
+
+    std::auto_ptr<Geometry> result( filtered.recompose() );
+    applyResultPrecision( *result );
+
+    return result;
+}
+
 std::auto_ptr<Geometry> intersection( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
     GeometrySet<2> gsa( ga ), gsb( gb ), output;
@@ -157,7 +310,10 @@ std::auto_ptr<Geometry> intersection( const Geometry& ga, const Geometry& gb, No
 
     GeometrySet<2> filtered;
     output.filterCovered( filtered );
-    return filtered.recompose();
+    std::auto_ptr<Geometry> result( filtered.recompose() );
+    applyResultPrecision( *result );
+
+    return result;
 }
 
 std::auto_ptr<Geometry> intersection( const Geometry& ga, const Geometry& gb )
@@ -176,7 +332,10 @@ std::auto_ptr<Geometry> intersection3D( const Geometry& ga, const Geometry& gb,
     GeometrySet<3> filtered;
     output.filterCovered( filtered );
 
-    return filtered.recompose();
+    std::auto_ptr<Geometry> result( filtered.recompose() );
+    applyResultPrecision( *result );
+
+    return result;
 }
 
 std::auto_ptr<Geometry> intersection3D( const Geometry& ga, const Geometry& gb )
@@ -186,5 +345,39 @@ std::auto_ptr<Geometry> intersection3D( const Geometry& ga, const Geometry& gb )
 
     return intersection3D( ga, gb, NoValidityCheck() );
 }
+
+std::auto_ptr<Geometry> intersection( const PreparedGeometry& ga, const Geometry& gb )
+{
+    ga.assertValidity2D();
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    const PreparedGeometrySet<2> gsb( gb );
+    return intersection( ga.geometrySet2D(), gsb );
+}
+
+std::auto_ptr<Geometry> intersection( const PreparedGeometry& ga, const PreparedGeometry& gb )
+{
+    ga.assertValidity2D();
+    gb.assertValidity2D();
+
+    return intersection( ga.geometrySet2D(), gb.geometrySet2D() );
+}
+
+std::auto_ptr<Geometry> intersection3D( const PreparedGeometry& ga, const Geometry& gb )
+{
+    ga.assertValidity3D();
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    const PreparedGeometrySet<3> gsb( gb );
+    return intersection( ga.geometrySet3D(), gsb );
+}
+
+std::auto_ptr<Geometry> intersection3D( const PreparedGeometry& ga, const PreparedGeometry& gb )
+{
+    ga.assertValidity3D();
+    gb.assertValidity3D();
+
+    return intersection( ga.geometrySet3D(), gb.geometrySet3D() );
 }
 }
+SFCGAL_END_NAMESPACE
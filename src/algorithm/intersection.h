@@ -25,10 +25,12 @@
 
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
+class PreparedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
+template <int Dim> class PreparedGeometrySet;
 template <int Dim> struct PrimitiveHandle;
 }
 
@@ -65,12 +67,48 @@ SFCGAL_API std::auto_ptr<Geometry> intersection3D( const Geometry& ga, const Geo
  */
 SFCGAL_API std::auto_ptr<Geometry> intersection3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Intersection on 2D geometries, reusing the decomposition and the validity check
+ * cached in the prepared geometry.
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> intersection( const PreparedGeometry& ga, const Geometry& gb );
+
+/**
+ * Intersection on 2D prepared geometries.
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> intersection( const PreparedGeometry& ga, const PreparedGeometry& gb );
+
+/**
+ * Intersection on 3D geometries, reusing the decomposition and the validity check
+ * cached in the prepared geometry. Assume z = 0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> intersection3D( const PreparedGeometry& ga, const Geometry& gb );
+
+/**
+ * Intersection on 3D prepared geometries. Assume z = 0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> intersection3D( const PreparedGeometry& ga, const PreparedGeometry& gb );
+
 /**
  * @ingroup detail
  */
 template <int Dim>
 void intersection( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b, detail::GeometrySet<Dim>& );
 
+/**
+ * @ingroup detail
+ */
+template <int Dim>
+void intersection( const detail::PreparedGeometrySet<Dim>& a, const detail::PreparedGeometrySet<Dim>& b, detail::GeometrySet<Dim>& );
+
 /**
  * @ingroup detail
  */
@@ -78,6 +116,6 @@ template <int Dim>
 void intersection( const detail::PrimitiveHandle<Dim>& a, const detail::PrimitiveHandle<Dim>& b, detail::GeometrySet<Dim>& );
 
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -29,19 +29,22 @@
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/detail/triangulate/triangulateInGeometrySet.h>
 #include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/detail/algorithm/findBoxIntersection.h>
+#include <SFCGAL/detail/algorithm/convexPolygons.h>
+#include <SFCGAL/PreparedGeometry.h>
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/Exception.h>
+#include <SFCGAL/FilterStatistics.h>
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/PolyhedralSurface.h>
 
-#include <CGAL/box_intersection_d.h>
-
 #include <CGAL/Point_inside_polyhedron_3.h>
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 //
 // Type of pa must be of larger dimension than type of pb
@@ -160,6 +163,13 @@ bool _intersects( const PrimitiveHandle<2>& pa, const PrimitiveHandle<2>& pb )
         const CGAL::Polygon_with_holes_2<Kernel>* poly1 = pa.as<CGAL::Polygon_with_holes_2<Kernel> >();
         const CGAL::Polygon_with_holes_2<Kernel>* poly2 = pb.as<CGAL::Polygon_with_holes_2<Kernel> >();
 
+        // shortcut for convex polygons
+        detail::algorithm::ConvexVertices convex1, convex2;
+
+        if ( detail::algorithm::convexVertices( *poly1, convex1 ) && detail::algorithm::convexVertices( *poly2, convex2 ) ) {
+            return detail::algorithm::intersectsConvex( convex1, convex2 );
+        }
+
         // 1. if rings intersects, returns true
         // 2. else, if poly1 is inside poly2 or poly1 inside poly2 (but not in holes), returns true
 
@@ -347,18 +357,25 @@ bool intersects( const PrimitiveHandle<Dim>& pa, const PrimitiveHandle<Dim>& pb
     return dispatch_intersects_sym( pa, pb );
 }
 
-struct found_an_intersection {};
-
 template <int Dim>
 struct intersects_cb {
-    void operator()( const typename PrimitiveBox<Dim>::Type& a,
-                     const typename PrimitiveBox<Dim>::Type& b ) {
-        if ( dispatch_intersects_sym( *a.handle(), *b.handle() ) ) {
-            throw found_an_intersection();
-        }
+    bool operator()( const typename PrimitiveBox<Dim>::Type& a,
+                     const typename PrimitiveBox<Dim>::Type& b ) const {
+        return dispatch_intersects_sym( *a.handle(), *b.handle() );
     }
 };
 
+//
+// intersection test on boxes (reordered by the traversal), stops on the first intersecting primitives
+template <int Dim>
+bool intersects( typename SFCGAL::detail::BoxCollection<Dim>::Type& aboxes,
+                 typename SFCGAL::detail::BoxCollection<Dim>::Type& bboxes )
+{
+    return detail::algorithm::findBoxIntersection( aboxes.begin(), aboxes.end(),
+            bboxes.begin(), bboxes.end(),
+            intersects_cb<Dim>() );
+}
+
 template <int Dim>
 bool intersects( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
 {
@@ -367,22 +384,24 @@ bool intersects( const GeometrySet<Dim>& a, const GeometrySet<Dim>& b )
     a.computeBoundingBoxes( ahandles, aboxes );
     b.computeBoundingBoxes( bhandles, bboxes );
 
-    try {
-        intersects_cb<Dim> cb;
-        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
-                                  bboxes.begin(), bboxes.end(),
-                                  cb );
-    }
-    catch ( found_an_intersection& e ) {
-        return true;
-    }
+    return intersects<Dim>( aboxes, bboxes );
+}
 
-    return false;
+template <int Dim>
+bool intersects( const PreparedGeometrySet<Dim>& a, const PreparedGeometrySet<Dim>& b )
+{
+    // the prepared boxes are shared, they must not be reordered
+    typename SFCGAL::detail::BoxCollection<Dim>::Type aboxes( a.boxes() ), bboxes( b.boxes() );
+
+    return intersects<Dim>( aboxes, bboxes );
 }
 
 template bool intersects<2>( const GeometrySet<2>& a, const GeometrySet<2>& b );
 template bool intersects<3>( const GeometrySet<3>& a, const GeometrySet<3>& b );
 
+template bool intersects<2>( const PreparedGeometrySet<2>& a, const PreparedGeometrySet<2>& b );
+template bool intersects<3>( const PreparedGeometrySet<3>& a, const PreparedGeometrySet<3>& b );
+
 template bool intersects<2>( const PrimitiveHandle<2>& a, const PrimitiveHandle<2>& b );
 template bool intersects<3>( const PrimitiveHandle<3>& a, const PrimitiveHandle<3>& b );
 
@@ -391,6 +410,8 @@ bool intersects( const Geometry& ga, const Geometry& gb )
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( ga );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
 
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
     GeometrySet<2> gsa( ga );
     GeometrySet<2> gsb( gb );
 
@@ -402,6 +423,8 @@ bool intersects3D( const Geometry& ga, const Geometry& gb )
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( ga );
     SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
 
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
     GeometrySet<3> gsa( ga );
     GeometrySet<3> gsb( gb );
 
@@ -410,6 +433,8 @@ bool intersects3D( const Geometry& ga, const Geometry& gb )
 
 bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
     GeometrySet<2> gsa( ga );
     GeometrySet<2> gsb( gb );
 
@@ -418,12 +443,58 @@ bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 
 bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
     GeometrySet<3> gsa( ga );
     GeometrySet<3> gsb( gb );
 
     return intersects( gsa, gsb );
 }
 
+bool intersects( const PreparedGeometry& ga, const Geometry& gb )
+{
+    ga.assertValidity2D();
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( gb );
+
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
+    const PreparedGeometrySet<2> gsb( gb );
+
+    return intersects( ga.geometrySet2D(), gsb );
+}
+
+bool intersects( const PreparedGeometry& ga, const PreparedGeometry& gb )
+{
+    ga.assertValidity2D();
+    gb.assertValidity2D();
+
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
+    return intersects( ga.geometrySet2D(), gb.geometrySet2D() );
+}
+
+bool intersects3D( const PreparedGeometry& ga, const Geometry& gb )
+{
+    ga.assertValidity3D();
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( gb );
+
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
+    const PreparedGeometrySet<3> gsb( gb );
+
+    return intersects( ga.geometrySet3D(), gsb );
+}
+
+bool intersects3D( const PreparedGeometry& ga, const PreparedGeometry& gb )
+{
+    ga.assertValidity3D();
+    gb.assertValidity3D();
+
+    SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+
+    return intersects( ga.geometrySet3D(), gb.geometrySet3D() );
+}
+
 template< int Dim >
 bool selfIntersectsImpl( const LineString& line )
 {
@@ -562,11 +633,19 @@ bool selfIntersectsImpl( const TriangulatedSurface& tin, const SurfaceGraph& gra
 {
     size_t numTriangles = tin.numTriangles();
 
+    // triangles are converted once, not in the inner loop
+    std::vector< Triangle > triangles ;
+    triangles.reserve( numTriangles );
+
+    for ( size_t t=0; t != numTriangles; ++t ) {
+        triangles.push_back( tin.triangleN( t ).toTriangle() );
+    }
+
     for ( size_t ti=0; ti != numTriangles; ++ti ) {
         for ( size_t tj=ti+1; tj < numTriangles; ++tj ) {
             std::auto_ptr< Geometry > inter = Dim == 3
-                                              ? intersection3D( tin.triangleN( ti ), tin.triangleN( tj ) )
-                                              : intersection( tin.triangleN( ti ), tin.triangleN( tj ) ) ;
+                                              ? intersection3D( triangles[ti], triangles[tj] )
+                                              : intersection( triangles[ti], triangles[tj] ) ;
 
             if ( !inter->isEmpty() ) {
                 // two cases:
@@ -607,4 +686,4 @@ bool selfIntersects3D( const TriangulatedSurface& tin, const SurfaceGraph& g )
 }
 
 }
-}
+SFCGAL_END_NAMESPACE
@@ -23,13 +23,15 @@
 
 #include <SFCGAL/config.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
 class LineString;
 class PolyhedralSurface;
 class TriangulatedSurface;
+class PreparedGeometry;
 namespace detail {
 template <int Dim> class GeometrySet;
+template <int Dim> class PreparedGeometrySet;
 template <int Dim> struct PrimitiveHandle;
 }
 
@@ -68,6 +70,36 @@ SFCGAL_API bool intersects( const Geometry& ga, const Geometry& gb, NoValidityCh
  */
 SFCGAL_API bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Robust intersection test on 2D geometries, reusing the decomposition and the validity check
+ * cached in the prepared geometry. Force projection to z=0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects( const PreparedGeometry& ga, const Geometry& gb );
+
+/**
+ * Robust intersection test on 2D prepared geometries. Force projection to z=0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects( const PreparedGeometry& ga, const PreparedGeometry& gb );
+
+/**
+ * Robust intersection test on 3D geometries, reusing the decomposition and the validity check
+ * cached in the prepared geometry. Assume z = 0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects3D( const PreparedGeometry& ga, const Geometry& gb );
+
+/**
+ * Robust intersection test on 3D prepared geometries. Assume z = 0 if needed
+ * @pre ga and gb are valid geometries
+ * @ingroup public_api
+ */
+SFCGAL_API bool intersects3D( const PreparedGeometry& ga, const PreparedGeometry& gb );
+
 /**
  * Intersection test on GeometrySet
  * @ingroup detail
@@ -75,6 +107,13 @@ SFCGAL_API bool intersects3D( const Geometry& ga, const Geometry& gb, NoValidity
 template <int Dim>
 bool intersects( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b );
 
+/**
+ * Intersection test on GeometrySet with precomputed bounding boxes
+ * @ingroup detail
+ */
+template <int Dim>
+bool intersects( const detail::PreparedGeometrySet<Dim>& a, const detail::PreparedGeometrySet<Dim>& b );
+
 /**
  * Intersection test on a PrimitiveHandle
  * @ingroup detail
@@ -119,5 +158,5 @@ bool selfIntersects( const TriangulatedSurface& s, const SurfaceGraph& g );
  */
 bool selfIntersects3D( const TriangulatedSurface& s, const SurfaceGraph& g );
 }
-}
+SFCGAL_END_NAMESPACE
 #endif
@@ -30,6 +30,7 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/FilterStatistics.h>
 
 #include <SFCGAL/algorithm/intersects.h>
 #include <SFCGAL/algorithm/intersection.h>
@@ -52,7 +53,7 @@
 
 using namespace SFCGAL::detail::algorithm;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 bool SKIP_GEOM_VALIDATION = false;
@@ -325,7 +326,7 @@ const Validity isValid( const TriangulatedSurface& tin, const SurfaceGraph& grap
     size_t numTriangles = tin.numTriangles();
 
     for ( size_t t=0; t != numTriangles; ++t ) {
-        Validity v = isValid( tin.triangleN( t ), toleranceAbs );
+        Validity v = isValid( tin.triangleN( t ).toTriangle(), toleranceAbs );
 
         if ( !v ) return Validity::invalid(
                                  ( boost::format( "Triangle %d is invalid: %s" ) % t % v.reason() ).str()
@@ -440,6 +441,8 @@ const Validity isValid( const MultiSolid& ms, const double& toleranceAbs )
 
 const Validity isValid( const Geometry& g, const double& toleranceAbs )
 {
+    SFCGAL_FILTER_STATISTICS_SCOPE( IS_VALID );
+
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
         return isValid( g.as< Point >() );
@@ -485,4 +488,4 @@ const Validity isValid( const Geometry& g, const double& toleranceAbs )
 }
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
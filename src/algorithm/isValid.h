@@ -26,7 +26,7 @@
 #include <SFCGAL/algorithm/force2D.h>
 #include <SFCGAL/algorithm/force3D.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 extern bool SKIP_GEOM_VALIDATION;
@@ -103,7 +103,7 @@ SFCGAL_API const Validity isValid( const Geometry& g, const double& toleranceAbs
 struct NoValidityCheck {};
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
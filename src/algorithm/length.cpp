@@ -25,7 +25,7 @@
 
 #include <SFCGAL/Exception.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -171,5 +171,5 @@ double length3D( const Geometry& g )
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
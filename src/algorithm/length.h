@@ -23,13 +23,13 @@
 
 #include <SFCGAL/config.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
 class LineString ;
 class GeometryCollection ;
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -61,7 +61,7 @@ SFCGAL_API double length3D( const GeometryCollection& g ) ;
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
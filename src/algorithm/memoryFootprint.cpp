@@ -0,0 +1,178 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/memoryFootprint.h>
+#include <SFCGAL/detail/MemoryFootprintVisitor.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/detail/lazyBytes.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+///
+///
+///
+MemoryFootprint memoryFootprint( const Geometry& g )
+{
+    detail::MemoryFootprintVisitor visitor ;
+    g.accept( visitor ) ;
+
+    MemoryFootprint footprint ;
+    footprint.structuralBytes = visitor.structuralBytes ;
+    footprint.exactBytes      = visitor.exactBytes ;
+    footprint.numLazyNodes    = visitor.numLazyNodes ;
+    return footprint ;
+}
+
+namespace {
+
+//
+// footprint being counted and the lazy exact nodes already counted (shared between the geometry
+// and its decompositions)
+//
+struct FootprintCount {
+    MemoryFootprint    footprint ;
+    detail::LazyRepSet counted ;
+
+    template < typename Lazy >
+    void addLazy( const Lazy& o ) {
+        footprint.exactBytes += detail::lazyBytes( o, counted, footprint.numLazyNodes ) ;
+    }
+};
+
+///
+/// a ring of a polygon with holes and its points
+///
+void ringFootprint( const CGAL::Polygon_2< Kernel >& ring, FootprintCount& count )
+{
+    count.footprint.structuralBytes += ring.size() * sizeof( Kernel::Point_2 ) ;
+
+    for ( CGAL::Polygon_2< Kernel >::Vertex_const_iterator it = ring.vertices_begin(); it != ring.vertices_end(); ++it ) {
+        count.addLazy( *it ) ;
+    }
+}
+
+///
+/// points of a 2D surface (the element itself is counted by its collection)
+///
+void surfaceFootprint( const CGAL::Polygon_with_holes_2< Kernel >& surface, FootprintCount& count )
+{
+    ringFootprint( surface.outer_boundary(), count );
+
+    for ( CGAL::Polygon_with_holes_2< Kernel >::Hole_const_iterator it = surface.holes_begin(); it != surface.holes_end(); ++it ) {
+        // holes are list nodes
+        count.footprint.structuralBytes += sizeof( CGAL::Polygon_2< Kernel > ) + 2 * sizeof( void* ) ;
+        ringFootprint( *it, count );
+    }
+}
+
+///
+/// lazy representation of a 3D surface
+///
+void surfaceFootprint( const Kernel::Triangle_3& surface, FootprintCount& count )
+{
+    count.addLazy( surface ) ;
+}
+
+void volumeFootprint( const detail::NoVolume&, FootprintCount& )
+{
+}
+
+///
+/// items and points of a polyhedron
+///
+void volumeFootprint( const detail::MarkedPolyhedron& volume, FootprintCount& count )
+{
+    count.footprint.structuralBytes += volume.size_of_vertices() * sizeof( detail::MarkedPolyhedron::Vertex )
+                                       + volume.size_of_halfedges() * sizeof( detail::MarkedPolyhedron::Halfedge )
+                                       + volume.size_of_facets() * sizeof( detail::MarkedPolyhedron::Facet ) ;
+
+    for ( detail::MarkedPolyhedron::Vertex_const_iterator it = volume.vertices_begin(); it != volume.vertices_end(); ++it ) {
+        count.addLazy( it->point() ) ;
+    }
+}
+
+///
+/// primitives, handles and boxes of a decomposition
+///
+template < int Dim >
+void preparedGeometrySetFootprint( const detail::PreparedGeometrySet<Dim>& prepared, FootprintCount& count )
+{
+    typedef detail::GeometrySet<Dim> GeometrySet ;
+    const GeometrySet& gs = prepared.geometrySet() ;
+
+    count.footprint.structuralBytes += sizeof( detail::PreparedGeometrySet<Dim> )
+                                       + gs.points().size() * sizeof( typename GeometrySet::PointCollection::value_type )
+                                       + gs.segments().size() * sizeof( typename GeometrySet::SegmentCollection::value_type )
+                                       + gs.surfaces().capacity() * sizeof( typename GeometrySet::SurfaceCollection::value_type )
+                                       + gs.volumes().size() * sizeof( typename GeometrySet::VolumeCollection::value_type )
+                                       + prepared.handles().capacity() * sizeof( typename detail::HandleCollection<Dim>::Type::value_type )
+                                       + prepared.boxes().capacity() * sizeof( typename detail::BoxCollection<Dim>::Type::value_type ) ;
+
+    for ( typename GeometrySet::PointCollection::const_iterator it = gs.points().begin(); it != gs.points().end(); ++it ) {
+        count.addLazy( it->primitive() ) ;
+    }
+
+    for ( typename GeometrySet::SegmentCollection::const_iterator it = gs.segments().begin(); it != gs.segments().end(); ++it ) {
+        count.addLazy( it->primitive() ) ;
+    }
+
+    for ( typename GeometrySet::SurfaceCollection::const_iterator it = gs.surfaces().begin(); it != gs.surfaces().end(); ++it ) {
+        surfaceFootprint( it->primitive(), count );
+    }
+
+    for ( typename GeometrySet::VolumeCollection::const_iterator it = gs.volumes().begin(); it != gs.volumes().end(); ++it ) {
+        volumeFootprint( it->primitive(), count );
+    }
+}
+
+}
+
+///
+///
+///
+MemoryFootprint memoryFootprint( const PreparedGeometry& g )
+{
+    detail::MemoryFootprintVisitor visitor ;
+    g.geometry().accept( visitor ) ;
+
+    FootprintCount count ;
+    count.footprint.structuralBytes = visitor.structuralBytes + sizeof( PreparedGeometry ) ;
+    count.footprint.exactBytes      = visitor.exactBytes ;
+    count.footprint.numLazyNodes    = visitor.numLazyNodes ;
+    count.counted.swap( visitor.countedLazyReps );
+
+    // the decompositions built by the algorithms on prepared geometries
+    if ( const detail::PreparedGeometrySet<2>* gs = g.cachedGeometrySet2D() ) {
+        preparedGeometrySetFootprint( *gs, count );
+    }
+
+    if ( const detail::PreparedGeometrySet<3>* gs = g.cachedGeometrySet3D() ) {
+        preparedGeometrySetFootprint( *gs, count );
+    }
+
+    return count.footprint ;
+}
+
+} // namespace algorithm
+SFCGAL_END_NAMESPACE
+
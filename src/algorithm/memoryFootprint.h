@@ -0,0 +1,88 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_MEMORYFOOTPRINT_H_
+#define _SFCGAL_ALGORITHM_MEMORYFOOTPRINT_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+class PreparedGeometry ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+/**
+ * @brief Memory used by a geometry
+ */
+struct SFCGAL_API MemoryFootprint {
+    MemoryFootprint():
+        structuralBytes( 0 ),
+        exactBytes( 0 ),
+        numLazyNodes( 0 ) {
+    }
+
+    /**
+     * bytes of the geometry objects and their containers
+     */
+    size_t structuralBytes ;
+    /**
+     * bytes of the exact number representations of the coordinates (lazy exact nodes,
+     * exact values and their GMP limbs), a node shared by several coordinates is counted once
+     */
+    size_t exactBytes ;
+    /**
+     * number of lazy exact nodes whose exact value is not computed. Each one keeps its
+     * construction history (operands) alive, which is not counted in exactBytes : CGAL
+     * doesn't expose the operands of a node. compactExact drops these histories.
+     */
+    size_t numLazyNodes ;
+
+    /**
+     * total number of bytes
+     */
+    inline size_t totalBytes() const {
+        return structuralBytes + exactBytes ;
+    }
+};
+
+/**
+ * @brief Returns the memory used by a geometry (estimated from the number of elements,
+ * the allocator overhead is not counted)
+ * @warning the exact values are not computed, only the top node of an unevaluated lazy
+ * construction history is counted in exactBytes, the others are reported by numLazyNodes
+ * (see compactExact)
+ */
+SFCGAL_API MemoryFootprint memoryFootprint( const Geometry& g );
+
+/**
+ * @brief Returns the memory used by a prepared geometry, including its cached decompositions
+ * (the lazy exact nodes shared by the geometry and its decompositions are counted once)
+ */
+SFCGAL_API MemoryFootprint memoryFootprint( const PreparedGeometry& g );
+
+} // namespace algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
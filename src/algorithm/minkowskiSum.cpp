@@ -45,7 +45,7 @@ typedef CGAL::Polygon_with_holes_2< SFCGAL::Kernel > Polygon_with_holes_2 ;
 typedef CGAL::Polygon_set_2< SFCGAL::Kernel >        Polygon_set_2 ;
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 //-- private interface
@@ -248,6 +248,17 @@ void minkowskiSum( const Solid& gA, const Polygon_2& gB, Polygon_set_2& polygonS
 ///
 void minkowskiSumCollection( const Geometry& gA, const Polygon_2& gB, Polygon_set_2& polygonSet )
 {
+    if ( gA.is< TriangulatedSurface >() ) {
+        // one triangle at a time, not the triangle cache of the mesh
+        const TriangulatedSurface& tin = gA.as< TriangulatedSurface >();
+
+        for ( size_t i = 0; i < tin.numTriangles(); i++ ) {
+            minkowskiSum( tin.triangleN( i ).toTriangle(), gB, polygonSet );
+        }
+
+        return ;
+    }
+
     for ( size_t i = 0; i < gA.numGeometries(); i++ ) {
         minkowskiSum( gA.geometryN( i ), gB, polygonSet );
     }
@@ -256,6 +267,8 @@ void minkowskiSumCollection( const Geometry& gA, const Polygon_2& gB, Polygon_se
 
 std::auto_ptr< Geometry > minkowskiSum( const Geometry& gA, const Polygon& gB, NoValidityCheck )
 {
+    requireExactConstructions( "minkowskiSum" );
+
     if ( gB.isEmpty() ) {
         return std::auto_ptr< Geometry >( gA.clone() );
     }
@@ -279,4 +292,4 @@ std::auto_ptr< Geometry > minkowskiSum( const Geometry& gA, const Polygon& gB )
 }
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
@@ -26,7 +26,7 @@
 #include <memory>
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -54,6 +54,6 @@ SFCGAL_API std::auto_ptr< Geometry > minkowskiSum( const Geometry& gA, const Pol
 SFCGAL_API std::auto_ptr< Geometry > minkowskiSum( const Geometry& gA, const Polygon& gB, NoValidityCheck ) ;
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
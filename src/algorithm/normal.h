@@ -25,7 +25,7 @@
 
 #include <SFCGAL/Polygon.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -83,7 +83,7 @@ CGAL::Vector_3< Kernel > normal3D( const Polygon& polygon, bool exact = true )
 }
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -24,6 +24,7 @@
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/Triangle.h>
 #include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/MultiPolygon.h>
 
@@ -56,7 +57,7 @@ typedef CGAL::General_polygon_set_2< Gps_traits_2 >            Offset_polygon_se
 
 #define SFCGAL_OFFSET_ASSERT_FINITE_RADIUS( r ) \
     if ( !std::isfinite(r) ) BOOST_THROW_EXCEPTION( NonFiniteValueException("radius is non finite") );
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 //-- private interface
@@ -293,6 +294,17 @@ void offsetCollection( const Geometry& g, const double& radius, Offset_polygon_s
 {
     SFCGAL_OFFSET_ASSERT_FINITE_RADIUS( radius );
 
+    if ( g.is< TriangulatedSurface >() ) {
+        // one triangle at a time, not the triangle cache of the mesh
+        const TriangulatedSurface& tin = g.as< TriangulatedSurface >();
+
+        for ( size_t i = 0; i < tin.numTriangles(); i++ ) {
+            offset( tin.triangleN( i ).toTriangle(), radius, polygonSet );
+        }
+
+        return ;
+    }
+
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         offset( g.geometryN( i ), radius, polygonSet );
     }
@@ -343,6 +355,7 @@ void offset( const Geometry& g, const double& radius, Offset_polygon_set_2& poly
 ///
 std::auto_ptr< MultiPolygon > offset( const Geometry& g, const double& r, NoValidityCheck )
 {
+    requireExactConstructions( "offset" );
     SFCGAL_OFFSET_ASSERT_FINITE_RADIUS( r );
     Offset_polygon_set_2 polygonSet ;
     offset( g, r, polygonSet ) ;
@@ -357,5 +370,5 @@ std::auto_ptr< MultiPolygon > offset( const Geometry& g, const double& r )
 }
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -25,12 +25,12 @@
 
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
 class MultiPolygon ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -54,6 +54,6 @@ SFCGAL_API std::auto_ptr< MultiPolygon > offset( const Geometry& g, const double
 SFCGAL_API std::auto_ptr< MultiPolygon > offset( const Geometry& g, const double& r, NoValidityCheck ) ;
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
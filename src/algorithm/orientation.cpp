@@ -28,7 +28,7 @@
 
 #include <SFCGAL/detail/graph/algorithm/orientation.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -156,6 +156,19 @@ bool isCounterClockWiseOriented( const Triangle& tri )
            ( tri.vertex( 2 ).y() - tri.vertex( 1 ).y() ) * ( tri.vertex( 0 ).x() - tri.vertex( 1 ).x() ) > 0;
 }
 
+///
+///
+///
+bool isCounterClockWiseOriented( const TriangulatedSurface& g, const size_t& n )
+{
+    const Point& a = g.triangleVertex( n, 0 );
+    const Point& b = g.triangleVertex( n, 1 );
+    const Point& c = g.triangleVertex( n, 2 );
+
+    return ( c.x() - b.x() ) * ( a.y() - b.y() ) -
+           ( c.y() - b.y() ) * ( a.x() - b.x() ) > 0;
+}
+
 ///
 ///
 ///
@@ -165,5 +178,5 @@ bool isCounterClockWiseOriented( const Polygon& poly )
 }
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
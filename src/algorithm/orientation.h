@@ -29,7 +29,7 @@
 #include <CGAL/Polygon_2.h>
 #include <CGAL/Polygon_with_holes_2.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -71,13 +71,18 @@ SFCGAL_API bool isCounterClockWiseOriented( const Polygon& );
  */
 SFCGAL_API bool isCounterClockWiseOriented( const Triangle& );
 
+/**
+ * Test if the n-th triangle of a 2D TriangulatedSurface is oriented counter clockwise
+ */
+SFCGAL_API bool isCounterClockWiseOriented( const TriangulatedSurface& g, const size_t& n );
+
 /**
  * Test if a 2D surface is oriented counter clockwise
  */
 SFCGAL_API bool isCounterClockWiseOriented( const LineString& );
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -30,7 +30,7 @@
 #include <SFCGAL/algorithm/normal.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 /**
@@ -228,7 +228,7 @@ bool isPlane3D( const Geometry& geom,const double& toleranceAbs )
 
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
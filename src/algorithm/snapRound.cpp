@@ -0,0 +1,90 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/snapRound.h>
+#include <SFCGAL/algorithm/compactExact.h>
+#include <SFCGAL/detail/transform/SnapRound.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Exception.h>
+
+#include <boost/atomic.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+///
+/// read on each boolean result : atomic, reading it does not lock
+///
+boost::atomic< long > fixedPrecisionScale( 0 ) ;
+}
+
+///
+///
+///
+void snapRound( Geometry& g, const long& scale )
+{
+    if ( scale <= 0 ) {
+        BOOST_THROW_EXCEPTION( Exception( "snapRound : the scale must be positive" ) );
+    }
+
+    transform::SnapRound t( scale ) ;
+    g.accept( t ) ;
+}
+
+///
+///
+///
+void setFixedPrecision( const long& scale )
+{
+    if ( scale < 0 ) {
+        BOOST_THROW_EXCEPTION( Exception( "setFixedPrecision : the scale must be positive (or 0 to disable)" ) );
+    }
+
+    fixedPrecisionScale.store( scale ) ;
+}
+
+///
+///
+///
+long fixedPrecision()
+{
+    return fixedPrecisionScale.load() ;
+}
+
+///
+///
+///
+void applyResultPrecision( Geometry& g )
+{
+    // read once, the option may be changed by another thread
+    const long scale = fixedPrecision() ;
+
+    if ( scale > 0 ) {
+        snapRound( g, scale );
+    }
+    else if ( autoCompactExact() ) {
+        compactExact( g );
+    }
+}
+
+} // namespace algorithm
+SFCGAL_END_NAMESPACE
+
@@ -0,0 +1,77 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_SNAPROUND_H_
+#define _SFCGAL_ALGORITHM_SNAPROUND_H_
+
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+/**
+ * @brief Snaps the coordinates of a geometry to the grid of a fixed precision model
+ * (multiples of 1/scale, i.e. scale = 100 for a centimetre precision).
+ *
+ * Snapped coordinates are exact integer ratios with a bounded size (or doubles when they are
+ * the exact value) and have no lazy construction history. Consecutive points collapsed by
+ * the snapping are removed.
+ *
+ * Parts collapsed by the snapping are dropped (removed from their collection, or the geometry
+ * becomes empty) : LineStrings reduced to a point, rings with less than 4 points (the Polygon
+ * when it is the exterior ring), flat Triangles and flat faces of a TriangulatedSurface.
+ *
+ * @warning the snapping may still make a geometry invalid (i.e. self-intersecting rings)
+ */
+SFCGAL_API void snapRound( Geometry& g, const long& scale );
+
+/**
+ * @brief Sets the fixed precision model applied to the results of intersection, union
+ * and difference (they are snap rounded with the given scale, 0 to disable, default)
+ *
+ * The option is global and atomic : operations running in other threads use the new value
+ * from their next result on.
+ *
+ * @warning the results are not validated again after the snapping : as with snapRound, a valid
+ * result may become invalid (i.e. a hole closer than the precision to the exterior ring touches it)
+ */
+SFCGAL_API void setFixedPrecision( const long& scale );
+
+/**
+ * @brief Returns the scale of the fixed precision model (0 if disabled)
+ */
+SFCGAL_API long fixedPrecision();
+
+/**
+ * @brief Applies the fixed precision model (snapRound) or the automatic
+ * compaction (compactExact) to the result of a constructive operation. Each option is read
+ * once, without locking.
+ * @ingroup detail
+ */
+SFCGAL_API void applyResultPrecision( Geometry& g );
+
+} // namespace algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -0,0 +1,254 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/algorithm/solidBoolean.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/snapRound.h>
+#include <SFCGAL/detail/algorithm/solidShells.h>
+
+#include <CGAL/corefinement_operations.h>
+#include <CGAL/Bbox_3.h>
+
+#include <boost/ptr_container/ptr_vector.hpp>
+
+#include <set>
+#include <vector>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+
+typedef detail::MarkedPolyhedron MarkedPolyhedron ;
+typedef CGAL::Point_3< Kernel > Point_3 ;
+typedef CGAL::Polyhedron_corefinement< MarkedPolyhedron > Corefinement ;
+typedef detail::algorithm::SolidShell Shell ;
+
+//
+// signed volume of the cone from the origin to a facet (fan triangulation)
+Kernel::FT facetVolume( MarkedPolyhedron::Facet_const_handle f )
+{
+    const Point_3 origin( CGAL::ORIGIN );
+    Kernel::FT volume = 0 ;
+
+    MarkedPolyhedron::Halfedge_around_facet_const_circulator h = f->facet_begin();
+    const Point_3& p0 = h->vertex()->point();
+    ++h ;
+    MarkedPolyhedron::Halfedge_around_facet_const_circulator next = h ;
+    ++next ;
+
+    for ( ; next != f->facet_begin(); ++h, ++next ) {
+        volume += CGAL::volume( origin, p0, h->vertex()->point(), next->vertex()->point() );
+    }
+
+    return volume ;
+}
+
+//
+// closed polyhedron of the exterior shell of a solid, oriented outward
+std::auto_ptr< MarkedPolyhedron > toClosedPolyhedron( const Solid& solid )
+{
+    if ( solid.numInteriorShells() > 0 ) {
+        BOOST_THROW_EXCEPTION( Exception( "solidBoolean() : solids with interior shells are not supported" ) );
+    }
+
+    std::auto_ptr< MarkedPolyhedron > p( solid.exteriorShell().toPolyhedron_3< Kernel, MarkedPolyhedron >() );
+
+    if ( ! p->is_closed() ) {
+        BOOST_THROW_EXCEPTION( Exception( "solidBoolean() : the exterior shell is not closed" ) );
+    }
+
+    Kernel::FT volume = 0 ;
+
+    for ( MarkedPolyhedron::Facet_const_iterator f = p->facets_begin(); f != p->facets_end(); ++f ) {
+        volume += facetVolume( f );
+    }
+
+    if ( volume < 0 ) {
+        p->inside_out();
+    }
+
+    return p ;
+}
+
+//
+// bounding box of the vertices of a polyhedron
+CGAL::Bbox_3 boundingBox( const MarkedPolyhedron& p )
+{
+    CGAL::Bbox_3 box ;
+    bool isFirst = true ;
+
+    for ( MarkedPolyhedron::Vertex_const_iterator v = p.vertices_begin(); v != p.vertices_end(); ++v ) {
+        box = isFirst ? v->point().bbox() : box + v->point().bbox() ;
+        isFirst = false ;
+    }
+
+    return box ;
+}
+
+//
+// Polygon of a facet
+Polygon* facetToPolygon( MarkedPolyhedron::Facet_const_handle f )
+{
+    LineString* ring = new LineString();
+    MarkedPolyhedron::Halfedge_around_facet_const_circulator h = f->facet_begin();
+
+    do {
+        ring->addPoint( h->vertex()->point() );
+        ++h;
+    }
+    while ( h != f->facet_begin() );
+
+    // close the ring
+    ring->addPoint( h->vertex()->point() );
+    return new Polygon( ring );
+}
+
+//
+// splits a polyhedron into its connected components
+void addShells( const MarkedPolyhedron& p, boost::ptr_vector< Shell >& shells )
+{
+    std::set< const MarkedPolyhedron::Facet* > visited ;
+
+    for ( MarkedPolyhedron::Facet_const_iterator seed = p.facets_begin(); seed != p.facets_end(); ++seed ) {
+        if ( ! visited.insert( &*seed ).second ) {
+            continue;
+        }
+
+        Shell* shell = new Shell ;
+        shells.push_back( shell );
+
+        MarkedPolyhedron::Halfedge_around_facet_const_circulator first = seed->facet_begin();
+        shell->sample = CGAL::centroid( first->vertex()->point(), first->next()->vertex()->point(), first->next()->next()->vertex()->point() );
+
+        std::vector< MarkedPolyhedron::Facet_const_handle > stack( 1, seed );
+
+        while ( ! stack.empty() ) {
+            MarkedPolyhedron::Facet_const_handle f = stack.back();
+            stack.pop_back();
+
+            shell->surface->addPolygon( facetToPolygon( f ) );
+            shell->volume += facetVolume( f );
+
+            MarkedPolyhedron::Halfedge_around_facet_const_circulator h = f->facet_begin();
+
+            do {
+                if ( ! h->opposite()->is_border() && visited.insert( &*h->opposite()->facet() ).second ) {
+                    stack.push_back( h->opposite()->facet() );
+                }
+
+                ++h;
+            }
+            while ( h != f->facet_begin() );
+        }
+    }
+}
+
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > solidBoolean( const Solid& a, const Solid& b, const SolidBooleanOperation& operation )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( a );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( b );
+
+    return solidBoolean( a, b, operation, NoValidityCheck() );
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > solidBoolean( const Solid& a, const Solid& b, const SolidBooleanOperation& operation, NoValidityCheck )
+{
+    requireExactConstructions( "solidBoolean" );
+
+    boost::ptr_vector< Shell > shells ;
+
+    if ( a.isEmpty() || b.isEmpty() ) {
+        // the empty solid is the neutral element of the union and the difference
+        if ( ! a.isEmpty() && operation != SOLID_INTERSECTION ) {
+            addShells( *toClosedPolyhedron( a ), shells );
+        }
+
+        if ( ! b.isEmpty() && operation == SOLID_UNION ) {
+            addShells( *toClosedPolyhedron( b ), shells );
+        }
+
+        std::auto_ptr< Geometry > result( detail::algorithm::toSolids( shells ) );
+        applyResultPrecision( *result );
+        return result ;
+    }
+
+    std::auto_ptr< MarkedPolyhedron > pa( toClosedPolyhedron( a ) );
+    std::auto_ptr< MarkedPolyhedron > pb( toClosedPolyhedron( b ) );
+
+    if ( ! CGAL::do_overlap( boundingBox( *pa ), boundingBox( *pb ) ) ) {
+        // nothing to corefine
+        if ( operation != SOLID_INTERSECTION ) {
+            addShells( *pa, shells );
+        }
+
+        if ( operation == SOLID_UNION ) {
+            addShells( *pb, shells );
+        }
+    }
+    else {
+        int tag = Corefinement::Join_tag ;
+
+        if ( operation == SOLID_INTERSECTION ) {
+            tag = Corefinement::Intersection_tag ;
+        }
+        else if ( operation == SOLID_DIFFERENCE ) {
+            tag = Corefinement::P_minus_Q_tag ;
+        }
+
+        Corefinement coref ;
+        CGAL::Emptyset_iterator no_polylines ;
+        typedef std::vector< std::pair< MarkedPolyhedron*, int > > ResultType ;
+        ResultType result ;
+        // the polyhedra are modified by the corefinement
+        coref( *pa, *pb, no_polylines, std::back_inserter( result ), tag );
+
+        boost::ptr_vector< MarkedPolyhedron > owned ;
+
+        for ( ResultType::iterator it = result.begin(); it != result.end(); ++it ) {
+            owned.push_back( it->first );
+        }
+
+        for ( boost::ptr_vector< MarkedPolyhedron >::const_iterator it = owned.begin(); it != owned.end(); ++it ) {
+            addShells( *it, shells );
+        }
+    }
+
+    std::auto_ptr< Geometry > result( detail::algorithm::toSolids( shells ) );
+    applyResultPrecision( *result );
+    return result ;
+}
+
+}//algorithm
+SFCGAL_END_NAMESPACE
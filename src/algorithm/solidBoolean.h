@@ -0,0 +1,87 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_SOLIDBOOLEAN_H_
+#define _SFCGAL_ALGORITHM_SOLIDBOOLEAN_H_
+
+#include <SFCGAL/config.h>
+
+#include <memory>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+class Solid ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+struct NoValidityCheck;
+
+/**
+ * @brief Boolean operations of solidBoolean
+ */
+enum SolidBooleanOperation {
+    /**
+     * union3D( a, b )
+     */
+    SOLID_UNION,
+    /**
+     * intersection3D( a, b )
+     */
+    SOLID_INTERSECTION,
+    /**
+     * difference3D( a, b )
+     */
+    SOLID_DIFFERENCE
+};
+
+/**
+ * @brief Boolean operation on two closed volumes, by corefinement of their meshes.
+ *
+ * The exterior shells are triangulated into polyhedra (vertices shared by index), which are
+ * corefined by CGAL::Polyhedron_corefinement. The connected components of the resulting
+ * polyhedra are converted back to shells : the outward ones are exterior shells, the inward
+ * ones are the interior shells (cavities) of the smallest exterior shell containing them.
+ *
+ * Unlike union3D, intersection3D and difference3D, the volumes are not decomposed in a
+ * GeometrySet and the result is not recomposed from its primitives : only the volume is
+ * computed (the parts of lower dimension, like the face shared by two touching cubes,
+ * are not part of the result).
+ *
+ * @return a Solid, a MultiSolid if the result has several exterior shells, an empty
+ * GeometryCollection if the result is empty
+ * @pre a and b are valid geometries
+ * @throw SFCGAL::Exception if a or b has interior shells, or if their exterior shells are not closed
+ * @warning as in union3D, volumes touching only along an edge or at a point are not handled by the corefinement
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr< Geometry > solidBoolean( const Solid& a, const Solid& b, const SolidBooleanOperation& operation );
+
+/**
+ * @brief Boolean operation on two closed volumes, no validity check variant
+ * @ingroup detail
+ * @warning No actual validity check is done
+ */
+SFCGAL_API std::auto_ptr< Geometry > solidBoolean( const Solid& a, const Solid& b, const SolidBooleanOperation& operation, NoValidityCheck );
+
+}//algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
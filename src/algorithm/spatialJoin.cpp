@@ -0,0 +1,349 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/algorithm/spatialJoin.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/FilterStatistics.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+#include <SFCGAL/detail/TypeForDimension.h>
+
+#include <CGAL/box_intersection_d.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+#include <list>
+
+using namespace SFCGAL::detail;
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+namespace {
+
+//
+// number of prepared features kept by a Join, the least recently used ones are released
+const size_t MAX_PREPARED_FEATURES = 1024 ;
+
+template <int Dim> struct Feature ;
+
+template <int Dim>
+struct PreparedFeatures {
+    typedef std::list< Feature<Dim>* > Type ;
+};
+
+//
+// a geometry of one of the joined lists, prepared on demand
+template <int Dim>
+struct Feature {
+    size_t index ;
+    const Geometry* geometry ;
+    // owned by the Join, NULL when not prepared or released
+    const PreparedGeometrySet<Dim>* prepared ;
+    // position in the prepared features of the Join (if prepared)
+    typename PreparedFeatures<Dim>::Type::iterator position ;
+    // the validity is checked once, not on each preparation
+    bool isChecked ;
+};
+
+template <int Dim>
+struct FeatureBox {
+    typedef CGAL::Box_intersection_d::Box_with_handle_d<double, Dim, Feature<Dim>*> Type;
+};
+
+//
+// orders the candidate pairs on the feature of the first list
+template <int Dim>
+struct FirstFeatureLess {
+    bool operator()( const std::pair< Feature<Dim>*, Feature<Dim>* >& x, const std::pair< Feature<Dim>*, Feature<Dim>* >& y ) const {
+        return x.first->index < y.first->index || ( x.first->index == y.first->index && x.second->index < y.second->index );
+    }
+};
+
+CGAL::Bbox_2 featureBbox( const Envelope& envelope, dim_t<2> )
+{
+    return envelope.toBbox_2();
+}
+
+// z = 0 is assumed for 2D geometries (see intersects3D)
+CGAL::Bbox_3 featureBbox( const Envelope& envelope, dim_t<3> )
+{
+    if ( envelope.is3D() ) {
+        return envelope.toBbox_3();
+    }
+
+    return CGAL::Bbox_3( envelope.xMin(), envelope.yMin(), 0.0, envelope.xMax(), envelope.yMax(), 0.0 );
+}
+
+void assertValidity( const Geometry& g, dim_t<2> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+}
+
+void assertValidity( const Geometry& g, dim_t<3> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+}
+
+//
+// filters the pairs of features with CGAL::box_intersection_d and refines them with the predicate.
+// The candidate pairs are refined in blocks sharing the same feature of the first list, which is
+// released after its block. The features of the second list are kept in a bounded cache.
+template <int Dim>
+class Join : boost::noncopyable {
+public:
+    typedef std::vector< typename FeatureBox<Dim>::Type > FeatureBoxCollection ;
+    typedef std::vector< std::pair< Feature<Dim>*, Feature<Dim>* > > CandidateCollection ;
+
+    Join( const SpatialJoinPredicate& predicate, SpatialJoinVisitor& visitor ):
+        _predicate( predicate ),
+        _visitor( visitor ) {
+    }
+
+    ~Join() {
+        for ( size_t i = 0; i < _features.size(); i++ ) {
+            delete _features[i].prepared ;
+        }
+    }
+
+    void run( const std::vector< const Geometry* >& a, const std::vector< const Geometry* >& b ) {
+        // the boxes point to the features
+        _features.reserve( a.size() + b.size() );
+
+        FeatureBoxCollection aboxes, bboxes;
+        addFeatures( a, aboxes );
+        addFeatures( b, bboxes );
+
+        CandidateCollection candidates ;
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(),
+                                  bboxes.begin(), bboxes.end(),
+                                  Callback( candidates ) );
+
+        std::sort( candidates.begin(), candidates.end(), FirstFeatureLess<Dim>() );
+
+        for ( typename CandidateCollection::const_iterator it = candidates.begin(); it != candidates.end(); ++it ) {
+            if ( test( *it->first, *it->second ) ) {
+                _visitor.visit( it->first->index, it->second->index );
+            }
+
+            // end of the block of the feature of a
+            if ( it + 1 == candidates.end() || ( it + 1 )->first != it->first ) {
+                release( *it->first );
+            }
+        }
+    }
+
+private:
+    SpatialJoinPredicate _predicate ;
+    SpatialJoinVisitor& _visitor ;
+    std::vector< Feature<Dim> > _features ;
+    // prepared features, the most recently used first
+    typename PreparedFeatures<Dim>::Type _prepared ;
+
+    // box_intersection_d copies its callback
+    struct Callback {
+        explicit Callback( CandidateCollection& candidates ):
+            _candidates( &candidates ) {
+        }
+
+        void operator()( const typename FeatureBox<Dim>::Type& a, const typename FeatureBox<Dim>::Type& b ) {
+            _candidates->push_back( std::make_pair( a.handle(), b.handle() ) );
+        }
+
+    private:
+        CandidateCollection* _candidates ;
+    };
+
+    void addFeatures( const std::vector< const Geometry* >& geometries, FeatureBoxCollection& boxes ) {
+        boxes.reserve( geometries.size() );
+
+        for ( size_t i = 0; i < geometries.size(); i++ ) {
+            BOOST_ASSERT( geometries[i] != NULL );
+            const Envelope envelope = geometries[i]->envelope();
+
+            if ( envelope.isEmpty() ) {
+                continue;
+            }
+
+            Feature<Dim> feature ;
+            feature.index = i ;
+            feature.geometry = geometries[i] ;
+            feature.prepared = NULL ;
+            feature.isChecked = false ;
+            _features.push_back( feature );
+            boxes.push_back( typename FeatureBox<Dim>::Type( featureBbox( envelope, dim_t<Dim>() ), &_features.back() ) );
+        }
+    }
+
+    const PreparedGeometrySet<Dim>& prepare( Feature<Dim>& feature ) {
+        if ( feature.prepared ) {
+            // most recently used
+            _prepared.splice( _prepared.begin(), _prepared, feature.position );
+            return *feature.prepared ;
+        }
+
+        if ( ! feature.isChecked && ( _predicate == JOIN_INTERSECTS || _predicate == JOIN_INTERSECTS_3D ) ) {
+            assertValidity( *feature.geometry, dim_t<Dim>() );
+        }
+
+        feature.isChecked = true ;
+
+        // the least recently used feature is released (not the one of the current pair, used just before)
+        if ( _prepared.size() >= MAX_PREPARED_FEATURES ) {
+            release( *_prepared.back() );
+        }
+
+        feature.prepared = new PreparedGeometrySet<Dim>( *feature.geometry );
+        _prepared.push_front( &feature );
+        feature.position = _prepared.begin() ;
+        return *feature.prepared ;
+    }
+
+    void release( Feature<Dim>& feature ) {
+        if ( feature.prepared ) {
+            _prepared.erase( feature.position );
+            delete feature.prepared ;
+            feature.prepared = NULL ;
+        }
+    }
+
+    bool test( Feature<Dim>& a, Feature<Dim>& b ) {
+        switch ( _predicate ) {
+        case JOIN_INTERSECTS:
+        case JOIN_INTERSECTS_3D: {
+            SFCGAL_FILTER_STATISTICS_SCOPE( INTERSECTS );
+            const PreparedGeometrySet<Dim>& pa = prepare( a );
+            return intersects( pa, prepare( b ) );
+        }
+
+        case JOIN_COVERS:
+        case JOIN_COVERS_3D: {
+            SFCGAL_FILTER_STATISTICS_SCOPE( COVERS );
+            const PreparedGeometrySet<Dim>& pa = prepare( a );
+            return covers( pa, prepare( b ) );
+        }
+        }
+
+        BOOST_ASSERT( false );
+        return false;
+    }
+};
+
+//
+// collects the pairs in a vector
+class PairCollector : public SpatialJoinVisitor {
+public:
+    explicit PairCollector( std::vector< std::pair< size_t, size_t > >& pairs ):
+        _pairs( pairs ) {
+    }
+
+    virtual void visit( const size_t& i, const size_t& j ) {
+        _pairs.push_back( std::make_pair( i, j ) );
+    }
+
+private:
+    std::vector< std::pair< size_t, size_t > >& _pairs ;
+};
+
+void collectionParts( const GeometryCollection& collection, std::vector< const Geometry* >& parts )
+{
+    parts.reserve( collection.numGeometries() );
+
+    for ( size_t i = 0; i < collection.numGeometries(); i++ ) {
+        parts.push_back( &collection.geometryN( i ) );
+    }
+}
+
+}
+
+///
+///
+///
+SpatialJoinVisitor::~SpatialJoinVisitor()
+{
+
+}
+
+///
+///
+///
+void spatialJoin(
+    const std::vector< const Geometry* >& a,
+    const std::vector< const Geometry* >& b,
+    const SpatialJoinPredicate& predicate,
+    SpatialJoinVisitor& visitor
+)
+{
+    switch ( predicate ) {
+    case JOIN_INTERSECTS:
+    case JOIN_COVERS:
+        Join<2>( predicate, visitor ).run( a, b );
+        return ;
+
+    case JOIN_INTERSECTS_3D:
+    case JOIN_COVERS_3D:
+        Join<3>( predicate, visitor ).run( a, b );
+        return ;
+    }
+
+    BOOST_THROW_EXCEPTION( Exception( "unknown spatialJoin predicate" ) );
+}
+
+///
+///
+///
+void spatialJoin(
+    const GeometryCollection& a,
+    const GeometryCollection& b,
+    const SpatialJoinPredicate& predicate,
+    SpatialJoinVisitor& visitor
+)
+{
+    std::vector< const Geometry* > aparts, bparts ;
+    collectionParts( a, aparts );
+    collectionParts( b, bparts );
+
+    spatialJoin( aparts, bparts, predicate, visitor );
+}
+
+///
+///
+///
+void spatialJoin(
+    const GeometryCollection& a,
+    const GeometryCollection& b,
+    const SpatialJoinPredicate& predicate,
+    std::vector< std::pair< size_t, size_t > >& pairs
+)
+{
+    pairs.clear();
+    PairCollector collector( pairs );
+    spatialJoin( a, b, predicate, collector );
+    std::sort( pairs.begin(), pairs.end() );
+}
+
+}//namespace algorithm
+SFCGAL_END_NAMESPACE
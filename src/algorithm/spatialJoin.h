@@ -0,0 +1,125 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_ALGORITHM_SPATIALJOIN_H_
+#define _SFCGAL_ALGORITHM_SPATIALJOIN_H_
+
+#include <SFCGAL/config.h>
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+class GeometryCollection ;
+SFCGAL_END_NAMESPACE
+
+SFCGAL_BEGIN_NAMESPACE
+namespace algorithm {
+
+/**
+ * @brief Predicates of a spatialJoin
+ */
+enum SpatialJoinPredicate {
+    /**
+     * intersects( a[i], b[j] )
+     */
+    JOIN_INTERSECTS,
+    /**
+     * intersects3D( a[i], b[j] )
+     */
+    JOIN_INTERSECTS_3D,
+    /**
+     * covers( a[i], b[j] )
+     */
+    JOIN_COVERS,
+    /**
+     * covers3D( a[i], b[j] )
+     */
+    JOIN_COVERS_3D
+};
+
+/**
+ * @brief Receives the pairs of a spatialJoin
+ */
+class SFCGAL_API SpatialJoinVisitor {
+public:
+    virtual ~SpatialJoinVisitor();
+
+    /**
+     * called for each pair (i,j) such that predicate( a[i], b[j] ), in no particular order
+     */
+    virtual void visit( const size_t& i, const size_t& j ) = 0 ;
+};
+
+/**
+ * @brief Finds the pairs of geometries of two lists that satisfy a predicate.
+ *
+ * The pairs of geometries with overlapping envelopes are found with CGAL::box_intersection_d,
+ * (O((n+m).log(n+m)^d + k)) then refined with the exact predicate, grouped by geometry of a.
+ * The validity of a geometry is checked once. A geometry of a is decomposed for its group of
+ * pairs and released after it ; the decompositions of the geometries of b are kept in a bounded
+ * cache (the 1024 most recently used), the others are decomposed again when needed.
+ *
+ * Empty geometries are not part of any pair.
+ *
+ * @param a the first list (not NULL geometries)
+ * @param b the second list (not NULL geometries)
+ * @param predicate the predicate tested on the pairs
+ * @param visitor receives the pairs of indices in a and b
+ * @pre the geometries are valid
+ * @ingroup public_api
+ */
+SFCGAL_API void spatialJoin(
+    const std::vector< const Geometry* >& a,
+    const std::vector< const Geometry* >& b,
+    const SpatialJoinPredicate& predicate,
+    SpatialJoinVisitor& visitor
+);
+
+/**
+ * @brief Finds the pairs of the parts of two collections that satisfy a predicate.
+ * @see spatialJoin( const std::vector< const Geometry* >&, const std::vector< const Geometry* >&, const SpatialJoinPredicate&, SpatialJoinVisitor& )
+ * @ingroup public_api
+ */
+SFCGAL_API void spatialJoin(
+    const GeometryCollection& a,
+    const GeometryCollection& b,
+    const SpatialJoinPredicate& predicate,
+    SpatialJoinVisitor& visitor
+);
+
+/**
+ * @brief Finds the pairs of the parts of two collections that satisfy a predicate.
+ * @param pairs receives the pairs of indices (i,j), sorted
+ * @ingroup public_api
+ */
+SFCGAL_API void spatialJoin(
+    const GeometryCollection& a,
+    const GeometryCollection& b,
+    const SpatialJoinPredicate& predicate,
+    std::vector< std::pair< size_t, size_t > >& pairs
+);
+
+}//namespace algorithm
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -37,7 +37,7 @@
 #include <CGAL/create_straight_skeleton_from_polygon_with_holes_2.h>
 #include <CGAL/Straight_skeleton_converter_2.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 typedef Kernel::Point_2                    Point_2 ;
@@ -231,5 +231,5 @@ std::auto_ptr< MultiLineString > approximateMedialAxis( const Geometry& g )
 }
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -25,14 +25,14 @@
 
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
 class Polygon ;
 class MultiPolygon ;
 class MultiLineString ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 struct NoValidityCheck;
 
@@ -77,7 +77,7 @@ SFCGAL_API std::auto_ptr< MultiLineString > straightSkeleton( const Polygon& g,
 SFCGAL_API std::auto_ptr< MultiLineString > straightSkeleton( const MultiPolygon& g, bool autoOrientation = true, bool innerOnly = false ) ;
 
 }//namespace algorithm
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -25,7 +25,7 @@
 #include <SFCGAL/triangulate/triangulatePolygon.h>
 #include <SFCGAL/algorithm/isValid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -90,6 +90,6 @@ std::auto_ptr<Geometry> tesselate( const Geometry& g )
 }
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
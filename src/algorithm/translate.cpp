@@ -37,7 +37,7 @@
 #include <SFCGAL/detail/transform/AffineTransform2.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 ///
@@ -71,6 +71,6 @@ void   translate( Geometry& g, Kernel::FT dx, Kernel::FT dy, Kernel::FT dz )
 }
 
 } // namespace algorithm
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
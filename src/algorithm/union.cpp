@@ -22,15 +22,27 @@
 #include <SFCGAL/algorithm/intersection.h>
 #include <SFCGAL/algorithm/union.h>
 #include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/algorithm/snapRound.h>
 #include <SFCGAL/triangulate/triangulate2DZ.h>
 
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/detail/parallelFor.h>
+#include <SFCGAL/detail/deepCopy.h>
+
+
 #include <cstdio>
 #include <algorithm>
+#include <deque>
+#include <stdint.h> // uint32_t
+
+#include <boost/ptr_container/ptr_vector.hpp>
 
 #define DEBUG_OUT if (0) std::cerr << __FILE__ << ":" << __LINE__ << " debug: "
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 namespace algorithm {
 
@@ -63,22 +75,37 @@ struct Segment_d: detail::Segment_d<Dim>::Type {
 
     template < class OutputIterator >
     OutputIterator pieces( OutputIterator out ) const {
+        // the split points (ends of the removed parts included) are on the segment,
+        // their distance to the source orders them
+        const Nearer< PointType > nearer( this->source() );
         PointVector points( 1, this->source() );
         points.insert( points.end(), _split.begin(), _split.end() );
         points.push_back( this->target() );
-        std::sort( points.begin()+1, points.end()-1, Nearer< PointType >( this->source() ) );
+        std::sort( points.begin(), points.end(), nearer );
+        points.erase( std::unique( points.begin(), points.end() ), points.end() );
 
-        for ( typename PointVector::const_iterator p = points.begin(), q = p+1;
-                q != points.end(); ++p, q++ ) {
-            if ( *p != *q ) {
-                PointType m = CGAL::midpoint( *p, *q );
-                typename SegmentVector::const_iterator r = _remove.begin();
+        // number of removed parts starting (+1) or ending (-1) at each point
+        std::vector< int > removed( points.size(), 0 );
 
-                for ( ; r != _remove.end() && !r->has_on( m ); ++r );
+        for ( typename SegmentVector::const_iterator r = _remove.begin(); r != _remove.end(); ++r ) {
+            size_t i = std::lower_bound( points.begin(), points.end(), r->source(), nearer ) - points.begin();
+            size_t j = std::lower_bound( points.begin(), points.end(), r->target(), nearer ) - points.begin();
 
-                if ( r == _remove.end() ) {
-                    *out++ = SegmentType( *p, *q );
-                }
+            if ( j < i ) {
+                std::swap( i, j );
+            }
+
+            removed[i]++;
+            removed[j]--;
+        }
+
+        int depth = 0;
+
+        for ( size_t i = 0; i + 1 < points.size(); i++ ) {
+            depth += removed[i];
+
+            if ( depth == 0 ) {
+                *out++ = SegmentType( points[i], points[i + 1] );
             }
         }
 
@@ -280,174 +307,124 @@ private:
     SegmentVector _split;
 };
 
-// for debug prints
-template <typename T >
-std::ostream& operator<<( std::ostream& out, std::set< T* >& obs )
-{
-    for ( typename std::set< T* >::iterator h = obs.begin(); h != obs.end(); ++h ) {
-        out << *h << "\n";
-    }
-
-    return out;
-}
-
-
-// takes care of RAII of primitives
-
+//
+// Primitives of a union, and the sets of primitives merged together (union-find).
+//
+// The primitive of a set is held by its root. When a set is merged into another one, its
+// primitive is released : the primitive of the other set now stands for both (e.g. a surface
+// absorbs a point on it, or the union of two surfaces replaces both of them).
 template <int Dim>
-class Handle {
-    struct ObservablePrimitive: boost::variant<
-            typename detail::Point_d<Dim>::Type,
-            Segment_d<Dim>,
-            Surface_d<Dim>,
-            typename detail::Volume_d<Dim>::Type,
-            EmptyPrimitive > {
-        template <class T>
-        ObservablePrimitive( const T& p ) :  boost::variant<
-            typename detail::Point_d<Dim>::Type,
+class PrimitiveUnionFind {
+public:
+    typedef boost::variant< typename detail::Point_d<Dim>::Type,
             Segment_d<Dim>,
             Surface_d<Dim>,
             typename detail::Volume_d<Dim>::Type,
-            EmptyPrimitive >( p ) {}
+            EmptyPrimitive > Primitive;
+
+    template <class T>
+    size_t add( const T& primitive ) {
+        // a deque : the references to the primitives are kept when new ones are added
+        _primitives.push_back( Primitive( primitive ) );
+        _parent.push_back( _parent.size() );
+        return _parent.size() - 1;
+    }
 
-        template <class T>
-        inline T& as() {
-            return boost::get<T&>( *this );
+    size_t find( size_t i ) {
+        while ( _parent[i] != i ) {
+            // path halving
+            _parent[i] = _parent[_parent[i]];
+            i = _parent[i];
         }
 
-        std::set< ObservablePrimitive** > _observers;  // this is for ref counting and handle updating
-
-    private:
-        // non copyable
-        ObservablePrimitive( const ObservablePrimitive& );
-        ObservablePrimitive& operator=( const ObservablePrimitive& );
-    };
-
-public:
-
+        return i;
+    }
 
-    Handle(): _p( new ObservablePrimitive*( new ObservablePrimitive( EmptyPrimitive() ) ) ) {
-        ( *_p )->_observers.insert( _p );
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
+    Primitive& primitive( size_t i ) {
+        return _primitives[ find( i ) ];
     }
 
-    ~Handle() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        ( *_p )->_observers.erase( _p );
+    // merges the set of 'from' into the set of 'into'
+    void merge( size_t into, size_t from ) {
+        const size_t rootInto = find( into );
+        const size_t rootFrom = find( from );
 
-        if ( ( *_p )->_observers.empty() ) {
-            delete ( *_p );
+        if ( rootInto == rootFrom ) {
+            return;
         }
 
-        delete _p;
+        _parent[rootFrom] = rootInto;
+        _primitives[rootFrom] = EmptyPrimitive();
     }
 
-    Handle( const Handle& other ):_p( new ObservablePrimitive*( *other._p ) ) {
-        ( *_p )->_observers.insert( _p );
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
+    // releases the primitive of the set of i
+    void clear( size_t i ) {
+        _primitives[ find( i ) ] = EmptyPrimitive();
     }
 
-    template < class PrimitiveType >
-    explicit Handle( const PrimitiveType& primitive ): _p( new ObservablePrimitive*(  new ObservablePrimitive( primitive ) ) ) {
-        ( *_p )->_observers.insert( _p );
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-    }
+private:
+    std::deque< Primitive > _primitives;
+    std::vector< size_t > _parent;
+};
 
-    void swap( Handle& other ) {
-        ( *_p )->_observers.erase( _p );
-        ( *other._p )->_observers.erase( other._p );
-        std::swap( _p, other._p );
-        ( *_p )->_observers.insert( _p );
-        ( *other._p )->_observers.insert( other._p );
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        BOOST_ASSERT( ( *other._p )->_observers.count( other._p ) );
-    }
+//
+// Handle on a primitive of a PrimitiveUnionFind (cheap to copy)
+template <int Dim>
+class Handle {
+public:
+    Handle(): _primitives( NULL ), _index( 0 ) {}
 
-    Handle& operator=( Handle other ) {
-        this->swap( other );
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        return *this;
+    template < class PrimitiveType >
+    Handle( PrimitiveUnionFind<Dim>& primitives, const PrimitiveType& primitive ):
+        _primitives( &primitives ), _index( primitives.add( primitive ) ) {
     }
 
-    const ObservablePrimitive& operator*() const {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        return *( *_p );
-    }
-    ObservablePrimitive& operator*() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        return *( *_p );
-    }
-    const ObservablePrimitive* operator->() const {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        return ( *_p );
-    }
-    ObservablePrimitive* operator->() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-        return ( *_p );
+    PrimitiveUnionFind<Dim>& primitives() const {
+        return *_primitives;
     }
 
-    typename detail::Point_d<Dim>::Type& asPoint() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
+    typename detail::Point_d<Dim>::Type& asPoint() const {
         BOOST_ASSERT( which() == PrimitivePoint );
-        return boost::get<typename detail::Point_d<Dim>::Type& >( *( *_p ) );
+        return boost::get<typename detail::Point_d<Dim>::Type& >( _primitives->primitive( _index ) );
     }
 
-    Segment_d<Dim>& asSegment() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
+    Segment_d<Dim>& asSegment() const {
         BOOST_ASSERT( which() == PrimitiveSegment );
-        return boost::get<Segment_d<Dim> & >( *( *_p ) );
+        return boost::get<Segment_d<Dim> & >( _primitives->primitive( _index ) );
     }
 
-    Surface_d<Dim>& asSurface() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
+    Surface_d<Dim>& asSurface() const {
         BOOST_ASSERT( which() == PrimitiveSurface );
-        return boost::get<Surface_d<Dim> & >( *( *_p ) );
+        return boost::get<Surface_d<Dim> & >( _primitives->primitive( _index ) );
     }
 
-    typename detail::Volume_d<Dim>::Type& asVolume() {
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
+    typename detail::Volume_d<Dim>::Type& asVolume() const {
         BOOST_ASSERT( which() == PrimitiveVolume );
-        return boost::get<typename detail::Volume_d<Dim>::Type& >( *( *_p ) );
+        return boost::get<typename detail::Volume_d<Dim>::Type& >( _primitives->primitive( _index ) );
     }
 
-    PrimitiveType which() {
-        return PrimitiveType( ( *_p )->which() );
+    PrimitiveType which() const {
+        return PrimitiveType( _primitives->primitive( _index ).which() );
     }
 
-    bool empty() {
+    bool empty() const {
         return which() == PrimitiveEmpty;
     }
 
-    // makes all handles observing a observe 'this' instead
-    void registerObservers( Handle a ) {
-        if ( *a._p == *_p ) {
-            return;    // both aready observing the same primitive
-        }
-
-        ObservablePrimitive* observed = *( a._p );
-        std::vector< ObservablePrimitive** > observers( observed->_observers.begin(), observed->_observers.end() );
-
-        for ( typename std::vector< ObservablePrimitive** >::iterator h = observers.begin(); h != observers.end(); ++h ) {
-            *( *h ) = *_p;
-            ( *( *h ) )->_observers.insert( *h );
-        }
-
-        BOOST_ASSERT( *a._p == *_p );
-
-        delete observed; // we removed all observers
-        BOOST_ASSERT( ( *_p )->_observers.count( _p ) );
-#ifdef DEBUG
-
-        for ( typename std::vector< ObservablePrimitive** >::iterator h = observers.begin(); h != observers.end(); ++h ) {
-            BOOST_ASSERT( ( *( *h ) )->_observers.count( *h ) );
-        }
-
-#endif
+    // makes all handles on the primitive of a handle the primitive of 'this' instead
+    void registerObservers( const Handle& a ) const {
+        BOOST_ASSERT( a._primitives == _primitives );
+        _primitives->merge( _index, a._index );
+    }
 
+    // releases the primitive (once collected)
+    void clear() const {
+        _primitives->clear( _index );
     }
 
 private:
-    ObservablePrimitive** _p;  // mutable because no non const cpy ctor en template classes
+    PrimitiveUnionFind<Dim>* _primitives;
+    size_t _index;
 };
 
 template <int Dim>
@@ -457,30 +434,30 @@ struct HandledBox {
 };
 
 template <int Dim, class OutputIterator>
-OutputIterator compute_bboxes( const detail::GeometrySet<Dim>& gs, OutputIterator out )
+OutputIterator compute_bboxes( const detail::GeometrySet<Dim>& gs, PrimitiveUnionFind<Dim>& primitives, OutputIterator out )
 {
     typename HandledBox<Dim>::Vector bboxes;
 
     for ( typename detail::GeometrySet<Dim>::PointCollection::const_iterator it = gs.points().begin();
             it != gs.points().end(); ++it ) {
-        *out++ = typename HandledBox<Dim>::Type( it->primitive().bbox(), Handle<Dim>( it->primitive() ) );
+        *out++ = typename HandledBox<Dim>::Type( it->primitive().bbox(), Handle<Dim>( primitives, it->primitive() ) );
     }
 
     for ( typename detail::GeometrySet<Dim>::SegmentCollection::const_iterator it = gs.segments().begin();
             it != gs.segments().end(); ++it ) {
-        *out++ = typename HandledBox<Dim>::Type( it->primitive().bbox(), Handle<Dim>( it->primitive() ) );
+        *out++ = typename HandledBox<Dim>::Type( it->primitive().bbox(), Handle<Dim>( primitives, it->primitive() ) );
     }
 
     for ( typename detail::GeometrySet<Dim>::SurfaceCollection::const_iterator it = gs.surfaces().begin();
             it != gs.surfaces().end(); ++it ) {
         DEBUG_OUT << "Adding surface " << it->primitive() << "\n";
         DEBUG_OUT << "       surface box " << it->primitive().bbox() << "\n";
-        *out++ = typename HandledBox<Dim>::Type( it->primitive().bbox(), Handle<Dim>( it->primitive() ) );
+        *out++ = typename HandledBox<Dim>::Type( it->primitive().bbox(), Handle<Dim>( primitives, it->primitive() ) );
     }
 
     for ( typename detail::GeometrySet<Dim>::VolumeCollection::const_iterator it = gs.volumes().begin();
             it != gs.volumes().end(); ++it ) {
-        *out++ = typename HandledBox<Dim>::Type( compute_solid_bbox( it->primitive(), detail::dim_t<Dim>() ), Handle<Dim>( it->primitive() ) );
+        *out++ = typename HandledBox<Dim>::Type( compute_solid_bbox( it->primitive(), detail::dim_t<Dim>() ), Handle<Dim>( primitives, it->primitive() ) );
     }
 
     return out;
@@ -571,6 +548,7 @@ void union_segment_surface( Handle<2> a,Handle<2> b )
     rings.insert( rings.end(), b.asSurface().holes_begin(), b.asSurface().holes_end() );
 
     std::vector< Point_2 > points( 1, a.asSegment().source() );
+    const CGAL::Bbox_2 box = a.asSegment().bbox();
 
     for ( std::vector< Polygon_2 >::iterator ring = rings.begin(); ring != rings.end(); ++ring ) {
         for ( Polygon_2::Vertex_const_iterator target = ring->vertices_begin();
@@ -581,6 +559,10 @@ void union_segment_surface( Handle<2> a,Handle<2> b )
                                 ,
                                 *target );
 
+            if ( ! CGAL::do_overlap( box, sc.bbox() ) ) {
+                continue;
+            }
+
             CGAL::Object inter = CGAL::intersection( a.asSegment(), sc );
             const Point_2* p = CGAL::object_cast< Point_2 >( &inter );
             const Segment_2* s = CGAL::object_cast< Segment_2 >( &inter );
@@ -654,7 +636,7 @@ void union_segment_volume( Handle<3> a,Handle<3> b )
         // first step, substract faces
         for ( std::vector< Triangle_3 >::const_iterator tri=triangles.begin();
                 tri != triangles.end(); ++tri ) {
-            Handle<3> h( *tri );
+            Handle<3> h( a.primitives(), *tri );
             union_segment_surface( a, h );
         }
 
@@ -689,12 +671,13 @@ void union_segment_volume( Handle<3> a,Handle<3> b )
 
 void union_surface_surface( Handle<2> a,Handle<2> b )
 {
+    requireExactConstructions( "polygon union" );
     PolygonWH_2 res;
 
     if ( CGAL::join( fix_sfs_valid_polygon( a.asSurface() ),
                      fix_sfs_valid_polygon( b.asSurface() ), res ) ) {
         DEBUG_OUT << "merged " << a.asSurface() << " and " << b.asSurface() << "\n";
-        Handle<2> h( res );
+        Handle<2> h( a.primitives(), res );
         h.asSurface().addSplitsFrom( a.asSurface() );
         h.asSurface().addSplitsFrom( b.asSurface() );
         h.registerObservers( a );
@@ -751,6 +734,7 @@ void union_volume_volume( Handle<2> ,Handle<2> )
 
 void union_volume_volume( Handle<3> a,Handle<3> b )
 {
+    requireExactConstructions( "volume union" );
     MarkedPolyhedron& p = const_cast<MarkedPolyhedron&>( a.asVolume() );
     MarkedPolyhedron& q = const_cast<MarkedPolyhedron&>( b.asVolume() );
     typedef CGAL::Polyhedron_corefinement<MarkedPolyhedron> Corefinement;
@@ -771,7 +755,7 @@ void union_volume_volume( Handle<3> a,Handle<3> b )
         coref( p, q, no_polylines, std::back_inserter( result ), Corefinement::Join_tag );
 
         if ( result.size() == 1 ) {
-            Handle<3> h( *result[0].first );
+            Handle<3> h( a.primitives(), *result[0].first );
             // @todo check that the volume is valid (connection on one point isn't)
             h.registerObservers( a );
             h.registerObservers( b );
@@ -898,33 +882,32 @@ struct UnionOnBoxCollision {
 template <int Dim>
 void collectPrimitives( const typename HandledBox<Dim>::Vector& boxes, detail::GeometrySet<Dim>& output )
 {
-    Handle<Dim> empty;
-
+    // the primitives are released once collected, boxes of merged primitives share them
     for ( typename  HandledBox<Dim>::Vector::const_iterator bit = boxes.begin();
             bit != boxes.end(); ++bit ) {
         switch ( bit->handle().which() ) {
         case PrimitivePoint :
             output.addPrimitive( bit->handle().asPoint() );
-            empty.registerObservers( bit->handle() );
+            bit->handle().clear();
             break;
 
         case PrimitiveSegment : {
             typename std::vector< typename detail::Segment_d<Dim>::Type > pieces( bit->handle().asSegment().pieces() );
             output.addSegments( pieces.begin(), pieces.end() );
-            empty.registerObservers( bit->handle() );
+            bit->handle().clear();
         }
         break;
 
         case PrimitiveSurface : {
             typename std::vector< typename detail::Surface_d<Dim>::Type > pieces( bit->handle().asSurface().pieces() );
             output.addSurfaces( pieces.begin(), pieces.end() );
-            empty.registerObservers( bit->handle() );
+            bit->handle().clear();
         }
         break;
 
         case PrimitiveVolume :
             output.addPrimitive( bit->handle().asVolume() );
-            empty.registerObservers( bit->handle() );
+            bit->handle().clear();
             break;
 
         case PrimitiveEmpty :
@@ -933,20 +916,36 @@ void collectPrimitives( const typename HandledBox<Dim>::Vector& boxes, detail::G
     }
 }
 
-std::auto_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb, NoValidityCheck )
+template <int Dim>
+void union_( const detail::GeometrySet<Dim>& a, const detail::GeometrySet<Dim>& b, detail::GeometrySet<Dim>& output )
 {
-    HandledBox<2>::Vector boxes;
-    compute_bboxes( detail::GeometrySet<2>( ga ), std::back_inserter( boxes ) );
+    PrimitiveUnionFind<Dim> primitives;
+    typename HandledBox<Dim>::Vector boxes;
+    boxes.reserve( a.points().size() + a.segments().size() + a.surfaces().size() + a.volumes().size()
+                   + b.points().size() + b.segments().size() + b.surfaces().size() + b.volumes().size() );
+    compute_bboxes( a, primitives, std::back_inserter( boxes ) );
     const unsigned numBoxA = boxes.size();
-    compute_bboxes( detail::GeometrySet<2>( gb ), std::back_inserter( boxes ) );
+    compute_bboxes( b, primitives, std::back_inserter( boxes ) );
 
     CGAL::box_intersection_d( boxes.begin(), boxes.begin() + numBoxA,
                               boxes.begin() + numBoxA, boxes.end(),
-                              UnionOnBoxCollision<2>() );
+                              UnionOnBoxCollision<Dim>() );
 
-    detail::GeometrySet<2> output;
     collectPrimitives( boxes, output );
-    return output.recompose();
+}
+
+template void union_<2>( const detail::GeometrySet<2>& a, const detail::GeometrySet<2>& b, detail::GeometrySet<2>& );
+template void union_<3>( const detail::GeometrySet<3>& a, const detail::GeometrySet<3>& b, detail::GeometrySet<3>& );
+
+std::auto_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb, NoValidityCheck )
+{
+    detail::GeometrySet<2> output;
+    union_( detail::GeometrySet<2>( ga ), detail::GeometrySet<2>( gb ), output );
+
+    std::auto_ptr<Geometry> result( output.recompose() );
+    applyResultPrecision( *result );
+
+    return result;
 }
 
 std::auto_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb )
@@ -960,18 +959,13 @@ std::auto_ptr<Geometry> union_( const Geometry& ga, const Geometry& gb )
 
 std::auto_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb, NoValidityCheck )
 {
-    HandledBox<3>::Vector boxes;
-    compute_bboxes( detail::GeometrySet<3>( ga ), std::back_inserter( boxes ) );
-    const unsigned numBoxA = boxes.size();
-    compute_bboxes( detail::GeometrySet<3>( gb ), std::back_inserter( boxes ) );
+    detail::GeometrySet<3> output;
+    union_( detail::GeometrySet<3>( ga ), detail::GeometrySet<3>( gb ), output );
 
-    CGAL::box_intersection_d( boxes.begin(), boxes.begin() + numBoxA,
-                              boxes.begin() + numBoxA, boxes.end(),
-                              UnionOnBoxCollision<3>() );
+    std::auto_ptr<Geometry> result( output.recompose() );
+    applyResultPrecision( *result );
 
-    detail::GeometrySet<3> output;
-    collectPrimitives( boxes, output );
-    return output.recompose();
+    return result;
 }
 
 
@@ -984,14 +978,260 @@ std::auto_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb )
     return result;
 }
 
+namespace {
+
+void assertUnionOperandValidity( const Geometry& g, detail::dim_t<2> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
+}
+
+void assertUnionOperandValidity( const Geometry& g, detail::dim_t<3> )
+{
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( g );
+}
+
+// interleaves the bits of x and y (Z-order curve)
+uint32_t mortonCode( uint32_t x, uint32_t y )
+{
+    uint32_t code = 0;
+
+    for ( int i = 0; i < 16; i++ ) {
+        code |= ( ( x >> i ) & 1U ) << ( 2 * i );
+        code |= ( ( y >> i ) & 1U ) << ( 2 * i + 1 );
+    }
+
+    return code;
+}
+
+// sorts the non empty geometries along a Z-order curve on the centers of their envelopes,
+// so that the subtrees of the union reduction group close geometries
+void spatialSort( const std::vector< const Geometry* >& geometries, std::vector< const Geometry* >& sorted )
+{
+    std::vector< Envelope > envelopes;
+    std::vector< const Geometry* > nonEmpty;
+    Envelope extent;
+
+    for ( size_t i = 0; i < geometries.size(); i++ ) {
+        BOOST_ASSERT( geometries[i] != NULL );
+        const Envelope envelope = geometries[i]->envelope();
+
+        if ( envelope.isEmpty() ) {
+            continue;
+        }
+
+        envelopes.push_back( envelope );
+        nonEmpty.push_back( geometries[i] );
+        extent.expandToInclude( Coordinate( envelope.xMin(), envelope.yMin() ) );
+        extent.expandToInclude( Coordinate( envelope.xMax(), envelope.yMax() ) );
+    }
+
+    // (code, rank) : the input order is kept for equal codes
+    std::vector< std::pair< uint32_t, size_t > > keys;
+    keys.reserve( nonEmpty.size() );
+
+    const double width = nonEmpty.empty() ? 1.0 : std::max( extent.xMax() - extent.xMin(), 1e-300 );
+    const double height = nonEmpty.empty() ? 1.0 : std::max( extent.yMax() - extent.yMin(), 1e-300 );
+
+    for ( size_t i = 0; i < nonEmpty.size(); i++ ) {
+        const double u = ( 0.5 * ( envelopes[i].xMin() + envelopes[i].xMax() ) - extent.xMin() ) / width;
+        const double v = ( 0.5 * ( envelopes[i].yMin() + envelopes[i].yMax() ) - extent.yMin() ) / height;
+        keys.push_back( std::make_pair( mortonCode( uint32_t( u * 65535.0 ), uint32_t( v * 65535.0 ) ), i ) );
+    }
+
+    std::sort( keys.begin(), keys.end() );
+
+    sorted.clear();
+    sorted.reserve( keys.size() );
+
+    for ( size_t i = 0; i < keys.size(); i++ ) {
+        sorted.push_back( nonEmpty[ keys[i].second ] );
+    }
+}
+
+// union of the geometries [begin,end) (not empty range) through a balanced binary tree
+template <int Dim>
+void unionReduce( const std::vector< const Geometry* >& geometries, size_t begin, size_t end, detail::GeometrySet<Dim>& output )
+{
+    if ( end - begin == 1 ) {
+        assertUnionOperandValidity( *geometries[begin], detail::dim_t<Dim>() );
+        output.addGeometry( *geometries[begin] );
+        return;
+    }
+
+    const size_t middle = begin + ( end - begin ) / 2;
+    detail::GeometrySet<Dim> left, right;
+    unionReduce( geometries, begin, middle, left );
+    unionReduce( geometries, middle, end, right );
+    union_( left, right, output );
+}
+
+const size_t NO_CHILD = static_cast< size_t >( -1 );
+
+// top of the union tree shared between threads : the leaves are reduced by unionReduce
+struct UnionNode {
+    UnionNode( size_t begin_, size_t end_ ):
+        begin( begin_ ), end( end_ ), left( NO_CHILD ), right( NO_CHILD ) {
+    }
+
+    size_t begin;
+    size_t end;
+    size_t left;
+    size_t right;
+};
+
+// splits [begin,end) as unionReduce does, down to maxDepth. levels[d] receives the nodes of depth d
+size_t buildUnionTree( size_t begin, size_t end, size_t depth, size_t maxDepth,
+                       std::vector< UnionNode >& nodes, std::vector< std::vector< size_t > >& levels )
+{
+    const size_t n = nodes.size();
+    nodes.push_back( UnionNode( begin, end ) );
+    levels[depth].push_back( n );
+
+    if ( depth < maxDepth && end - begin > 1 ) {
+        const size_t middle = begin + ( end - begin ) / 2;
+        const size_t left = buildUnionTree( begin, middle, depth + 1, maxDepth, nodes, levels );
+        const size_t right = buildUnionTree( middle, end, depth + 1, maxDepth, nodes, levels );
+        nodes[n].left = left;
+        nodes[n].right = right;
+    }
+
+    return n;
+}
+
+// reduces the k-th node of a level, the children (deeper level) are already reduced
+template <int Dim>
+struct ReduceUnionNode {
+    ReduceUnionNode( const std::vector< const Geometry* >& geometries, const std::vector< UnionNode >& nodes,
+                     const std::vector< size_t >& level, std::vector< detail::GeometrySet<Dim> >& outputs ):
+        _geometries( geometries ), _nodes( nodes ), _level( level ), _outputs( outputs ) {
+    }
+
+    void operator()( const size_t& k ) const {
+        const UnionNode& node = _nodes[ _level[k] ];
+        detail::GeometrySet<Dim>& output = _outputs[ _level[k] ];
+
+        if ( node.left == NO_CHILD ) {
+            unionReduce( _geometries, node.begin, node.end, output );
+            return;
+        }
+
+        union_( _outputs[node.left], _outputs[node.right], output );
+
+        // the children are not used anymore
+        _outputs[node.left] = detail::GeometrySet<Dim>();
+        _outputs[node.right] = detail::GeometrySet<Dim>();
+    }
+
+private:
+    const std::vector< const Geometry* >& _geometries;
+    const std::vector< UnionNode >& _nodes;
+    const std::vector< size_t >& _level;
+    std::vector< detail::GeometrySet<Dim> >& _outputs;
+};
+
+template <int Dim>
+std::auto_ptr<Geometry> unionTree( const std::vector< const Geometry* >& geometries, size_t numThreads )
+{
+    // refuses numThreads != 1 without thread support
+    const ExecutionPolicy policy( numThreads, 2 );
+
+    std::vector< const Geometry* > sorted;
+    spatialSort( geometries, sorted );
+
+    // each operand is read by one thread : the ones with exact coordinates, shared by their copies, are copied
+    boost::ptr_vector< Geometry > copies;
+    numThreads = policy.threadsFor( sorted.size() );
+
+    for ( size_t i = 0; numThreads > 1 && i < sorted.size(); i++ ) {
+        if ( detail::sharesLazyExact( *sorted[i] ) ) {
+            copies.push_back( detail::deepClone( *sorted[i] ).release() );
+            sorted[i] = &copies.back();
+        }
+    }
+
+    // outputs[0] receives the union (the root of the tree)
+    std::vector< detail::GeometrySet<Dim> > outputs( 1 );
+
+    if ( ! sorted.empty() ) {
+        // one subtree per thread, the levels above are reduced from the bottom, each level in parallel
+        size_t maxDepth = 0;
+
+        while ( ( size_t( 1 ) << maxDepth ) < numThreads ) {
+            maxDepth++;
+        }
+
+        std::vector< UnionNode > nodes;
+        std::vector< std::vector< size_t > > levels( maxDepth + 1 );
+        buildUnionTree( 0, sorted.size(), 0, maxDepth, nodes, levels );
+
+        outputs.resize( nodes.size() );
+
+        for ( size_t depth = maxDepth + 1; depth-- > 0; ) {
+            detail::parallelFor( levels[depth].size(), ReduceUnionNode<Dim>( sorted, nodes, levels[depth], outputs ),
+                                 std::min( numThreads, levels[depth].size() ) );
+        }
+    }
+
+    std::auto_ptr<Geometry> result( outputs[0].recompose() );
+    applyResultPrecision( *result );
+
+    return result;
+}
+
+// the parts of a collection, or the geometry itself
+void unionOperands( const Geometry& g, std::vector< const Geometry* >& operands )
+{
+    if ( g.is< GeometryCollection >() ) {
+        for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+            operands.push_back( &g.geometryN( i ) );
+        }
+    }
+    else {
+        operands.push_back( &g );
+    }
+}
+
+}
+
+std::auto_ptr<Geometry> unaryUnion( const Geometry& g, size_t numThreads )
+{
+    std::vector< const Geometry* > operands;
+    unionOperands( g, operands );
+    return union_( operands, numThreads );
+}
+
+std::auto_ptr<Geometry> unaryUnion3D( const Geometry& g, size_t numThreads )
+{
+    std::vector< const Geometry* > operands;
+    unionOperands( g, operands );
+    return union3D( operands, numThreads );
+}
+
+std::auto_ptr<Geometry> union_( const std::vector< const Geometry* >& geometries, size_t numThreads )
+{
+    std::auto_ptr<Geometry> result( unionTree<2>( geometries, numThreads ) );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( *result );
+    return result;
+}
+
+std::auto_ptr<Geometry> union3D( const std::vector< const Geometry* >& geometries, size_t numThreads )
+{
+    std::auto_ptr<Geometry> result( unionTree<3>( geometries, numThreads ) );
+    SFCGAL_ASSERT_GEOMETRY_VALIDITY_3D( *result );
+    return result;
+}
+
 void handleLeakTest()
 {
-    Handle<2> h0( Point_2( 0,0 ) );
-    Handle<2> h1( Point_2( 1,1 ) );
-    Handle<2> empty;
+    PrimitiveUnionFind<2> primitives;
+    Handle<2> h0( primitives, Point_2( 0,0 ) );
+    Handle<2> h1( primitives, Point_2( 1,1 ) );
+    Handle<2> empty( primitives, EmptyPrimitive() );
     empty.registerObservers( empty );
     empty.registerObservers( h0 );
     h1.registerObservers( h0 );
+    BOOST_ASSERT( h0.asPoint() == Point_2( 1,1 ) );
+    BOOST_ASSERT( &primitives.primitive( 0 ) == &primitives.primitive( 1 ) );
 }
 }
-}
+SFCGAL_END_NAMESPACE
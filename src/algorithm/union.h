@@ -24,8 +24,10 @@
 #include <SFCGAL/config.h>
 
 #include <memory>
+#include <vector>
+#include <cstddef>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
 namespace detail {
 template <int Dim> class GeometrySet;
@@ -65,6 +67,40 @@ SFCGAL_API std::auto_ptr<Geometry> union3D( const Geometry& ga, const Geometry&
  */
 SFCGAL_API std::auto_ptr<Geometry> union3D( const Geometry& ga, const Geometry& gb, NoValidityCheck );
 
+/**
+ * Union of the parts of a 2D geometry collection (or of a single geometry).
+ *
+ * The parts are spatially sorted and merged through a balanced binary tree : each union
+ * involves geometries of similar sizes, instead of an ever growing accumulator.
+ *
+ * @param numThreads number of threads reducing the subtrees (0 for one thread per core)
+ * @pre g is a valid geometry
+ * @throw NotImplementedException if numThreads != 1 and CGAL is built without thread support (see ExecutionPolicy)
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> unaryUnion( const Geometry& g, size_t numThreads = 1 );
+
+/**
+ * Union of the parts of a 3D geometry collection (or of a single geometry). Assume z = 0 if needed
+ * @see unaryUnion
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> unaryUnion3D( const Geometry& g, size_t numThreads = 1 );
+
+/**
+ * Union of a list of 2D geometries (see unaryUnion)
+ * @pre the geometries are valid and not NULL
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> union_( const std::vector< const Geometry* >& geometries, size_t numThreads = 1 );
+
+/**
+ * Union of a list of 3D geometries (see unaryUnion). Assume z = 0 if needed
+ * @pre the geometries are valid and not NULL
+ * @ingroup public_api
+ */
+SFCGAL_API std::auto_ptr<Geometry> union3D( const std::vector< const Geometry* >& geometries, size_t numThreads = 1 );
+
 /**
  * @ingroup detail
  */
@@ -78,6 +114,6 @@ template <int Dim>
 void union_( const detail::PrimitiveHandle<Dim>& a, const detail::PrimitiveHandle<Dim>& b, detail::GeometrySet<Dim>& );
 
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
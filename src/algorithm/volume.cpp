@@ -25,7 +25,7 @@
 #include <SFCGAL/GeometryCollection.h>
 #include <SFCGAL/Solid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 const Kernel::FT volume( const Solid& solid, NoValidityCheck )
@@ -39,11 +39,18 @@ const Kernel::FT volume( const Solid& solid, NoValidityCheck )
         const TriangulatedSurface& tin = t->as<TriangulatedSurface>();
         const size_t numTriangles = tin.numTriangles();
 
+        // each (shared) vertex is converted once
+        std::vector< CGAL::Point_3<Kernel> > points;
+        points.reserve( tin.numVertices() );
+
+        for ( size_t j=0; j<tin.numVertices(); j++ ) {
+            points.push_back( tin.vertexN( j ).toPoint_3() );
+        }
+
         for ( size_t j=0; j<numTriangles; j++ ) {
-            const Triangle& tri = tin.triangleN( j );
-            vol = vol + CGAL::volume( origin, tri.vertex( 0 ).toPoint_3(),
-                                      tri.vertex( 1 ).toPoint_3(),
-                                      tri.vertex( 2 ).toPoint_3() );
+            vol = vol + CGAL::volume( origin, points[ tin.vertexIndex( j, 0 ) ],
+                                      points[ tin.vertexIndex( j, 1 ) ],
+                                      points[ tin.vertexIndex( j, 2 ) ] );
         }
     }
 
@@ -94,4 +101,4 @@ const Kernel::FT volume( const Geometry& g )
 }
 
 }
-}
+SFCGAL_END_NAMESPACE
@@ -25,7 +25,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace algorithm {
 
 struct NoValidityCheck;
@@ -45,6 +45,6 @@ SFCGAL_API const Kernel::FT volume( const Geometry& g );
 SFCGAL_API const Kernel::FT volume( const Solid& g, NoValidityCheck );
 
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -38,6 +38,7 @@
 
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/io/ewkt.h>
+#include <SFCGAL/GeometryArena.h>
 #include <SFCGAL/detail/io/Serialization.h>
 
 #include <SFCGAL/algorithm/isValid.h>
@@ -57,6 +58,8 @@
 #include <SFCGAL/algorithm/minkowskiSum.h>
 #include <SFCGAL/algorithm/offset.h>
 #include <SFCGAL/algorithm/straightSkeleton.h>
+#include <SFCGAL/algorithm/compactExact.h>
+#include <SFCGAL/algorithm/memoryFootprint.h>
 
 #include <SFCGAL/detail/transform/ForceZOrderPoints.h>
 #include <SFCGAL/detail/transform/ForceOrderPoints.h>
@@ -127,6 +130,53 @@ extern "C" void sfcgal_set_alloc_handlers( sfcgal_alloc_handler_t alloc_handler,
     __sfcgal_free_handler = free_handler;
 }
 
+extern "C" int sfcgal_arena_enabled()
+{
+    return SFCGAL::GeometryArena::enabled() ? 1 : 0;
+}
+
+extern "C" sfcgal_arena_t* sfcgal_arena_create()
+{
+    if ( ! SFCGAL::GeometryArena::enabled() ) {
+        SFCGAL_ERROR( "sfcgal_arena_create: SFCGAL is built without the SFCGAL_WITH_GEOMETRY_ARENA option" );
+        return 0;
+    }
+
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
+        return new SFCGAL::GeometryArena();
+    )
+}
+
+extern "C" int sfcgal_arena_activate( sfcgal_arena_t* arena )
+{
+    if ( ! SFCGAL::GeometryArena::enabled() ) {
+        SFCGAL_ERROR( "sfcgal_arena_activate: SFCGAL is built without the SFCGAL_WITH_GEOMETRY_ARENA option" );
+        return 0;
+    }
+
+    if ( arena == NULL ) {
+        SFCGAL_ERROR( "sfcgal_arena_activate: NULL arena" );
+        return 0;
+    }
+
+    SFCGAL::GeometryArena::setCurrent( reinterpret_cast<SFCGAL::GeometryArena*>( arena ) );
+    return 1;
+}
+
+extern "C" void sfcgal_arena_deactivate()
+{
+    SFCGAL::GeometryArena::setCurrent( NULL );
+}
+
+extern "C" void sfcgal_arena_delete( sfcgal_arena_t* arena )
+{
+    if ( SFCGAL::GeometryArena::current() == arena ) {
+        SFCGAL::GeometryArena::setCurrent( NULL );
+    }
+
+    delete reinterpret_cast<SFCGAL::GeometryArena*>( arena );
+}
+
 extern "C" void sfcgal_init()
 {
     // Empty for now
@@ -487,7 +537,7 @@ extern "C" size_t sfcgal_triangulated_surface_num_triangles( const sfcgal_geomet
 extern "C" const sfcgal_geometry_t* sfcgal_triangulated_surface_triangle_n( const sfcgal_geometry_t* geom, size_t i )
 {
     SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
-        return static_cast<const SFCGAL::Geometry*>( &down_const_cast<SFCGAL::TriangulatedSurface>( geom )->triangleN( i ) );
+        return static_cast<const SFCGAL::Geometry*>( &down_const_cast<SFCGAL::TriangulatedSurface>( geom )->geometryN( i ) );
     )
 }
 
@@ -594,6 +644,15 @@ extern "C" void sfcgal_prepared_geometry_as_ewkt( const sfcgal_prepared_geometry
     )
 }
 
+extern "C" void sfcgal_prepared_geometry_memory_footprint( const sfcgal_prepared_geometry_t* pgeom, size_t* structural_bytes, size_t* exact_bytes )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const SFCGAL::algorithm::MemoryFootprint footprint = SFCGAL::algorithm::memoryFootprint( *reinterpret_cast<const SFCGAL::PreparedGeometry*>( pgeom ) );
+        *structural_bytes = footprint.structuralBytes;
+        *exact_bytes = footprint.exactBytes;
+    )
+}
+
 extern "C" sfcgal_geometry_t* sfcgal_io_read_wkt( const char* str, size_t len )
 {
     SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR(
@@ -940,6 +999,22 @@ extern "C" sfcgal_geometry_t* sfcgal_geometry_round( const sfcgal_geometry_t* ga
     return gb;
 }
 
+extern "C" void sfcgal_geometry_compact_exact( sfcgal_geometry_t* geom, int round_to_double )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        SFCGAL::algorithm::compactExact( *reinterpret_cast<SFCGAL::Geometry*>( geom ), round_to_double != 0 );
+    )
+}
+
+extern "C" void sfcgal_geometry_memory_footprint( const sfcgal_geometry_t* geom, size_t* structural_bytes, size_t* exact_bytes )
+{
+    SFCGAL_GEOMETRY_CONVERT_CATCH_TO_ERROR_NO_RET(
+        const SFCGAL::algorithm::MemoryFootprint footprint = SFCGAL::algorithm::memoryFootprint( *reinterpret_cast<const SFCGAL::Geometry*>( geom ) );
+        *structural_bytes = footprint.structuralBytes;
+        *exact_bytes = footprint.exactBytes;
+    )
+}
+
 extern "C" sfcgal_geometry_t* sfcgal_geometry_minkowski_sum( const sfcgal_geometry_t* ga, const sfcgal_geometry_t* gb )
 {
     const SFCGAL::Geometry* g1 = reinterpret_cast<const SFCGAL::Geometry*>( ga );
@@ -535,6 +535,12 @@ SFCGAL_API void                        sfcgal_prepared_geometry_set_srid( sfcgal
  */
 SFCGAL_API void                        sfcgal_prepared_geometry_as_ewkt( const sfcgal_prepared_geometry_t* prepared, int num_decimals, char** buffer, size_t* len );
 
+/**
+ * Returns the memory used by the given PreparedGeometry and its cached decompositions (see @ref sfcgal_geometry_memory_footprint)
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_prepared_geometry_memory_footprint( const sfcgal_prepared_geometry_t* prepared, size_t* structural_bytes, size_t* exact_bytes );
+
 /*--------------------------------------------------------------------------------------*
  *
  * I/O functions
@@ -757,6 +763,22 @@ SFCGAL_API double                      sfcgal_geometry_distance_3d( const sfcgal
  */
 SFCGAL_API sfcgal_geometry_t*          sfcgal_geometry_round( const sfcgal_geometry_t* geom, int r );
 
+/**
+ * Drops the lazy exact construction history of the coordinates of the given Geometry (in place).
+ * Coordinates are reduced to their exact value, or to doubles when they are exact (or when round_to_double != 0)
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_geometry_compact_exact( sfcgal_geometry_t* geom, int round_to_double );
+
+/**
+ * Returns the memory used by the given Geometry : the bytes of the geometry objects and
+ * their containers (structural_bytes) and the bytes of the exact representations of
+ * the coordinates (exact_bytes). A lazy exact node shared by several coordinates is counted once,
+ * the construction history of an unevaluated node is not counted (see @ref sfcgal_geometry_compact_exact)
+ * @ingroup capi
+ */
+SFCGAL_API void                        sfcgal_geometry_memory_footprint( const sfcgal_geometry_t* geom, size_t* structural_bytes, size_t* exact_bytes );
+
 /**
  * Returns the minkowski sum geom1 + geom2
  * @pre isValid(geom1) == true
@@ -829,6 +851,49 @@ typedef void ( *sfcgal_free_handler_t ) ( void* );
  */
 SFCGAL_API void sfcgal_set_alloc_handlers( sfcgal_alloc_handler_t malloc_handler, sfcgal_free_handler_t free_handler );
 
+/**
+ * Opaque type that represents the C++ type SFCGAL::GeometryArena
+ * @ingroup capi
+ */
+typedef void sfcgal_arena_t;
+
+/**
+ * Tests if SFCGAL is built with the SFCGAL_WITH_GEOMETRY_ARENA option, without which the arena
+ * functions are not available
+ * @ingroup capi
+ */
+SFCGAL_API int sfcgal_arena_enabled();
+
+/**
+ * Creates a geometry arena, a memory region geometries can be allocated from
+ * @post returns a pointer to an arena that must be deallocated by @ref sfcgal_arena_delete,
+ * NULL (with an error) if the arena is not available (see @ref sfcgal_arena_enabled)
+ * @ingroup capi
+ */
+SFCGAL_API sfcgal_arena_t* sfcgal_arena_create();
+
+/**
+ * Activates an arena in the calling thread : every geometry object created by this thread (parsing, results
+ * of spatial operations...) is allocated in the arena until @ref sfcgal_arena_deactivate is called.
+ * Only the geometry objects are taken from the arena : their coordinates and exact numbers stay on the heap.
+ * @return 1 if the arena is active, 0 (with an error) if arena is NULL or the arena is not available
+ * @ingroup capi
+ */
+SFCGAL_API int sfcgal_arena_activate( sfcgal_arena_t* arena );
+
+/**
+ * Deactivates the arena of the calling thread
+ * @ingroup capi
+ */
+SFCGAL_API void sfcgal_arena_deactivate();
+
+/**
+ * Deletes an arena and releases at once the memory of the geometries allocated in it
+ * @pre geometries allocated in the arena must have been deleted with @ref sfcgal_geometry_delete
+ * @ingroup capi
+ */
+SFCGAL_API void sfcgal_arena_delete( sfcgal_arena_t* arena );
+
 /*--------------------------------------------------------------------------------------*
  *
  * Init
@@ -30,6 +30,14 @@
  * indicates if MPFR is available
  */
 #cmakedefine SFCGAL_WITH_MPFR
+/**
+ * indicates if the exact arithmetic fallbacks of the predicates are counted (see FilterStatistics)
+ */
+#cmakedefine SFCGAL_WITH_FILTER_STATISTICS
+/**
+ * indicates if the geometries are allocated in the active GeometryArena
+ */
+#cmakedefine SFCGAL_WITH_GEOMETRY_ARENA
 
 
 /**
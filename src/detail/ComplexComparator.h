@@ -25,7 +25,7 @@
 
 #include <complex>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 /**
@@ -40,7 +40,7 @@ struct SFCGAL_API ComplexComparator {
 
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
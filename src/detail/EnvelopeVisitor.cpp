@@ -34,7 +34,7 @@
 #include <SFCGAL/MultiSolid.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 ///
@@ -161,12 +161,14 @@ void EnvelopeVisitor::visit( const PolyhedralSurface& g )
 ///
 void EnvelopeVisitor::visit( const TriangulatedSurface& g )
 {
-    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        visit( g.geometryN( i ) );
+    for ( size_t i = 0; i < g.numTriangles(); i++ ) {
+        for ( size_t j = 0; j < 3; j++ ) {
+            visit( g.triangleVertex( i, j ) );
+        }
     }
 }
 
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -27,7 +27,7 @@
 
 #include <vector>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 /**
@@ -57,7 +57,7 @@ public:
 
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -65,15 +65,16 @@ bool operator< ( const CGAL::Segment_3<SFCGAL::Kernel>& sega, const CGAL::Segmen
     return sega.source() < segb.source();
 }
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
-void _decompose_triangle( const Triangle& tri, GeometrySet<2>::SurfaceCollection& surfaces, dim_t<2> )
+// triangle given by its converted vertices
+void _decompose_triangle( const Kernel::Point_2& a, const Kernel::Point_2& b, const Kernel::Point_2& c, GeometrySet<2>::SurfaceCollection& surfaces )
 {
     CGAL::Polygon_2<Kernel> outer;
-    outer.push_back( tri.vertex( 0 ).toPoint_2() );
-    outer.push_back( tri.vertex( 1 ).toPoint_2() );
-    outer.push_back( tri.vertex( 2 ).toPoint_2() );
+    outer.push_back( a );
+    outer.push_back( b );
+    outer.push_back( c );
 
     if ( outer.orientation() == CGAL::CLOCKWISE ) {
         outer.reverse_orientation();
@@ -81,12 +82,41 @@ void _decompose_triangle( const Triangle& tri, GeometrySet<2>::SurfaceCollection
 
     surfaces.push_back( CGAL::Polygon_with_holes_2<Kernel>( outer ) );
 }
-void _decompose_triangle( const Triangle& tri, GeometrySet<3>::SurfaceCollection& surfaces, dim_t<3> )
+void _decompose_triangle( const Kernel::Point_3& a, const Kernel::Point_3& b, const Kernel::Point_3& c, GeometrySet<3>::SurfaceCollection& surfaces )
 {
-    CGAL::Triangle_3<Kernel> outtri( tri.vertex( 0 ).toPoint_3(),
-                                     tri.vertex( 1 ).toPoint_3(),
-                                     tri.vertex( 2 ).toPoint_3() );
-    surfaces.push_back( outtri );
+    surfaces.push_back( CGAL::Triangle_3<Kernel>( a, b, c ) );
+}
+
+template < int Dim >
+void _decompose_triangle( const Triangle& tri, typename GeometrySet<Dim>::SurfaceCollection& surfaces )
+{
+    _decompose_triangle( tri.vertex( 0 ).toPoint_d<Dim>(), tri.vertex( 1 ).toPoint_d<Dim>(), tri.vertex( 2 ).toPoint_d<Dim>(), surfaces );
+}
+
+// the vertices of a TriangulatedSurface are converted once, not once per triangle
+// (the triangles sharing a vertex share its kernel point)
+template < int Dim >
+void _decompose_triangulated_surface( const TriangulatedSurface& surf, typename GeometrySet<Dim>::SurfaceCollection& surfaces )
+{
+    std::vector< typename TypeForDimension<Dim>::Point > vertices ;
+    vertices.reserve( surf.numVertices() );
+
+    for ( size_t i = 0; i < surf.numVertices(); ++i ) {
+        vertices.push_back( surf.vertexN( i ).toPoint_d<Dim>() );
+    }
+
+    surfaces.reserve( surfaces.size() + surf.numTriangles() );
+
+    for ( size_t i = 0; i < surf.numTriangles(); ++i ) {
+        if ( surf.triangleVertex( i, 0 ).isEmpty() ) {
+            continue ;
+        }
+
+        _decompose_triangle( vertices[ surf.vertexIndex( i, 0 ) ],
+                             vertices[ surf.vertexIndex( i, 1 ) ],
+                             vertices[ surf.vertexIndex( i, 2 ) ],
+                             surfaces );
+    }
 }
 
 void _decompose_polygon( const Polygon& poly, GeometrySet<2>::SurfaceCollection& surfaces, dim_t<2> )
@@ -99,14 +129,7 @@ void _decompose_polygon( const Polygon& poly, GeometrySet<3>::SurfaceCollection&
     BOOST_ASSERT( ! poly.isEmpty() );
     TriangulatedSurface surf;
     triangulate::triangulatePolygon3D( poly, surf );
-
-    for ( size_t i = 0; i < surf.numTriangles(); ++i ) {
-        const Triangle& tri = surf.triangleN( i );
-        surfaces.push_back( CGAL::Triangle_3<Kernel>( tri.vertex( 0 ).toPoint_3(),
-                            tri.vertex( 1 ).toPoint_3(),
-                            tri.vertex( 2 ).toPoint_3() )
-                          );
-    }
+    _decompose_triangulated_surface<3>( surf, surfaces );
 }
 
 void _decompose_solid( const Solid&, GeometrySet<2>::VolumeCollection&, dim_t<2> )
@@ -137,6 +160,7 @@ template <int Dim>
 GeometrySet<Dim>::GeometrySet( const Geometry& g )
 {
     _decompose( g );
+    _normalize();
 }
 
 template <int Dim>
@@ -166,16 +190,38 @@ GeometrySet<Dim>::GeometrySet( const typename TypeForDimension<Dim>::Volume& g,
 template <int Dim>
 void GeometrySet<Dim>::merge( const GeometrySet<Dim>& g )
 {
-    std::copy( g.points().begin(), g.points().end(), std::inserter( points(), points().end() ) );
-    std::copy( g.segments().begin(), g.segments().end(), std::inserter( segments(), segments().end() ) );
-    std::copy( g.surfaces().begin(), g.surfaces().end(), std::back_inserter( surfaces() ) );
+    _points.merge( g.points() );
+    _segments.merge( g.segments() );
+    _surfaces.insert( _surfaces.end(), g.surfaces().begin(), g.surfaces().end() );
     std::copy( g.volumes().begin(), g.volumes().end(), std::back_inserter( volumes() ) );
 }
 
+template <int Dim>
+void GeometrySet<Dim>::merge( const std::vector< GeometrySet<Dim> >& sets )
+{
+    for ( typename std::vector< GeometrySet<Dim> >::const_iterator it = sets.begin(); it != sets.end(); ++it ) {
+        for ( typename PointCollection::const_iterator p = it->points().begin(); p != it->points().end(); ++p ) {
+            _points.append( *p );
+        }
+
+        for ( typename SegmentCollection::const_iterator s = it->segments().begin(); s != it->segments().end(); ++s ) {
+            _segments.append( *s );
+        }
+
+        _surfaces.insert( _surfaces.end(), it->surfaces().begin(), it->surfaces().end() );
+        std::copy( it->volumes().begin(), it->volumes().end(), std::back_inserter( volumes() ) );
+    }
+
+    // the first occurrence of duplicates is kept, as with merge( g ) on each set
+    _points.normalize();
+    _segments.normalize();
+}
+
 template <int Dim>
 void GeometrySet<Dim>::addGeometry( const Geometry& g )
 {
     _decompose( g );
+    _normalize();
 }
 
 template <>
@@ -252,7 +298,7 @@ void GeometrySet<3>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
             _decompose_polygon( poly, _surfaces, dim_t<3>() );
         }
         else {
-            std::copy( pts->begin(), pts->end(), std::inserter( _points, _points.end() ) );
+            _points.insert( pts->begin(), pts->end() );
         }
     }
     else if ( const TSegment* p = CGAL::object_cast<TSegment>( &o ) ) {
@@ -291,7 +337,7 @@ void GeometrySet<2>::addPrimitive( const CGAL::Object& o, bool pointsAsRing )
             _surfaces.push_back( polyh );
         }
         else {
-            std::copy( pts->begin(), pts->end(), std::inserter( _points, _points.end() ) );
+            _points.insert( pts->begin(), pts->end() );
         }
     }
     else if ( const CGAL::Triangle_2<Kernel>* tri = CGAL::object_cast<CGAL::Triangle_2<Kernel> >( &o ) ) {
@@ -450,23 +496,27 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
 
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
-        _points.insert( g.as<Point>().toPoint_d<Dim>() );
+        _points.append( g.as<Point>().toPoint_d<Dim>() );
         break;
 
     case TYPE_LINESTRING: {
         const LineString& ls = g.as<LineString>();
+        _segments.reserve( _segments.size() + ls.numPoints() - 1 );
+
+        // each point is converted once, consecutive segments share their kernel point
+        typename TypeForDimension<Dim>::Point source = ls.pointN( 0 ).toPoint_d<Dim>();
 
-        for ( size_t i = 0; i < ls.numPoints() - 1; ++i ) {
-            typename TypeForDimension<Dim>::Segment seg( ls.pointN( i ).toPoint_d<Dim>(),
-                    ls.pointN( i+1 ).toPoint_d<Dim>() );
-            _segments.insert( seg );
+        for ( size_t i = 1; i < ls.numPoints(); ++i ) {
+            const typename TypeForDimension<Dim>::Point target = ls.pointN( i ).toPoint_d<Dim>();
+            _segments.append( typename TypeForDimension<Dim>::Segment( source, target ) );
+            source = target ;
         }
 
         break;
     }
 
     case TYPE_TRIANGLE: {
-        _decompose_triangle( g.as<Triangle>(), _surfaces, dim_t<Dim>() );
+        _decompose_triangle<Dim>( g.as<Triangle>(), _surfaces );
         break;
     }
 
@@ -476,12 +526,7 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
     }
 
     case TYPE_TRIANGULATEDSURFACE: {
-        const TriangulatedSurface& tri = g.as<TriangulatedSurface>();
-
-        for ( size_t i = 0; i < tri.numTriangles(); ++i ) {
-            _decompose( tri.triangleN( i ) );
-        }
-
+        _decompose_triangulated_surface<Dim>( g.as<TriangulatedSurface>(), _surfaces );
         break;
     }
 
@@ -506,17 +551,26 @@ void GeometrySet<Dim>::_decompose( const Geometry& g )
     }
 }
 
+template <int Dim>
+void GeometrySet<Dim>::_normalize()
+{
+    _points.normalize();
+    _segments.normalize();
+}
 
 template <int Dim>
 void GeometrySet<Dim>::computeBoundingBoxes( typename HandleCollection<Dim>::Type& handles,
         typename BoxCollection<Dim>::Type& boxes ) const
 {
+    // boxes point to the handles : no reallocation is allowed while they are filled
+    const size_t numPrimitives = _points.size() + _segments.size() + _surfaces.size() + _volumes.size() ;
+    handles.clear();
+    handles.reserve( numPrimitives );
     boxes.clear();
+    boxes.reserve( numPrimitives );
 
     for ( typename PointCollection::const_iterator it = _points.begin(); it != _points.end(); ++it ) {
-        const typename TypeForDimension<Dim>::Point* pt = &( it->primitive() );
-        PrimitiveHandle<Dim> h( pt );
-        handles.push_back( h );
+        handles.push_back( PrimitiveHandle<Dim>( &( it->primitive() ) ) );
         boxes.push_back( typename PrimitiveBox<Dim>::Type( it->primitive().bbox(), &handles.back() ) );
     }
 
@@ -684,9 +738,27 @@ void recompose_surfaces( const GeometrySet<3>::SurfaceCollection& surfaces, std:
 
 
     std::auto_ptr<TriangulatedSurface> tri( new TriangulatedSurface );
+    tri->reserve( surfaces.size() );
+
+    // equal vertices of the triangles are shared in the mesh
+    typedef std::map< CGAL::Point_3< Kernel >, size_t > VertexIndexMap ;
+    VertexIndexMap vertexIndex ;
 
     for ( GeometrySet<3>::SurfaceCollection::const_iterator it = surfaces.begin(); it != surfaces.end(); ++it ) {
-        tri->addTriangle( new Triangle( it->primitive() ) );
+        size_t index[3] ;
+
+        for ( int i = 0; i < 3; i++ ) {
+            const CGAL::Point_3< Kernel >& p = it->primitive().vertex( i );
+            const std::pair< VertexIndexMap::iterator, bool > inserted = vertexIndex.insert( std::make_pair( p, 0 ) );
+
+            if ( inserted.second ) {
+                inserted.first->second = tri->addVertex( Point( p ) );
+            }
+
+            index[i] = inserted.first->second ;
+        }
+
+        tri->addTriangle( index[0], index[1], index[2] );
     }
 
     algorithm::SurfaceGraph graph( *tri );
@@ -705,10 +777,27 @@ void recompose_surfaces( const GeometrySet<3>::SurfaceCollection& surfaces, std:
             output.push_back( sout[c] );
         }
 
-        const size_t numTriangles = tri->numTriangles() ;
+        // the vertices are copied once to the mesh of their component (the components
+        // don't share vertices)
+        const TriangulatedSurface& mesh = *tri ;
+        const size_t notAdded = static_cast< size_t >( -1 );
+        std::vector< size_t > componentIndex( mesh.numVertices(), notAdded );
+
+        for ( size_t t = 0; t != mesh.numTriangles(); ++t ) {
+            TriangulatedSurface& surface = *sout[ component[t] ] ;
+            size_t index[3] ;
 
-        for ( size_t t = 0; t != numTriangles; ++t ) {
-            sout[ component[t] ]->addTriangle( tri->triangleN( t ) );
+            for ( size_t i = 0; i < 3; i++ ) {
+                const size_t v = mesh.vertexIndex( t, i );
+
+                if ( componentIndex[v] == notAdded ) {
+                    componentIndex[v] = surface.addVertex( mesh.vertexN( v ) );
+                }
+
+                index[i] = componentIndex[v] ;
+            }
+
+            surface.addTriangle( index[0], index[1], index[2] );
         }
     }
 }
@@ -790,6 +879,7 @@ template <int Dim>
 std::auto_ptr<Geometry> GeometrySet<Dim>::recompose() const
 {
     std::vector<Geometry*> geometries;
+    geometries.reserve( _points.size() + _segments.size() + _surfaces.size() + _volumes.size() );
 
     recompose_points( _points, geometries, dim_t<Dim>() );
     recompose_segments( _segments, geometries, dim_t<Dim>() );
@@ -853,7 +943,7 @@ void _collect_points( const CGAL::Polygon_with_holes_2<Kernel>& poly, GeometrySe
     for ( CGAL::Polygon_2<Kernel>::Vertex_iterator vit = poly.outer_boundary().vertices_begin();
             vit != poly.outer_boundary().vertices_end();
             ++vit ) {
-        points.insert( *vit );
+        points.append( *vit );
     }
 
     for ( CGAL::Polygon_with_holes_2<Kernel>::Hole_const_iterator hit = poly.holes_begin();
@@ -862,16 +952,16 @@ void _collect_points( const CGAL::Polygon_with_holes_2<Kernel>& poly, GeometrySe
         for ( CGAL::Polygon_2<Kernel>::Vertex_iterator vit = hit->vertices_begin();
                 vit != hit->vertices_end();
                 ++vit ) {
-            points.insert( *vit );
+            points.append( *vit );
         }
     }
 }
 
 void _collect_points( const CGAL::Triangle_3<Kernel>& tri, GeometrySet<3>::PointCollection& points )
 {
-    points.insert( tri.vertex( 0 ) );
-    points.insert( tri.vertex( 1 ) );
-    points.insert( tri.vertex( 2 ) );
+    points.append( tri.vertex( 0 ) );
+    points.append( tri.vertex( 1 ) );
+    points.append( tri.vertex( 2 ) );
 }
 
 void _collect_points( const NoVolume&, GeometrySet<2>::PointCollection& )
@@ -883,7 +973,7 @@ void _collect_points( const MarkedPolyhedron& poly, GeometrySet<3>::PointCollect
     for ( MarkedPolyhedron::Vertex_const_iterator vit = poly.vertices_begin();
             vit != poly.vertices_end();
             ++vit ) {
-        points.insert( vit->point() );
+        points.append( vit->point() );
     }
 }
 
@@ -898,14 +988,14 @@ void GeometrySet<Dim>::collectPoints( const PrimitiveHandle<Dim>& pa )
     switch ( pa.handle.which() ) {
     case PrimitivePoint: {
         const TPoint* pt = boost::get<const TPoint*>( pa.handle );
-        _points.insert( *pt );
+        _points.append( *pt );
         break;
     }
 
     case PrimitiveSegment: {
         const TSegment* seg = boost::get<const TSegment*>( pa.handle );
-        _points.insert( seg->source() );
-        _points.insert( seg->target() );
+        _points.append( seg->source() );
+        _points.append( seg->target() );
         break;
     }
 
@@ -919,6 +1009,8 @@ void GeometrySet<Dim>::collectPoints( const PrimitiveHandle<Dim>& pa )
         break;
     }
     }
+
+    // normalized on the first read, once all the points are collected
 }
 
 template <int Dim, class IT>
@@ -1067,4 +1159,4 @@ std::ostream& operator<<( std::ostream& ostr, const GeometrySet<3>& g )
 template class GeometrySet<2>;
 template class GeometrySet<3>;
 } // detail
-} // SFCGAL
+SFCGAL_END_NAMESPACE
@@ -22,6 +22,9 @@
 #ifndef _SFCGAL_DETAIL_GEOMETRY_SET_H_
 #define _SFCGAL_DETAIL_GEOMETRY_SET_H_
 
+#include <list>
+#include <vector>
+
 #include <boost/ptr_container/ptr_vector.hpp>
 #include <boost/variant.hpp>
 
@@ -29,16 +32,17 @@
 
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/detail/SortedCollection.h>
 
 #include <CGAL/Bbox_2.h>
 #include <CGAL/Bbox_3.h>
 #include <CGAL/Box_intersection_d/Box_with_handle_d.h>
 
-// comparison operator on segments, for use in a std::set
+// comparison operator on segments, for use in a SortedCollection
 bool operator< ( const CGAL::Segment_2<SFCGAL::Kernel>& sega, const CGAL::Segment_2<SFCGAL::Kernel>& segb );
 bool operator< ( const CGAL::Segment_3<SFCGAL::Kernel>& sega, const CGAL::Segment_3<SFCGAL::Kernel>& segb );
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
 namespace detail {
 
@@ -89,9 +93,10 @@ struct BoxCollection {
 
 ///
 /// HandleCollection. Used to store PrimitiveHandle
+/// (the boxes point to its elements, it is reserved before being filled)
 template <int Dim>
 struct HandleCollection {
-    typedef std::list<PrimitiveHandle<Dim> > Type;
+    typedef std::vector<PrimitiveHandle<Dim> > Type;
 };
 
 ///
@@ -154,11 +159,12 @@ std::ostream& operator<<( std::ostream& ostr, const CollectionElement<Primitive>
 template <int Dim>
 class GeometrySet {
 public:
-    // Points are stored in an ordered set
-    typedef std::set<CollectionElement<typename Point_d<Dim>::Type> > PointCollection;
-    // Segments are stored in an ordered set
-    typedef std::set<CollectionElement<typename Segment_d<Dim>::Type> > SegmentCollection;
-    typedef std::list<CollectionElement<typename Surface_d<Dim>::Type> > SurfaceCollection;
+    // Points are stored in a sorted vector of unique points
+    typedef SortedCollection<CollectionElement<typename Point_d<Dim>::Type> > PointCollection;
+    // Segments are stored in a sorted vector of unique segments
+    typedef SortedCollection<CollectionElement<typename Segment_d<Dim>::Type> > SegmentCollection;
+    typedef std::vector<CollectionElement<typename Surface_d<Dim>::Type> > SurfaceCollection;
+    // Volumes are kept in a list, a polyhedron is costly to copy when a vector grows
     typedef std::list<CollectionElement<typename Volume_d<Dim>::Type> > VolumeCollection;
 
     GeometrySet();
@@ -192,6 +198,11 @@ public:
      * Add primitives from another set
      */
     void merge( const GeometrySet<Dim>& g );
+    /**
+     * Add primitives from a list of sets, in order. Same as merging the sets one by one,
+     * but the points and segments are sorted once.
+     */
+    void merge( const std::vector< GeometrySet<Dim> >& sets );
 
     /**
      * Add a geometry by decomposing it into CGAL primitives
@@ -215,7 +226,7 @@ public:
     void addPrimitive( const typename TypeForDimension<Dim>::Point& g, int flags = 0 );
     template <class IT>
     void addPoints( IT ibegin, IT iend ) {
-        std::copy( ibegin, iend, std::inserter( _points, _points.end() ) );
+        _points.insert( ibegin, iend );
     }
 
     /**
@@ -229,7 +240,7 @@ public:
     void addPrimitive( const typename TypeForDimension<Dim>::Segment& g, int flags = 0 );
     template <class IT>
     void addSegments( IT ibegin, IT iend ) {
-        std::copy( ibegin, iend, std::inserter( _segments, _segments.end() ) );
+        _segments.insert( ibegin, iend );
     }
 
     /**
@@ -271,7 +282,7 @@ public:
     void addBoundary( const typename TypeForDimension<Dim>::Volume& volume );
 
     /**
-     * Compute all bounding boxes and handles of the set
+     * Compute all bounding boxes and handles of the set (previous content of handles and boxes is cleared)
      */
     void computeBoundingBoxes( typename HandleCollection<Dim>::Type& handles, typename BoxCollection<Dim>::Type& boxes ) const;
 
@@ -333,7 +344,11 @@ public:
 private:
     ///
     /// Given an input SFCGAL::Geometry, decompose it into CGAL primitives
+    /// (points and segments are appended, see _normalize)
     void _decompose( const Geometry& g );
+    ///
+    /// Sort and deduplicate the appended points and segments
+    void _normalize();
 
     PointCollection _points;
     SegmentCollection _segments;
@@ -371,6 +386,6 @@ CGAL::Bbox_3 compute_solid_bbox( const TypeForDimension<3>::Volume& vol, dim_t<3
     return ret;
 }
 } // namespace detail
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
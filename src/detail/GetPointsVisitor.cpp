@@ -33,7 +33,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 ///
@@ -149,12 +149,14 @@ void GetPointsVisitor::visit( const PolyhedralSurface& g )
 ///
 void GetPointsVisitor::visit( const TriangulatedSurface& g )
 {
-    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        visit( g.geometryN( i ) );
+    for ( size_t i = 0; i < g.numTriangles(); i++ ) {
+        for ( size_t j = 0; j < 3; j++ ) {
+            visit( g.triangleVertex( i, j ) );
+        }
     }
 }
 
 
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
@@ -26,7 +26,7 @@
 #include <vector>
 #include <SFCGAL/GeometryVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 /**
@@ -53,7 +53,7 @@ public:
 
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
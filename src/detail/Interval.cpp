@@ -24,7 +24,7 @@
 #include <algorithm>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 ///
@@ -188,5 +188,5 @@ bool Interval::operator != ( const Interval& other ) const
 
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
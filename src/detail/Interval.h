@@ -23,7 +23,7 @@
 
 #include <SFCGAL/config.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 /**
@@ -124,6 +124,6 @@ private:
 };
 
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
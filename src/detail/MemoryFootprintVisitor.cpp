@@ -0,0 +1,204 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/MemoryFootprintVisitor.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/MultiPoint.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/MultiSolid.h>
+
+#include <boost/shared_ptr.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+///
+///
+///
+MemoryFootprintVisitor::MemoryFootprintVisitor():
+    structuralBytes( 0 ),
+    exactBytes( 0 ),
+    numLazyNodes( 0 )
+{
+
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const Point& g )
+{
+    structuralBytes += sizeof( Point ) ;
+    exactBytes += g.coordinate().exactBytes( countedLazyReps, numLazyNodes ) ;
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const LineString& g )
+{
+    // points are stored contiguously
+    structuralBytes += sizeof( LineString ) + g.numPoints() * sizeof( Point ) ;
+
+    for ( size_t i = 0; i < g.numPoints(); i++ ) {
+        exactBytes += g.pointN( i ).coordinate().exactBytes( countedLazyReps, numLazyNodes ) ;
+    }
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const Polygon& g )
+{
+    structuralBytes += sizeof( Polygon ) + g.numRings() * sizeof( LineString* ) ;
+
+    for ( size_t i = 0; i < g.numRings(); i++ ) {
+        visit( g.ringN( i ) );
+    }
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const Triangle& g )
+{
+    structuralBytes += sizeof( Triangle ) ;
+
+    for ( int i = 0; i < 3; i++ ) {
+        exactBytes += g.vertex( i ).coordinate().exactBytes( countedLazyReps, numLazyNodes ) ;
+    }
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const Solid& g )
+{
+    structuralBytes += sizeof( Solid ) + g.numShells() * sizeof( PolyhedralSurface* ) ;
+
+    for ( size_t i = 0; i < g.numShells(); i++ ) {
+        visit( g.shellN( i ) );
+    }
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const MultiPoint& g )
+{
+    structuralBytes += sizeof( MultiPoint ) ;
+    _visitGeometries( g );
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const MultiLineString& g )
+{
+    structuralBytes += sizeof( MultiLineString ) ;
+    _visitGeometries( g );
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const MultiPolygon& g )
+{
+    structuralBytes += sizeof( MultiPolygon ) ;
+    _visitGeometries( g );
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const MultiSolid& g )
+{
+    structuralBytes += sizeof( MultiSolid ) ;
+    _visitGeometries( g );
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const GeometryCollection& g )
+{
+    structuralBytes += sizeof( GeometryCollection ) ;
+    _visitGeometries( g );
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const PolyhedralSurface& g )
+{
+    structuralBytes += sizeof( PolyhedralSurface ) + g.numPolygons() * sizeof( Polygon* ) ;
+
+    for ( size_t i = 0; i < g.numPolygons(); i++ ) {
+        visit( g.polygonN( i ) );
+    }
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::visit( const TriangulatedSurface& g )
+{
+    structuralBytes += sizeof( TriangulatedSurface ) ;
+
+    if ( g.isIndexed() ) {
+        // shared vertex buffer and index triples
+        structuralBytes += g.numVertices() * sizeof( Point ) + g.numTriangles() * 3 * sizeof( size_t ) ;
+        // read-only triangles built by the const accessors
+        structuralBytes += g.numCachedTriangles() * ( sizeof( Triangle* ) + sizeof( Triangle ) ) ;
+    }
+    else {
+        structuralBytes += g.numTriangles() * ( sizeof( Triangle* ) + sizeof( Triangle ) ) ;
+    }
+
+    for ( size_t i = 0; i < g.numVertices(); i++ ) {
+        exactBytes += g.vertexN( i ).coordinate().exactBytes( countedLazyReps, numLazyNodes ) ;
+    }
+}
+
+///
+///
+///
+void MemoryFootprintVisitor::_visitGeometries( const GeometryCollection& g )
+{
+    structuralBytes += g.numGeometries() * sizeof( boost::shared_ptr< Geometry > ) ;
+
+    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+        g.geometryN( i ).accept( *this );
+    }
+}
+
+
+
+}//detail
+SFCGAL_END_NAMESPACE
@@ -0,0 +1,79 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_MEMORYFOOTPRINTVISITOR_H_
+#define _SFCGAL_DETAIL_MEMORYFOOTPRINTVISITOR_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+#include <set>
+#include <SFCGAL/GeometryVisitor.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+/**
+ * Counts the bytes used by a Geometry, the geometry objects and their containers
+ * (structuralBytes) apart from the exact number representations (exactBytes)
+ *
+ * A lazy exact node shared by several coordinates (copies of a point) is counted once. The unevaluated
+ * nodes, whose construction history can't be measured, are counted in numLazyNodes.
+ *
+ * @warning geometries shared between collections (copy on write) are counted for each collection
+ */
+class SFCGAL_API MemoryFootprintVisitor : public ConstGeometryVisitor {
+public:
+    MemoryFootprintVisitor() ;
+
+    virtual void visit( const Point& g ) ;
+    virtual void visit( const LineString& g ) ;
+    virtual void visit( const Polygon& g ) ;
+    virtual void visit( const Triangle& g ) ;
+    virtual void visit( const Solid& g ) ;
+    virtual void visit( const MultiPoint& g ) ;
+    virtual void visit( const MultiLineString& g ) ;
+    virtual void visit( const MultiPolygon& g ) ;
+    virtual void visit( const MultiSolid& g ) ;
+    virtual void visit( const GeometryCollection& g ) ;
+    virtual void visit( const PolyhedralSurface& g ) ;
+    virtual void visit( const TriangulatedSurface& g ) ;
+public:
+    size_t structuralBytes ;
+    size_t exactBytes ;
+    size_t numLazyNodes ;
+    /**
+     * lazy exact nodes already counted (may be shared with an other count)
+     */
+    std::set< const void* > countedLazyReps ;
+
+private:
+    /**
+     * counts the parts of a collection (not the collection object itself)
+     */
+    void _visitGeometries( const GeometryCollection& g ) ;
+};
+
+
+}//detail
+SFCGAL_END_NAMESPACE
+
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_PREPARED_GEOMETRY_SET_H_
+#define _SFCGAL_DETAIL_PREPARED_GEOMETRY_SET_H_
+
+#include <boost/noncopyable.hpp>
+
+#include <SFCGAL/detail/GeometrySet.h>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry;
+namespace detail {
+
+///
+/// A GeometrySet with the handles and the bounding boxes of its primitives,
+/// computed once and reused by the algorithms on prepared geometries.
+///
+/// It is not modified once built. It can't be shared between threads : the lazy exact numbers of its
+/// primitives are reference counted without atomic operations (see ExecutionPolicy).
+/// Box traversals reorder the boxes : algorithms work on a copy of boxes()
+///
+template <int Dim>
+class PreparedGeometrySet : boost::noncopyable {
+public:
+    /**
+     * decomposes g and computes the bounding boxes of its primitives
+     */
+    explicit PreparedGeometrySet( const Geometry& g ) :
+        _geometrySet( g ) {
+        _geometrySet.computeBoundingBoxes( _handles, _boxes );
+    }
+
+    inline const GeometrySet<Dim>& geometrySet() const {
+        return _geometrySet;
+    }
+
+    inline const typename HandleCollection<Dim>::Type& handles() const {
+        return _handles;
+    }
+
+    inline const typename BoxCollection<Dim>::Type& boxes() const {
+        return _boxes;
+    }
+
+private:
+    GeometrySet<Dim> _geometrySet;
+    // the boxes point to the handles, which point to the primitives of _geometrySet
+    typename HandleCollection<Dim>::Type _handles;
+    typename BoxCollection<Dim>::Type _boxes;
+};
+
+} // namespace detail
+SFCGAL_END_NAMESPACE
+
+#endif
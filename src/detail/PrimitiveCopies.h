@@ -0,0 +1,107 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_PRIMITIVECOPIES_H_
+#define _SFCGAL_DETAIL_PRIMITIVECOPIES_H_
+
+#include <algorithm>
+#include <deque>
+#include <map>
+
+#include <boost/assert.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/deepCopy.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+/**
+ * Deep copies (see deepCopy) of the primitives handled by a thread of a parallel computation,
+ * so that the threads share no lazy exact representation. Each primitive is copied once.
+ *
+ * @warning filled in the thread owning the primitives, before the other threads start. The volumes
+ * are not copied : the operations involving a volume are computed in the calling thread.
+ */
+template < int Dim >
+class PrimitiveCopies : boost::noncopyable {
+public:
+    /**
+     * returns the handle of the copy of the primitive
+     */
+    PrimitiveHandle<Dim>* copy( const PrimitiveHandle<Dim>* original ) {
+        typename CopyMap::const_iterator found = _copies.find( original );
+
+        if ( found != _copies.end() ) {
+            return found->second ;
+        }
+
+        switch ( original->handle.which() ) {
+        case PrimitivePoint:
+            _points.push_back( deepCopy( *original->template as< typename Point_d<Dim>::Type >() ) );
+            _handles.push_back( PrimitiveHandle<Dim>( &_points.back() ) );
+            break;
+
+        case PrimitiveSegment:
+            _segments.push_back( deepCopy( *original->template as< typename Segment_d<Dim>::Type >() ) );
+            _handles.push_back( PrimitiveHandle<Dim>( &_segments.back() ) );
+            break;
+
+        case PrimitiveSurface:
+            _surfaces.push_back( deepCopy( *original->template as< typename Surface_d<Dim>::Type >() ) );
+            _handles.push_back( PrimitiveHandle<Dim>( &_surfaces.back() ) );
+            break;
+
+        default:
+            BOOST_ASSERT( false );
+        }
+
+        _copies.insert( std::make_pair( original, &_handles.back() ) );
+        return &_handles.back() ;
+    }
+
+private:
+    typedef std::map< const PrimitiveHandle<Dim>*, PrimitiveHandle<Dim>* > CopyMap ;
+
+    // deques : the handles point to their elements
+    std::deque< typename Point_d<Dim>::Type > _points ;
+    std::deque< typename Segment_d<Dim>::Type > _segments ;
+    std::deque< typename Surface_d<Dim>::Type > _surfaces ;
+    std::deque< PrimitiveHandle<Dim> > _handles ;
+    CopyMap _copies ;
+};
+
+/**
+ * Number of blocks of copies for n tasks shared by numThreads threads : a few blocks per thread
+ * balance the tasks of heterogeneous costs, without copying the primitives for each task.
+ * The block b holds the tasks [ n * b / numBlocks, n * ( b + 1 ) / numBlocks ).
+ */
+inline size_t numCopyBlocks( const size_t& n, const size_t& numThreads )
+{
+    return std::min( n, numThreads * 4 );
+}
+
+}//detail
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_SORTEDCOLLECTION_H_
+#define _SFCGAL_DETAIL_SORTEDCOLLECTION_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+/**
+ * Sorted vector of unique elements (ordered with operator<), used in place of a std::set.
+ *
+ * Elements are appended without ordering (insert, append), the collection is then sorted and
+ * deduplicated once by normalize(), called by the first read (begin, end, size) : adding n elements
+ * one by one costs O(n log n). As with a std::set, the first inserted element of equivalent elements
+ * is kept.
+ *
+ * @warning the first read modifies the collection : a collection read by several threads must be
+ * normalized before
+ */
+template < typename T >
+class SortedCollection {
+public:
+    typedef T                                          value_type ;
+    typedef typename std::vector< T >::const_iterator   const_iterator ;
+    // elements are not mutable, it would break the order
+    typedef const_iterator                             iterator ;
+    typedef typename std::vector< T >::size_type        size_type ;
+
+    /**
+     * default constructor (empty collection)
+     */
+    SortedCollection():
+        _numSorted( 0 ) {
+    }
+
+    /**
+     * iterator on the first element
+     */
+    inline const_iterator begin() const {
+        normalize();
+        return _elements.begin() ;
+    }
+    /**
+     * iterator after the last element
+     */
+    inline const_iterator end() const {
+        normalize();
+        return _elements.end() ;
+    }
+
+    /**
+     * number of elements
+     */
+    inline size_type size() const {
+        normalize();
+        return _elements.size() ;
+    }
+    /**
+     * indicates if the collection is empty
+     */
+    inline bool empty() const {
+        return _elements.empty() ;
+    }
+
+    /**
+     * removes all the elements
+     */
+    inline void clear() {
+        _elements.clear();
+        _numSorted = 0 ;
+    }
+    /**
+     * reserves room for n elements
+     */
+    inline void reserve( const size_type& n ) {
+        _elements.reserve( n );
+    }
+    /**
+     * indicates if there is no pending appended elements
+     */
+    inline bool isNormalized() const {
+        return _numSorted == _elements.size() ;
+    }
+
+    /**
+     * inserts an element, if not already in the collection (ordered on the next read)
+     */
+    inline void insert( const T& element ) {
+        _elements.push_back( element );
+    }
+    /**
+     * inserts a range of elements (ordered on the next read)
+     */
+    template < typename IT >
+    void insert( IT first, IT last ) {
+        _elements.insert( _elements.end(), first, last );
+    }
+
+    /**
+     * merges another collection
+     */
+    void merge( const SortedCollection& other ) {
+        if ( other.empty() ) {
+            return ;
+        }
+
+        normalize();
+        _elements.insert( _elements.end(), other.begin(), other.end() );
+        _mergeSorted();
+    }
+
+    /**
+     * appends an element without ordering it (same as insert)
+     */
+    inline void append( const T& element ) {
+        _elements.push_back( element );
+    }
+
+    /**
+     * sorts and deduplicates the appended elements
+     */
+    void normalize() const {
+        if ( isNormalized() ) {
+            return ;
+        }
+
+        std::stable_sort( _elements.begin() + _numSorted, _elements.end() );
+        _mergeSorted();
+    }
+
+private:
+    // normalized by the const reads
+    mutable std::vector< T > _elements ;
+    /**
+     * the first _numSorted elements are sorted and unique
+     */
+    mutable size_type        _numSorted ;
+
+    /**
+     * equivalence for std::unique
+     */
+    struct Equivalent {
+        bool operator()( const T& a, const T& b ) const {
+            return !( a < b ) && !( b < a );
+        }
+    };
+
+    /**
+     * merges the sorted prefix with the sorted tail and removes duplicates
+     */
+    void _mergeSorted() const {
+        std::inplace_merge( _elements.begin(), _elements.begin() + _numSorted, _elements.end() );
+        _elements.erase( std::unique( _elements.begin(), _elements.end(), Equivalent() ), _elements.end() );
+        _numSorted = _elements.size() ;
+    }
+};
+
+} // namespace detail
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -21,7 +21,9 @@
 #ifndef _SFCGAL_TESTGEOMETRY_H_
 #define _SFCGAL_TESTGEOMETRY_H_
 
-namespace SFCGAL {
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
 
 struct TestGeometry {
     const std::string wkt;
@@ -245,6 +247,6 @@ const std::vector< TestGeometry > createTestGeometries()
     return std::vector<TestGeometry>( testGeometry, testGeometry + sizeof( testGeometry )/sizeof( TestGeometry ) ) ;
 }
 
-}
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,6 +21,8 @@
 #ifndef SFCGAL_DETAIL_TYPE_FOR_DIMENSION_H
 #define SFCGAL_DETAIL_TYPE_FOR_DIMENSION_H
 
+#include <SFCGAL/config.h>
+
 #include <CGAL/Segment_2.h>
 #include <CGAL/Segment_3.h>
 #include <CGAL/Triangle_2.h>
@@ -28,7 +30,7 @@
 #include <CGAL/Polygon_with_holes_2.h>
 #include <CGAL/Polyhedron_3.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 ///
 /// Type traits for CGAL types.
@@ -164,6 +166,6 @@ struct IsPrimitiveLarger {
 };
 
 } // namespace detail
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
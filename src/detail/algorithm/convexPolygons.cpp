@@ -0,0 +1,235 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/algorithm/convexPolygons.h>
+#include <SFCGAL/detail/GeometrySet.h>
+
+#include <CGAL/intersections.h>
+
+#include <algorithm>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+namespace algorithm {
+
+typedef CGAL::Point_2< Kernel > Point_2 ;
+
+namespace {
+
+//
+// appends p to vertices unless it repeats the last vertex
+void addVertex( ConvexVertices& vertices, const Point_2& p )
+{
+    if ( vertices.empty() || vertices.back() != p ) {
+        vertices.push_back( p );
+    }
+}
+
+//
+// removes the last vertices repeating the first one
+void closeVertices( ConvexVertices& vertices )
+{
+    while ( vertices.size() > 1 && vertices.front() == vertices.back() ) {
+        vertices.pop_back();
+    }
+}
+
+//
+// true if all the vertices of b are strictly on the right side of an edge of a
+bool hasSeparatingEdge( const ConvexVertices& a, const ConvexVertices& b )
+{
+    const size_t n = a.size();
+    const size_t m = b.size();
+
+    // vertex of b the farthest on the left side of the first edge of a
+    size_t k = 0 ;
+
+    for ( size_t j = 1; j < m; j++ ) {
+        if ( CGAL::compare_signed_distance_to_line( a[0], a[1], b[j], b[k] ) == CGAL::LARGER ) {
+            k = j ;
+        }
+    }
+
+    for ( size_t i = 0; i < n; i++ ) {
+        const Point_2& p = a[i] ;
+        const Point_2& q = a[( i + 1 ) % n] ;
+
+        // the farthest vertex moves forward along b as the edges of a turn counterclockwise
+        for ( size_t step = 0; step < m; step++ ) {
+            const size_t next = ( k + 1 ) % m ;
+
+            if ( CGAL::compare_signed_distance_to_line( p, q, b[next], b[k] ) == CGAL::SMALLER ) {
+                break;
+            }
+
+            k = next ;
+        }
+
+        if ( CGAL::orientation( p, q, b[k] ) == CGAL::RIGHT_TURN ) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
+
+///
+///
+///
+bool convexVertices( const CGAL::Polygon_with_holes_2< Kernel >& polygon, ConvexVertices& vertices )
+{
+    vertices.clear();
+
+    if ( polygon.holes_begin() != polygon.holes_end() ) {
+        return false;
+    }
+
+    const CGAL::Polygon_2< Kernel >& ring = polygon.outer_boundary();
+    vertices.reserve( ring.size() );
+
+    for ( CGAL::Polygon_2< Kernel >::Vertex_const_iterator it = ring.vertices_begin(); it != ring.vertices_end(); ++it ) {
+        addVertex( vertices, *it );
+    }
+
+    closeVertices( vertices );
+
+    if ( vertices.size() < 3 ) {
+        return false;
+    }
+
+    switch ( CGAL::sign( ring.area() ) ) {
+    case CGAL::ZERO:
+        return false;
+
+    case CGAL::NEGATIVE:
+        std::reverse( vertices.begin(), vertices.end() );
+        break;
+
+    case CGAL::POSITIVE:
+        break;
+    }
+
+    // a simple ring is convex if it never turns right
+    const size_t n = vertices.size();
+
+    for ( size_t i = 0; i < n; i++ ) {
+        if ( CGAL::orientation( vertices[i], vertices[( i + 1 ) % n], vertices[( i + 2 ) % n] ) == CGAL::RIGHT_TURN ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+///
+///
+bool intersectsConvex( const ConvexVertices& a, const ConvexVertices& b )
+{
+    return ! hasSeparatingEdge( a, b ) && ! hasSeparatingEdge( b, a );
+}
+
+///
+///
+///
+void intersectionConvex( const ConvexVertices& a, const ConvexVertices& b, GeometrySet<2>& output )
+{
+    // Sutherland-Hodgman, on closed half-planes (the clipped ring may collapse to a segment or a point)
+    ConvexVertices clipped( a );
+    ConvexVertices next ;
+    next.reserve( a.size() + b.size() );
+
+    for ( size_t j = 0; j < b.size() && ! clipped.empty(); j++ ) {
+        const Point_2& p = b[j] ;
+        const Point_2& q = b[( j + 1 ) % b.size()] ;
+
+        const size_t n = clipped.size();
+        std::vector< CGAL::Orientation > sides( n );
+        bool isInside = true ;
+
+        for ( size_t i = 0; i < n; i++ ) {
+            sides[i] = CGAL::orientation( p, q, clipped[i] );
+            isInside = isInside && sides[i] != CGAL::RIGHT_TURN ;
+        }
+
+        if ( isInside ) {
+            continue;
+        }
+
+        next.clear();
+
+        for ( size_t i = 0; i < n; i++ ) {
+            const size_t i2 = ( i + 1 ) % n ;
+
+            if ( sides[i] != CGAL::RIGHT_TURN ) {
+                addVertex( next, clipped[i] );
+            }
+
+            if ( ( sides[i] == CGAL::LEFT_TURN && sides[i2] == CGAL::RIGHT_TURN )
+                    || ( sides[i] == CGAL::RIGHT_TURN && sides[i2] == CGAL::LEFT_TURN ) ) {
+                CGAL::Object crossing = CGAL::intersection( CGAL::Line_2< Kernel >( p, q ), CGAL::Segment_2< Kernel >( clipped[i], clipped[i2] ) );
+                const Point_2* x = CGAL::object_cast< Point_2 >( &crossing );
+                BOOST_ASSERT( x != NULL );
+                addVertex( next, *x );
+            }
+        }
+
+        closeVertices( next );
+        clipped.swap( next );
+    }
+
+    if ( clipped.empty() ) {
+        return ;
+    }
+
+    // the clipped ring has an area unless all its vertices are aligned
+    size_t first = 0, last = 0 ;
+    bool isDegenerate = true ;
+
+    for ( size_t i = 1; i < clipped.size(); i++ ) {
+        if ( CGAL::compare_xy( clipped[i], clipped[first] ) == CGAL::SMALLER ) {
+            first = i ;
+        }
+
+        if ( CGAL::compare_xy( clipped[i], clipped[last] ) == CGAL::LARGER ) {
+            last = i ;
+        }
+
+        if ( i + 1 < clipped.size() && CGAL::orientation( clipped[0], clipped[i], clipped[i + 1] ) != CGAL::COLLINEAR ) {
+            isDegenerate = false ;
+        }
+    }
+
+    if ( ! isDegenerate ) {
+        output.addPrimitive( CGAL::Polygon_with_holes_2< Kernel >( CGAL::Polygon_2< Kernel >( clipped.begin(), clipped.end() ) ) );
+    }
+    else if ( first != last ) {
+        output.addPrimitive( CGAL::Segment_2< Kernel >( clipped[first], clipped[last] ) );
+    }
+    else {
+        output.addPrimitive( clipped[first] );
+    }
+}
+
+}
+}
+SFCGAL_END_NAMESPACE
@@ -0,0 +1,66 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_ALGORITHM_CONVEXPOLYGONS_H_
+#define _SFCGAL_DETAIL_ALGORITHM_CONVEXPOLYGONS_H_
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+
+#include <CGAL/Polygon_with_holes_2.h>
+
+#include <vector>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+template <int Dim> class GeometrySet ;
+
+namespace algorithm {
+
+/**
+ * Vertices of a convex polygon, counterclockwise and without repeated points
+ */
+typedef std::vector< CGAL::Point_2< Kernel > > ConvexVertices ;
+
+/**
+ * Fills vertices with the exterior ring of polygon (see ConvexVertices).
+ * Returns false if the polygon has holes, is degenerate or is not convex.
+ * @pre polygon is simple
+ */
+SFCGAL_API bool convexVertices( const CGAL::Polygon_with_holes_2< Kernel >& polygon, ConvexVertices& vertices );
+
+/**
+ * Intersection test on (closed) convex polygons, in O(n+m) : a and b are disjoint if and only if
+ * the vertices of one polygon are strictly on the outer side of an edge of the other one. The
+ * vertex of b the farthest inside an edge of a turns with the edges of a (rotating calipers).
+ */
+SFCGAL_API bool intersectsConvex( const ConvexVertices& a, const ConvexVertices& b );
+
+/**
+ * Intersection of convex polygons, a is clipped by the half-planes of the edges of b.
+ * Adds a polygon, a segment or a point to output (nothing if a and b are disjoint).
+ */
+SFCGAL_API void intersectionConvex( const ConvexVertices& a, const ConvexVertices& b, GeometrySet<2>& output );
+
+}
+}
+SFCGAL_END_NAMESPACE
+
+#endif
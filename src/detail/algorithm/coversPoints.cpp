@@ -26,7 +26,7 @@
 #include <SFCGAL/detail/GeometrySet.h>
 #include <SFCGAL/detail/GetPointsVisitor.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace algorithm {
 template <int Dim>
@@ -67,4 +67,4 @@ bool coversPoints3D( const Geometry& ga, const Geometry& gb )
 }
 }
 }
-}
+SFCGAL_END_NAMESPACE
@@ -25,7 +25,7 @@
 
 #include <vector>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry;
 namespace detail {
 namespace algorithm {
@@ -44,6 +44,6 @@ SFCGAL_API bool coversPoints( const Geometry& ga, const Geometry& gb );
 SFCGAL_API bool coversPoints3D( const Geometry& ga, const Geometry& gb );
 }
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
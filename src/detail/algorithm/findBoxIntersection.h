@@ -0,0 +1,181 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _SFCGAL_DETAIL_ALGORITHM_FINDBOXINTERSECTION_H_
+#define _SFCGAL_DETAIL_ALGORITHM_FINDBOXINTERSECTION_H_
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <SFCGAL/config.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+namespace algorithm {
+
+/**
+ * Orders boxes on their lower bound along an axis
+ */
+struct LowerBoundLess {
+    LowerBoundLess( const int& axis_ ): axis( axis_ ) {}
+
+    template < typename Box >
+    bool operator()( const Box& a, const Box& b ) const {
+        return a.min_coord( axis ) < b.min_coord( axis );
+    }
+
+    int axis ;
+};
+
+/**
+ * Tests if two (closed) boxes overlap on every axis but one (the sweep axis)
+ */
+template < typename BoxA, typename BoxB >
+bool overlapsExcept( const BoxA& a, const BoxB& b, const int& axis )
+{
+    for ( int d = 0; d < BoxA::dimension(); d++ ) {
+        if ( d != axis && ( a.max_coord( d ) < b.min_coord( d ) || b.max_coord( d ) < a.min_coord( d ) ) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Extent of the boxes along each axis : sum of their lengths and range of their coordinates
+ * @warning at most 3 axes
+ */
+template < typename RandomAccessIterator >
+void addAxisExtents( RandomAccessIterator begin, RandomAccessIterator end, double* lengths, double* lo, double* hi )
+{
+    for ( RandomAccessIterator it = begin; it != end; ++it ) {
+        for ( int d = 0; d < it->dimension(); d++ ) {
+            lengths[d] += it->max_coord( d ) - it->min_coord( d ) ;
+            lo[d] = std::min( lo[d], double( it->min_coord( d ) ) );
+            hi[d] = std::max( hi[d], double( it->max_coord( d ) ) );
+        }
+    }
+}
+
+/**
+ * Returns the axis along which the boxes of [abegin,aend) and [bbegin,bend) overlap the least : the one
+ * where the mean length of a box, relative to the range of the coordinates, is the smallest.
+ *
+ * The sweep visits the pairs overlapping along its axis, sweeping boxes that overlap along x but are
+ * spread along y (a column) on the first axis would test every pair.
+ */
+template < typename RandomAccessIteratorA, typename RandomAccessIteratorB >
+int sweepAxis(
+    RandomAccessIteratorA abegin, RandomAccessIteratorA aend,
+    RandomAccessIteratorB bbegin, RandomAccessIteratorB bend
+)
+{
+    typedef typename std::iterator_traits< RandomAccessIteratorA >::value_type Box ;
+    const int dimension = Box::dimension() ;
+    const size_t n = ( aend - abegin ) + ( bend - bbegin ) ;
+
+    if ( n == 0 ) {
+        return 0 ;
+    }
+
+    double lengths[3] = { 0.0, 0.0, 0.0 } ;
+    double lo[3] = { std::numeric_limits< double >::max(), std::numeric_limits< double >::max(), std::numeric_limits< double >::max() } ;
+    double hi[3] = { -std::numeric_limits< double >::max(), -std::numeric_limits< double >::max(), -std::numeric_limits< double >::max() } ;
+    addAxisExtents( abegin, aend, lengths, lo, hi );
+    addAxisExtents( bbegin, bend, lengths, lo, hi );
+
+    int axis = 0 ;
+    double bestDensity = std::numeric_limits< double >::max() ;
+
+    for ( int d = 0; d < dimension; d++ ) {
+        // all the boxes share the same range along a flat axis
+        const double range = hi[d] - lo[d] ;
+        const double density = range > 0.0 ? lengths[d] / ( n * range ) : 1.0 ;
+
+        if ( density < bestDensity ) {
+            bestDensity = density ;
+            axis = d ;
+        }
+    }
+
+    return axis ;
+}
+
+/**
+ * Looks for a pair of overlapping (closed) boxes, one in [abegin,aend) and one in [bbegin,bend),
+ * for which predicate( a, b ) is true.
+ *
+ * Unlike CGAL::box_intersection_d, which reports every pair, the traversal stops at the first
+ * pair accepted by the predicate : no exception is needed to interrupt it.
+ *
+ * Both ranges are sorted along the axis where the boxes overlap the least (see sweepAxis), then
+ * swept (two way scan). Each pair of boxes overlapping along this axis is visited once.
+ *
+ * @param Box has the CGAL::Box_intersection_d::Box_d interface (dimension(), min_coord(d), max_coord(d))
+ * @warning the ranges are reordered
+ * @return true if a pair is accepted by the predicate
+ */
+template < typename RandomAccessIteratorA, typename RandomAccessIteratorB, typename Predicate >
+bool findBoxIntersection(
+    RandomAccessIteratorA abegin, RandomAccessIteratorA aend,
+    RandomAccessIteratorB bbegin, RandomAccessIteratorB bend,
+    Predicate predicate
+)
+{
+    const int axis = sweepAxis( abegin, aend, bbegin, bend ) ;
+
+    std::sort( abegin, aend, LowerBoundLess( axis ) );
+    std::sort( bbegin, bend, LowerBoundLess( axis ) );
+
+    RandomAccessIteratorA ait = abegin ;
+    RandomAccessIteratorB bit = bbegin ;
+
+    while ( ait != aend && bit != bend ) {
+        if ( ait->min_coord( axis ) < bit->min_coord( axis ) ) {
+            // pairs of *ait with the boxes of b starting in its sweep axis range
+            for ( RandomAccessIteratorB it = bit; it != bend && !( ait->max_coord( axis ) < it->min_coord( axis ) ); ++it ) {
+                if ( overlapsExcept( *ait, *it, axis ) && predicate( *ait, *it ) ) {
+                    return true ;
+                }
+            }
+
+            ++ait ;
+        }
+        else {
+            // pairs of *bit with the boxes of a starting in its sweep axis range
+            for ( RandomAccessIteratorA it = ait; it != aend && !( bit->max_coord( axis ) < it->min_coord( axis ) ); ++it ) {
+                if ( overlapsExcept( *it, *bit, axis ) && predicate( *it, *bit ) ) {
+                    return true ;
+                }
+            }
+
+            ++bit ;
+        }
+    }
+
+    return false ;
+}
+
+} // namespace algorithm
+} // namespace detail
+SFCGAL_END_NAMESPACE
+
+#endif
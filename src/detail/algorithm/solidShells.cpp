@@ -0,0 +1,110 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/detail/algorithm/solidShells.h>
+#include <SFCGAL/detail/TypeForDimension.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Exception.h>
+
+#include <CGAL/Point_inside_polyhedron_3.h>
+
+#include <vector>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+namespace algorithm {
+
+///
+///
+///
+std::auto_ptr< Geometry > toSolids( boost::ptr_vector< SolidShell >& shells )
+{
+    std::vector< SolidShell* > exteriors ;
+    std::vector< SolidShell* > cavities ;
+
+    for ( boost::ptr_vector< SolidShell >::iterator it = shells.begin(); it != shells.end(); ++it ) {
+        if ( it->volume > 0 ) {
+            exteriors.push_back( &*it );
+        }
+        else if ( it->volume < 0 ) {
+            cavities.push_back( &*it );
+        }
+    }
+
+    if ( ! cavities.empty() && exteriors.empty() ) {
+        BOOST_THROW_EXCEPTION( Exception( "solidBoolean() : cavities without an exterior shell" ) );
+    }
+
+    boost::ptr_vector< Solid > solids ;
+
+    for ( size_t i = 0; i < exteriors.size(); i++ ) {
+        solids.push_back( new Solid( exteriors[i]->surface.release() ) );
+    }
+
+    if ( ! cavities.empty() ) {
+        boost::ptr_vector< MarkedPolyhedron > polyhedra ;
+
+        for ( size_t i = 0; i < solids.size(); i++ ) {
+            polyhedra.push_back( solids[i].exteriorShell().toPolyhedron_3< Kernel, MarkedPolyhedron >().release() );
+        }
+
+        for ( size_t j = 0; j < cavities.size(); j++ ) {
+            size_t container = 0 ;
+            bool isFound = false ;
+
+            for ( size_t i = 0; i < polyhedra.size(); i++ ) {
+                CGAL::Point_inside_polyhedron_3< MarkedPolyhedron, Kernel > isInside( polyhedra[i] );
+
+                if ( isInside( cavities[j]->sample ) == CGAL::ON_BOUNDED_SIDE
+                        && ( ! isFound || exteriors[i]->volume < exteriors[container]->volume ) ) {
+                    container = i ;
+                    isFound = true ;
+                }
+            }
+
+            if ( ! isFound ) {
+                BOOST_THROW_EXCEPTION( Exception( "solidBoolean() : a cavity is not inside an exterior shell" ) );
+            }
+
+            solids[container].addInteriorShell( cavities[j]->surface.release() );
+        }
+    }
+
+    if ( solids.empty() ) {
+        return std::auto_ptr< Geometry >( new GeometryCollection );
+    }
+
+    if ( solids.size() == 1 ) {
+        return std::auto_ptr< Geometry >( solids.release( solids.begin() ).release() );
+    }
+
+    std::auto_ptr< MultiSolid > result( new MultiSolid );
+
+    while ( ! solids.empty() ) {
+        result->addGeometry( solids.release( solids.begin() ).release() );
+    }
+
+    return std::auto_ptr< Geometry >( result.release() );
+}
+
+}
+}
+SFCGAL_END_NAMESPACE
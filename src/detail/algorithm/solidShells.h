@@ -0,0 +1,70 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_ALGORITHM_SOLIDSHELLS_H_
+#define _SFCGAL_DETAIL_ALGORITHM_SOLIDSHELLS_H_
+
+#include <SFCGAL/config.h>
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/PolyhedralSurface.h>
+
+#include <boost/ptr_container/ptr_vector.hpp>
+
+#include <memory>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+
+namespace detail {
+namespace algorithm {
+
+/**
+ * A connected component of the result of a boolean operation on solids
+ */
+struct SFCGAL_API SolidShell {
+    SolidShell():
+        surface( new PolyhedralSurface ),
+        volume( 0 ) {
+    }
+
+    std::auto_ptr< PolyhedralSurface > surface ;
+    /**
+     * signed volume : positive for an exterior shell, negative for a cavity
+     */
+    Kernel::FT volume ;
+    /**
+     * a point on the shell, not on its edges
+     */
+    CGAL::Point_3< Kernel > sample ;
+};
+
+/**
+ * Builds the solids from the shells : each cavity goes to the smallest exterior shell containing it.
+ * The surfaces are moved to the result, flat shells (null volume) are dropped.
+ * @return a Solid, a MultiSolid or an empty GeometryCollection
+ * @throw Exception if a cavity is not inside an exterior shell
+ */
+SFCGAL_API std::auto_ptr< Geometry > toSolids( boost::ptr_vector< SolidShell >& shells );
+
+}
+}
+SFCGAL_END_NAMESPACE
+
+#endif
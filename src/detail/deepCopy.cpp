@@ -0,0 +1,162 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/deepCopy.h>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Transform.h>
+#include <SFCGAL/detail/GetPointsVisitor.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+namespace {
+
+//
+// replaces the coordinates sharing a lazy exact representation with deep copies
+class DeepCopyTransform : public Transform {
+public:
+    virtual void transform( Point& p ) {
+        if ( p.coordinate().sharesLazyExact() ) {
+            p.coordinate() = p.coordinate().deepCopy() ;
+        }
+    }
+};
+
+}
+
+///
+///
+///
+Kernel::FT deepCopy( const Kernel::FT& x )
+{
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+    return x ;
+#else
+
+    // the interval contains the exact value
+    if ( x.approx().inf() == x.approx().sup() ) {
+        return Kernel::FT( x.approx().inf() );
+    }
+
+    // a new GMP rational, the exact value of x is shared by its copies
+    return Kernel::FT( Kernel::Exact_kernel::FT( x.exact().mpq() ) );
+#endif
+}
+
+///
+///
+///
+Kernel::Point_2 deepCopy( const Kernel::Point_2& p )
+{
+    return Kernel::Point_2( deepCopy( p.x() ), deepCopy( p.y() ) );
+}
+
+///
+///
+///
+Kernel::Point_3 deepCopy( const Kernel::Point_3& p )
+{
+    return Kernel::Point_3( deepCopy( p.x() ), deepCopy( p.y() ), deepCopy( p.z() ) );
+}
+
+///
+///
+///
+Kernel::Segment_2 deepCopy( const Kernel::Segment_2& s )
+{
+    return Kernel::Segment_2( deepCopy( s.source() ), deepCopy( s.target() ) );
+}
+
+///
+///
+///
+Kernel::Segment_3 deepCopy( const Kernel::Segment_3& s )
+{
+    return Kernel::Segment_3( deepCopy( s.source() ), deepCopy( s.target() ) );
+}
+
+///
+///
+///
+Kernel::Triangle_3 deepCopy( const Kernel::Triangle_3& t )
+{
+    return Kernel::Triangle_3( deepCopy( t.vertex( 0 ) ), deepCopy( t.vertex( 1 ) ), deepCopy( t.vertex( 2 ) ) );
+}
+
+///
+///
+///
+CGAL::Polygon_2< Kernel > deepCopy( const CGAL::Polygon_2< Kernel >& ring )
+{
+    CGAL::Polygon_2< Kernel > copy ;
+
+    for ( CGAL::Polygon_2< Kernel >::Vertex_const_iterator it = ring.vertices_begin(); it != ring.vertices_end(); ++it ) {
+        copy.push_back( deepCopy( *it ) );
+    }
+
+    return copy ;
+}
+
+///
+///
+///
+CGAL::Polygon_with_holes_2< Kernel > deepCopy( const CGAL::Polygon_with_holes_2< Kernel >& polygon )
+{
+    CGAL::Polygon_with_holes_2< Kernel > copy( deepCopy( polygon.outer_boundary() ) );
+
+    for ( CGAL::Polygon_with_holes_2< Kernel >::Hole_const_iterator it = polygon.holes_begin(); it != polygon.holes_end(); ++it ) {
+        copy.add_hole( deepCopy( *it ) );
+    }
+
+    return copy ;
+}
+
+///
+///
+///
+bool sharesLazyExact( const Geometry& g )
+{
+    GetPointsVisitor visitor ;
+    g.accept( visitor );
+
+    for ( GetPointsVisitor::const_iterator it = visitor.points.begin(); it != visitor.points.end(); ++it ) {
+        if ( ( *it )->coordinate().sharesLazyExact() ) {
+            return true ;
+        }
+    }
+
+    return false ;
+}
+
+///
+///
+///
+std::auto_ptr< Geometry > deepClone( const Geometry& g )
+{
+    std::auto_ptr< Geometry > clone( g.clone() );
+    DeepCopyTransform transform ;
+    clone->accept( transform );
+    return clone ;
+}
+
+}//detail
+SFCGAL_END_NAMESPACE
@@ -0,0 +1,72 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_DEEPCOPY_H_
+#define _SFCGAL_DETAIL_DEEPCOPY_H_
+
+#include <memory>
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Kernel.h>
+
+#include <CGAL/Polygon_with_holes_2.h>
+
+SFCGAL_BEGIN_NAMESPACE
+class Geometry ;
+namespace detail {
+
+/**
+ * @{
+ * Copies sharing no lazy exact node nor exact number with the original.
+ *
+ * The copies of a lazy exact object share its representation, with a reference count that is not
+ * atomic (CGAL 4.3) : a copy and its original can only be used in different threads once they share
+ * nothing. The numbers are copied as doubles when their interval is a single double, the exact value
+ * of the original is computed otherwise.
+ *
+ * @warning to be called in the thread owning the original, before the other thread starts
+ */
+SFCGAL_API Kernel::FT deepCopy( const Kernel::FT& x ) ;
+SFCGAL_API Kernel::Point_2 deepCopy( const Kernel::Point_2& p ) ;
+SFCGAL_API Kernel::Point_3 deepCopy( const Kernel::Point_3& p ) ;
+SFCGAL_API Kernel::Segment_2 deepCopy( const Kernel::Segment_2& s ) ;
+SFCGAL_API Kernel::Segment_3 deepCopy( const Kernel::Segment_3& s ) ;
+SFCGAL_API Kernel::Triangle_3 deepCopy( const Kernel::Triangle_3& t ) ;
+SFCGAL_API CGAL::Polygon_2< Kernel > deepCopy( const CGAL::Polygon_2< Kernel >& ring ) ;
+SFCGAL_API CGAL::Polygon_with_holes_2< Kernel > deepCopy( const CGAL::Polygon_with_holes_2< Kernel >& polygon ) ;
+/** @} */
+
+/**
+ * Tests if a coordinate of the geometry shares its lazy exact representation with its copies
+ * (see Coordinate::sharesLazyExact), the geometry can't be read by several threads then.
+ */
+SFCGAL_API bool sharesLazyExact( const Geometry& g ) ;
+
+/**
+ * Returns a clone of the geometry sharing no lazy exact representation with it
+ * @warning to be called in the thread owning the geometry
+ */
+SFCGAL_API std::auto_ptr< Geometry > deepClone( const Geometry& g ) ;
+
+}//detail
+SFCGAL_END_NAMESPACE
+
+#endif
@@ -32,7 +32,7 @@
 
 #include <boost/format.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 typedef Kernel::Point_2                    Point_2 ;
@@ -197,4 +197,4 @@ std::auto_ptr< Geometry > building(
 
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
@@ -27,12 +27,12 @@
 
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
 class Polygon ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 /**
@@ -49,6 +49,6 @@ SFCGAL_API std::auto_ptr< Geometry > building(
 
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
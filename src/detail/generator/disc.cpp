@@ -31,7 +31,7 @@
 
 #include <cmath>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 ///
@@ -60,5 +60,5 @@ std::auto_ptr< Polygon > disc(
 }
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
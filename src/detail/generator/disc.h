@@ -25,12 +25,12 @@
 
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Point ;
 class Polygon ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 /**
@@ -44,6 +44,6 @@ SFCGAL_API std::auto_ptr< Polygon > disc(
 ) ;
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
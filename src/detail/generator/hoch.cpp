@@ -23,7 +23,7 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 std::vector< Kernel::Vector_2 > _hoch( const std::vector< Kernel::Vector_2 >& points )
@@ -78,5 +78,5 @@ std::auto_ptr< Polygon > hoch( const unsigned int& order )
 }
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -23,7 +23,7 @@
 #include <SFCGAL/Triangle.h>
 #include <SFCGAL/MultiPolygon.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 
@@ -75,6 +75,6 @@ std::auto_ptr< MultiPolygon > sierpinski( const unsigned int& order )
 }
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
@@ -25,11 +25,11 @@
 
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class MultiPolygon ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace generator {
 
 /**
@@ -39,6 +39,6 @@ namespace generator {
 SFCGAL_API std::auto_ptr< MultiPolygon > sierpinski( const unsigned int& order ) ;
 
 } // namespace generator
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -20,7 +20,7 @@
 
 #include <SFCGAL/detail/graph/Edge.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 
 ///
@@ -33,6 +33,6 @@ Edge::Edge( const int& face_ ):
 }
 
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
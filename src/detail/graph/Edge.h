@@ -23,7 +23,7 @@
 
 #include <SFCGAL/config.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 
 /**
@@ -37,6 +37,6 @@ struct SFCGAL_API Edge {
 };
 
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -27,7 +27,7 @@
 #include <SFCGAL/detail/graph/Edge.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 
 /**
@@ -438,7 +438,7 @@ typedef GeometryGraphT< Vertex, Edge > GeometryGraph ;
 
 
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
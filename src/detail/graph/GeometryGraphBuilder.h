@@ -30,7 +30,7 @@
 
 #include <SFCGAL/detail/graph/GeometryGraph.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 
 /**
@@ -182,8 +182,8 @@ public:
 
         std::vector< std::vector< edge_descriptor > > triangles ;
 
-        for ( size_t i = 0; i < triangulatedSurface.numGeometries(); i++ ) {
-            triangles.push_back( addTriangle( triangulatedSurface.geometryN( i ), edgeProperties ) );
+        for ( size_t i = 0; i < triangulatedSurface.numTriangles(); i++ ) {
+            triangles.push_back( addTriangle( triangulatedSurface.triangleN( i ).toTriangle(), edgeProperties ) );
         }
 
         return triangles ;
@@ -224,7 +224,7 @@ private:
 typedef GeometryGraphBuilderT< GeometryGraph > GeometryGraphBuilder ;
 
 }//topology
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
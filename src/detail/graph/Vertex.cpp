@@ -20,7 +20,7 @@
 
 #include <SFCGAL/detail/graph/Vertex.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 
 ///
@@ -33,6 +33,6 @@ Vertex::Vertex( const Coordinate& coordinate_ ):
 }
 
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
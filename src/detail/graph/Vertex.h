@@ -25,7 +25,7 @@
 
 #include <SFCGAL/Coordinate.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 
 /**
@@ -42,6 +42,6 @@ struct SFCGAL_API Vertex {
 };
 
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
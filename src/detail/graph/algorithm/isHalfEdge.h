@@ -31,7 +31,7 @@
 #include <boost/graph/copy.hpp>
 #include <boost/graph/connected_components.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 namespace algorithm {
 
@@ -72,6 +72,6 @@ bool isHalfEdge( const GeometryGraphT<V,E>& graph )
 
 }//algorithm
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -24,7 +24,7 @@
 #include <map>
 #include <SFCGAL/detail/graph/GeometryGraph.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace graph {
 namespace algorithm {
 
@@ -103,6 +103,6 @@ bool makeConsistentOrientation(
 
 }//algorithm
 }//graph
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -36,7 +36,7 @@
 #include <SFCGAL/Exception.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace io {
 
@@ -128,12 +128,18 @@ void OsgFactory::addToGeometry( osg::Geometry* geometry, const TriangulatedSurfa
 
     size_t start = vertices->size() ;
 
-    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
-        const Triangle& triangle = g.geometryN( i );
+    // each (shared) vertex of the mesh is converted once
+    std::vector< osg::Vec3 > points ;
+    points.reserve( g.numVertices() );
 
-        osg::Vec3 a = createVec3( triangle.vertex( 0 ) );
-        osg::Vec3 b = createVec3( triangle.vertex( 1 ) );
-        osg::Vec3 c = createVec3( triangle.vertex( 2 ) );
+    for ( size_t i = 0; i < g.numVertices(); i++ ) {
+        points.push_back( createVec3( g.vertexN( i ) ) );
+    }
+
+    for ( size_t i = 0; i < g.numTriangles(); i++ ) {
+        osg::Vec3 a = points[ g.vertexIndex( i, 0 ) ];
+        osg::Vec3 b = points[ g.vertexIndex( i, 1 ) ];
+        osg::Vec3 c = points[ g.vertexIndex( i, 2 ) ];
 
         //vertices
         createVertex( vertices, a ) ;
@@ -150,7 +156,7 @@ void OsgFactory::addToGeometry( osg::Geometry* geometry, const TriangulatedSurfa
     }
 
     geometry->setNormalBinding( osg::Geometry::BIND_PER_VERTEX );
-    geometry->addPrimitiveSet(  new osg::DrawArrays( osg::PrimitiveSet::TRIANGLES, start, g.numGeometries() * 3 ) );
+    geometry->addPrimitiveSet(  new osg::DrawArrays( osg::PrimitiveSet::TRIANGLES, start, g.numTriangles() * 3 ) );
 }
 
 void OsgFactory::addToGeometry( osg::Geometry* geometry, const Polygon& g )
@@ -234,7 +240,7 @@ size_t OsgFactory::createVertex( osg::Vec3Array* vertices, const osg::Vec3& g )
 
 }//io
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif // SFCGAL_WITH_OSG
@@ -31,7 +31,7 @@
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace io {
 
@@ -108,7 +108,7 @@ protected:
 
 }//io
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
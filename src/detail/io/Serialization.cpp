@@ -33,7 +33,7 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 BinarySerializer::BinarySerializer( std::ostream& ostr ) : boost::archive::binary_oarchive( ostr )
@@ -119,7 +119,7 @@ std::auto_ptr<PreparedGeometry> readBinaryPrepared( const std::string& str )
     return std::auto_ptr<PreparedGeometry>( pg );
 }
 }
-}
+SFCGAL_END_NAMESPACE
 namespace boost {
 namespace serialization {
 
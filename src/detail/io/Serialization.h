@@ -35,7 +35,7 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 namespace io {
 
@@ -71,7 +71,7 @@ SFCGAL_API std::auto_ptr<SFCGAL::Geometry> readBinaryGeometry( const std::string
  */
 SFCGAL_API std::auto_ptr<SFCGAL::PreparedGeometry> readBinaryPrepared( const std::string& );
 }
-}
+SFCGAL_END_NAMESPACE
 
 namespace boost {
 namespace serialization {
@@ -133,6 +133,7 @@ void serialize( Archive& ar, CGAL::Gmpq& q, const unsigned int version )
 }
 
 
+#ifndef SFCGAL_USE_INEXACT_KERNEL
 /**
  * Serializer of Kernel::FT
  */
@@ -158,6 +159,7 @@ void serialize( Archive& ar, SFCGAL::Kernel::FT& q, const unsigned int version )
 {
     split_free( ar, q, version );
 }
+#endif
 
 }
 }
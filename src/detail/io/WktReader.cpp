@@ -37,10 +37,58 @@
 
 #include <SFCGAL/Exception.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace io {
 
+namespace {
+
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+///
+/// Tests if a rational is exactly representable as a double
+/// (dyadic rational with a numerator fitting in the mantissa)
+///
+bool isRepresentableAsDouble( const QT& v )
+{
+    mpq_srcptr q = v.mpq() ;
+    return mpz_popcount( mpq_denref( q ) ) == 1
+           && mpz_sizeinbase( mpq_numref( q ), 2 ) <= 53
+           && mpz_sizeinbase( mpq_denref( q ), 2 ) <= 1000 ;
+}
+#endif
+
+///
+/// Builds a XY or XYZ point, using double mode coordinates when it is exact
+///
+Point makePoint( const std::vector< QT >& coordinates, bool is3D )
+{
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+    const size_t n = is3D ? 3 : 2 ;
+    bool isDouble = true ;
+
+    for ( size_t i = 0; i < n && isDouble; i++ ) {
+        isDouble = isRepresentableAsDouble( coordinates[i] ) ;
+    }
+
+    if ( ! isDouble && is3D ) {
+        return Point( coordinates[0], coordinates[1], coordinates[2] );
+    }
+    else if ( ! isDouble ) {
+        return Point( coordinates[0], coordinates[1] );
+    }
+
+#endif
+
+    if ( is3D ) {
+        return Point( CGAL::to_double( coordinates[0] ), CGAL::to_double( coordinates[1] ), CGAL::to_double( coordinates[2] ) );
+    }
+    else {
+        return Point( CGAL::to_double( coordinates[0] ), CGAL::to_double( coordinates[1] ) );
+    }
+}
+
+} // namespace
+
 ///
 ///
 ///
@@ -512,6 +560,9 @@ void  WktReader::readInnerTriangulatedSurface( TriangulatedSurface& g )
     if ( ! _reader.match( ')' ) ) {
         BOOST_THROW_EXCEPTION( WktParseException( parseErrorMessage() ) );
     }
+
+    // WKT repeats the shared vertices in every triangle
+    g.weldVertices();
 }
 
 ///
@@ -616,8 +667,8 @@ void WktReader::readInnerMultiSolid( MultiSolid& g )
 ///
 bool WktReader::readPointCoordinate( Point& p )
 {
-    std::vector< Kernel::Exact_kernel::FT > coordinates ;
-    Kernel::Exact_kernel::FT d;
+    std::vector< QT > coordinates ;
+    QT d;
 
     if ( _reader.imatch( "EMPTY" ) ) {
         p = Point();
@@ -644,7 +695,7 @@ bool WktReader::readPointCoordinate( Point& p )
             BOOST_THROW_EXCEPTION( WktParseException( "bad coordinate dimension" ) );
         }
 
-        p = Point( coordinates[0], coordinates[1], coordinates[2] );
+        p = makePoint( coordinates, true );
         p.setM( coordinates[3].to_double() );
     }
     else if ( _isMeasured && ! _is3D ) {
@@ -653,16 +704,16 @@ bool WktReader::readPointCoordinate( Point& p )
             BOOST_THROW_EXCEPTION( WktParseException( "bad coordinate dimension (expecting XYM coordinates)" ) );
         }
 
-        p = Point( coordinates[0], coordinates[1] );
+        p = makePoint( coordinates, false );
         p.setM( coordinates[2].to_double() );
     }
     else if ( coordinates.size() == 3 ) {
         // XYZ
-        p = Point( coordinates[0], coordinates[1], coordinates[2] );
+        p = makePoint( coordinates, true );
     }
     else {
         // XY
-        p = Point( coordinates[0], coordinates[1] );
+        p = makePoint( coordinates, false );
     }
 
     return true ;
@@ -686,5 +737,5 @@ std::string WktReader::parseErrorMessage()
 
 }//io
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
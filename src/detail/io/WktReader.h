@@ -30,7 +30,7 @@
 
 #include <SFCGAL/detail/tools/InputStreamReader.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace io {
 
@@ -163,6 +163,6 @@ private:
 
 }//io
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
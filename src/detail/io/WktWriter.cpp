@@ -36,7 +36,7 @@
 #include <exception>
 #include <boost/exception/all.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace io {
 
@@ -135,11 +135,22 @@ void WktWriter::writeCoordinateType( const Geometry& g )
 void WktWriter::writeCoordinate( const Point& g )
 {
     if ( _exactWrite ) {
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+        // doubles written as rationals
+        _s << QT( g.x() ) << " " << QT( g.y() );
+
+        if ( g.is3D() ) {
+            _s << " " << QT( g.z() );
+        }
+
+#else
         _s << CGAL::exact( g.x() ) << " " << CGAL::exact( g.y() );
 
         if ( g.is3D() ) {
             _s << " " << CGAL::exact( g.z() );
         }
+
+#endif
     }
     else {
         _s << g.x() << " " << g.y() ;
@@ -436,12 +447,23 @@ void WktWriter::write( const TriangulatedSurface& g )
 
     _s << "(" ; //begin TIN
 
-    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+    for ( size_t i = 0; i < g.numTriangles(); i++ ) {
         if ( i != 0 ) {
             _s << ",";
         }
 
-        writeInner( g.geometryN( i ) );
+        // same as writeInner( const Triangle& ), without building the triangle
+        _s << "((";
+
+        for ( size_t j = 0; j < 4; j++ ) {
+            if ( j != 0 ) {
+                _s << "," ;
+            }
+
+            writeCoordinate( g.triangleVertex( i, j % 3 ) );
+        }
+
+        _s << "))";
     }
 
     _s << ")" ; //end TIN
@@ -519,7 +541,7 @@ void WktWriter::writeInner( const Solid& g )
 
 }//io
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -26,7 +26,7 @@
 #include <SFCGAL/config.h>
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace io {
 
@@ -89,6 +89,6 @@ private:
 
 }//io
 }//detail
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
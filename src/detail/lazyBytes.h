@@ -0,0 +1,151 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_LAZYBYTES_H_
+#define _SFCGAL_DETAIL_LAZYBYTES_H_
+
+#include <cstddef>
+#include <set>
+
+#include <SFCGAL/Kernel.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+///
+/// lazy exact representations already counted (the copies of a kernel object share its representation)
+///
+typedef std::set< const void* > LazyRepSet ;
+
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+
+///
+/// no lazy exact representation with the inexact constructions kernel
+///
+template < typename T >
+size_t lazyBytes( const T&, LazyRepSet&, size_t& )
+{
+    return 0 ;
+}
+
+template < typename T >
+size_t lazyBytes( const T& )
+{
+    return 0 ;
+}
+
+#else
+
+///
+/// bytes of an exact rational (GMP rational and its limbs)
+///
+inline size_t exactFTBytes( const Kernel::Exact_kernel::FT& v )
+{
+    return sizeof( mpq_t ) + ( mpq_numref( v.mpq() )->_mp_alloc + mpq_denref( v.mpq() )->_mp_alloc ) * sizeof( mp_limb_t ) ;
+}
+
+///
+/// bytes of the numbers of an exact point
+///
+template < typename ExactPoint >
+size_t exactPointNumbersBytes( const ExactPoint& e )
+{
+    size_t bytes = 0 ;
+
+    for ( int i = 0; i < e.dimension(); i++ ) {
+        bytes += exactFTBytes( e.cartesian( i ) ) ;
+    }
+
+    return bytes ;
+}
+
+inline size_t exactNumbersBytes( const Kernel::Exact_kernel::Point_2& e )
+{
+    return exactPointNumbersBytes( e ) ;
+}
+
+inline size_t exactNumbersBytes( const Kernel::Exact_kernel::Point_3& e )
+{
+    return exactPointNumbersBytes( e ) ;
+}
+
+inline size_t exactNumbersBytes( const Kernel::Exact_kernel::Segment_2& e )
+{
+    return exactPointNumbersBytes( e.source() ) + exactPointNumbersBytes( e.target() ) ;
+}
+
+inline size_t exactNumbersBytes( const Kernel::Exact_kernel::Segment_3& e )
+{
+    return exactPointNumbersBytes( e.source() ) + exactPointNumbersBytes( e.target() ) ;
+}
+
+inline size_t exactNumbersBytes( const Kernel::Exact_kernel::Triangle_3& e )
+{
+    return exactPointNumbersBytes( e.vertex( 0 ) ) + exactPointNumbersBytes( e.vertex( 1 ) ) + exactPointNumbersBytes( e.vertex( 2 ) ) ;
+}
+
+///
+/// bytes of the lazy exact representation of a kernel object (Point_2, Segment_3, Triangle_3...),
+/// 0 if the representation is already counted. The exact value is only counted once computed, its
+/// computation is not triggered.
+///
+/// The operands of an unevaluated node (its construction history) are private members of the CGAL
+/// node and can't be reached : such a node is counted in numLazyNodes instead, its history is dropped
+/// when its exact value is computed (see Coordinate::compact).
+///
+template < typename Lazy >
+size_t lazyBytes( const Lazy& o, LazyRepSet& counted, size_t& numLazyNodes )
+{
+    typedef typename Lazy::Rep::Self_rep LazyRep ;
+    typedef typename Lazy::Rep::ET       Exact ;
+
+    if ( ! counted.insert( o.rep().ptr() ).second ) {
+        return 0 ;
+    }
+
+    size_t bytes = sizeof( LazyRep ) ;
+
+    if ( o.rep().ptr()->is_lazy() ) {
+        ++numLazyNodes ;
+    }
+    else {
+        bytes += sizeof( Exact ) + exactNumbersBytes( o.rep().exact() ) ;
+    }
+
+    return bytes ;
+}
+
+///
+/// bytes of the lazy exact representation of a single kernel object (see above)
+///
+template < typename Lazy >
+size_t lazyBytes( const Lazy& o )
+{
+    LazyRepSet counted ;
+    size_t numLazyNodes = 0 ;
+    return lazyBytes( o, counted, numLazyNodes ) ;
+}
+
+#endif
+
+}//detail
+SFCGAL_END_NAMESPACE
+
+#endif
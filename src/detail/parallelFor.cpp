@@ -0,0 +1,178 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/parallelFor.h>
+#include <SFCGAL/ExecutionPolicy.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/exception_ptr.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+namespace {
+
+//
+// deals the chunks of [0,n) to the threads
+class ChunkDealer : boost::noncopyable {
+public:
+    ChunkDealer( const size_t& n, const size_t& numThreads ):
+        _n( n ),
+        _next( 0 ),
+        // a few chunks per thread, each large enough to amortize the lock
+        _chunkSize( std::max( n / ( numThreads * 8 ), size_t( 1 ) ) ) {
+    }
+
+    // false when all the chunks are dealt
+    bool next( size_t& begin, size_t& end ) {
+        boost::mutex::scoped_lock lock( _mutex );
+
+        if ( _next >= _n ) {
+            return false;
+        }
+
+        begin = _next ;
+        end = std::min( _next + _chunkSize, _n );
+        _next = end ;
+        return true;
+    }
+
+private:
+    boost::mutex _mutex ;
+    const size_t _n ;
+    size_t _next ;
+    const size_t _chunkSize ;
+};
+
+//
+// runs the chunks in a thread, the exceptions are transported to the calling thread
+struct Worker {
+    Worker(
+        const boost::function< void ( const size_t&, const size_t& ) >& f,
+        ChunkDealer& dealer,
+        const size_t& thread,
+        boost::exception_ptr& error
+    ):
+        _f( f ),
+        _dealer( dealer ),
+        _thread( thread ),
+        _error( error ) {
+    }
+
+    void operator()() {
+        try {
+            ExecutionPolicy::Scope scope( ExecutionPolicy::sequential() );
+            size_t begin, end ;
+
+            while ( _dealer.next( begin, end ) ) {
+                for ( size_t i = begin; i < end; i++ ) {
+                    _f( i, _thread );
+                }
+            }
+        }
+        catch ( ... ) {
+            _error = boost::current_exception();
+        }
+    }
+
+private:
+    const boost::function< void ( const size_t&, const size_t& ) >& _f ;
+    ChunkDealer& _dealer ;
+    size_t _thread ;
+    boost::exception_ptr& _error ;
+};
+
+//
+// f( i ) for parallelForThreads
+struct IgnoreThread {
+    typedef void result_type ;
+
+    explicit IgnoreThread( const boost::function< void ( const size_t& ) >& f ):
+        _f( f ) {
+    }
+
+    void operator()( const size_t& i, const size_t& ) const {
+        _f( i );
+    }
+
+private:
+    const boost::function< void ( const size_t& ) >& _f ;
+};
+
+}
+
+///
+///
+///
+void parallelFor( const size_t& n, const boost::function< void ( const size_t& ) >& f, const size_t& numThreads )
+{
+    parallelForThreads( n, IgnoreThread( f ), numThreads );
+}
+
+///
+///
+///
+void parallelForThreads( const size_t& n, const boost::function< void ( const size_t&, const size_t& ) >& f, const size_t& numThreads )
+{
+    if ( numThreads <= 1 || n <= 1 ) {
+        for ( size_t i = 0; i < n; i++ ) {
+            f( i, 0 );
+        }
+
+        return ;
+    }
+
+    BOOST_ASSERT( ExecutionPolicy::parallelSupported() );
+
+    ChunkDealer dealer( n, numThreads );
+    std::vector< boost::exception_ptr > errors( numThreads );
+    boost::thread_group threads ;
+
+    try {
+        for ( size_t i = 1; i < numThreads; i++ ) {
+            threads.create_thread( Worker( f, dealer, i, errors[i] ) );
+        }
+    }
+    catch ( ... ) {
+        // the started threads reference the dealer and the errors
+        threads.join_all();
+        throw ;
+    }
+
+    // the calling thread takes its share
+    Worker( f, dealer, 0, errors[0] )();
+
+    threads.join_all();
+
+    for ( size_t i = 0; i < numThreads; i++ ) {
+        if ( errors[i] ) {
+            boost::rethrow_exception( errors[i] );
+        }
+    }
+}
+
+}//detail
+SFCGAL_END_NAMESPACE
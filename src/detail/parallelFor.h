@@ -0,0 +1,55 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_DETAIL_PARALLELFOR_H_
+#define _SFCGAL_DETAIL_PARALLELFOR_H_
+
+#include <SFCGAL/config.h>
+
+#include <cstddef>
+
+#include <boost/function.hpp>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace detail {
+
+/**
+ * Calls f( i ) for each i in [0,n), from numThreads threads (the calling thread and numThreads - 1
+ * new threads). The indices are dealt by chunks : a thread takes the next chunk when it is done
+ * with the previous one, which balances pairs of heterogeneous costs.
+ *
+ * The threads run with a sequential ExecutionPolicy (no nested parallelism). The first exception
+ * thrown by f is rethrown in the calling thread once all the threads are done.
+ *
+ * @pre f( i ) and f( j ) can run concurrently for i != j
+ * @pre numThreads <= 1 or ExecutionPolicy::parallelSupported()
+ */
+SFCGAL_API void parallelFor( const size_t& n, const boost::function< void ( const size_t& ) >& f, const size_t& numThreads );
+
+/**
+ * Same as parallelFor, f( i, t ) also receives the index t in [0,numThreads) of the calling thread
+ * (0 for the thread calling parallelForThreads), which allows per thread resources.
+ */
+SFCGAL_API void parallelForThreads( const size_t& n, const boost::function< void ( const size_t&, const size_t& ) >& f, const size_t& numThreads );
+
+}//detail
+SFCGAL_END_NAMESPACE
+
+#endif
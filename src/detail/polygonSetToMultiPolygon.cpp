@@ -24,7 +24,7 @@
 
 #include <list>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 ///
@@ -47,4 +47,4 @@ std::auto_ptr< MultiPolygon > polygonSetToMultiPolygon( const CGAL::Polygon_set_
 }
 
 } // namespace detail
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
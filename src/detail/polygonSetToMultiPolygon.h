@@ -26,7 +26,7 @@
 #include <CGAL/Polygon_set_2.h>
 #include <SFCGAL/MultiPolygon.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 
 /**
@@ -36,7 +36,7 @@ namespace detail {
 SFCGAL_API std::auto_ptr< MultiPolygon > polygonSetToMultiPolygon( const CGAL::Polygon_set_2< Kernel >& polygonSet ) ;
 
 } // namespace detail
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
@@ -28,7 +28,7 @@
 #include <sstream>
 #include <stack>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace tools {
 
 template < typename CharType > class BasicInputStreamReader ;
@@ -235,7 +235,7 @@ private:
 
 
 }//tools
-}//ign
+SFCGAL_END_NAMESPACE
 
 
 #endif
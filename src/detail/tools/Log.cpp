@@ -23,7 +23,7 @@
 
 #include <SFCGAL/detail/tools/Log.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -144,7 +144,7 @@ Logger& logger()
 }
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -77,7 +77,7 @@
 #define SFCGAL_CRITICAL( message ) SFCGAL::Logger::get()->log( SFCGAL::Logger::Critical, message, __FILE__, __LINE__ )
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 /**
  * [Singleton]Logger class
@@ -172,7 +172,7 @@ private:
 SFCGAL_API Logger& logger() ;
 
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #define SFCGAL_LOG( level, msg ) do { SFCGAL::Logger::get() << "[" << (level) << " " << __FILE__ << ":" << __LINE__ << "] " << msg << std::endl; } while (0)
 
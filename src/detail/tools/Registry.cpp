@@ -37,7 +37,7 @@
 #include <SFCGAL/Exception.h>
 #include <SFCGAL/detail/tools/Log.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace tools {
 
 Registry* Registry::_instance = 0 ;
@@ -155,6 +155,6 @@ Registry::Registry():
 
 
 }//namespace tools
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
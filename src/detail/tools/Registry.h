@@ -27,11 +27,11 @@
 #include <map>
 #include <vector>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace tools {
 
 /**
@@ -88,6 +88,6 @@ private:
 };
 
 }//namespace tools
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -22,7 +22,7 @@
 
 #include <SFCGAL/Point.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -46,5 +46,5 @@ void AffineTransform2::transform( Point& p )
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
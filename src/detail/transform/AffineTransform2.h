@@ -28,7 +28,7 @@
 #include <CGAL/Aff_transformation_2.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 /**
@@ -53,7 +53,7 @@ private:
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
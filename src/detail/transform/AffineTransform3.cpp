@@ -36,7 +36,7 @@
 #include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/PolyhedralSurface.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -129,7 +129,7 @@ void AffineTransform3::transform( Solid& solid )
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
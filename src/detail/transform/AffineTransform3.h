@@ -27,7 +27,7 @@
 
 #include <CGAL/Aff_transformation_3.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 /**
@@ -62,7 +62,7 @@ private:
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
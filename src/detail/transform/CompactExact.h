@@ -0,0 +1,73 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_TRANSFORM_COMPACTEXACT_H_
+#define _SFCGAL_TRANSFORM_COMPACTEXACT_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Transform.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace transform {
+
+/**
+ * Drops the lazy exact construction history of the coordinates (see Coordinate::compact)
+ */
+class SFCGAL_API CompactExact : public Transform {
+public:
+    /**
+     * Constructor
+     * @param roundToDouble store the nearest doubles when they are not the exact values
+     */
+    CompactExact( const bool& roundToDouble = false ) ;
+
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void transform( Point& p ) ;
+
+    /**
+     * number of visited (non empty) coordinates
+     */
+    inline size_t numCoordinates() const {
+        return _numCoordinates ;
+    }
+    /**
+     * number of coordinates stored as doubles after the transform
+     */
+    inline size_t numDoubles() const {
+        return _numDoubles ;
+    }
+
+private:
+    bool   _roundToDouble ;
+    size_t _numCoordinates ;
+    size_t _numDoubles ;
+};
+
+}//transform
+SFCGAL_END_NAMESPACE
+
+
+
+
+#endif
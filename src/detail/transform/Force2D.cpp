@@ -22,7 +22,7 @@
 #include <SFCGAL/Point.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -37,7 +37,7 @@ void Force2D::transform( Point& p )
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -26,7 +26,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Transform.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 /**
@@ -41,7 +41,7 @@ public:
 };
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
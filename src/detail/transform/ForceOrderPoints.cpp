@@ -22,9 +22,10 @@
 #include <SFCGAL/Point.h>
 #include <SFCGAL/Triangle.h>
 #include <SFCGAL/Polygon.h>
+#include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/algorithm/orientation.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -105,8 +106,22 @@ void ForceOrderPoints::visit( Polygon& p )
 
 }
 
+void ForceOrderPoints::visit( TriangulatedSurface& g )
+{
+    if ( ! g.is3D() ) {
+        // triangles are reversed in the mesh (shared vertices are kept)
+        for ( size_t i = 0; i < g.numTriangles(); ++i ) {
+            if ( algorithm::isCounterClockWiseOriented( g, i ) != _orientCCW ) {
+                g.reverseTriangle( i );
+            }
+        }
+
+        Transform::visit( g );
+    }
+}
+
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -26,7 +26,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Transform.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 namespace transform {
 
@@ -49,6 +49,7 @@ public:
 
     virtual void visit( Triangle& );
     virtual void visit( Polygon& );
+    virtual void visit( TriangulatedSurface& );
 
 private:
     bool _orientCCW;
@@ -56,7 +57,7 @@ private:
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -22,7 +22,7 @@
 #include <SFCGAL/Point.h>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -46,7 +46,7 @@ void ForceZ::transform( Point& p )
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -22,9 +22,10 @@
 #include <SFCGAL/Point.h>
 #include <SFCGAL/Triangle.h>
 #include <SFCGAL/Polygon.h>
+#include <SFCGAL/TriangulatedSurface.h>
 #include <SFCGAL/algorithm/orientation.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -87,8 +88,23 @@ void ForceZOrderPoints::visit( Polygon& p )
 
 }
 
+void ForceZOrderPoints::visit( TriangulatedSurface& g )
+{
+    if ( ! g.is3D() ) {
+        // triangles are reversed in the mesh (shared vertices are kept)
+        for ( size_t i = 0; i < g.numTriangles(); ++i ) {
+            if ( ! algorithm::isCounterClockWiseOriented( g, i ) ) {
+                // not pointing up, reverse
+                g.reverseTriangle( i );
+            }
+        }
+
+        Transform::visit( g );
+    }
+}
+
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
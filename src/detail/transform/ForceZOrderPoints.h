@@ -26,7 +26,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Transform.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 namespace transform {
 
@@ -50,6 +50,7 @@ public:
 
     virtual void visit( Triangle& );
     virtual void visit( Polygon& );
+    virtual void visit( TriangulatedSurface& );
 
 private:
     Kernel::FT _defaultZ ;
@@ -57,7 +58,7 @@ private:
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
@@ -22,7 +22,7 @@
 
 #include <SFCGAL/Point.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 ///
@@ -43,7 +43,7 @@ void RoundTransform::transform( Point& p )
 }
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
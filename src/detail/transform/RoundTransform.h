@@ -26,7 +26,7 @@
 #include <SFCGAL/Kernel.h>
 #include <SFCGAL/Transform.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace transform {
 
 /**
@@ -50,7 +50,7 @@ private:
 
 
 }//transform
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
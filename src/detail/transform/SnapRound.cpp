@@ -0,0 +1,235 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <SFCGAL/detail/transform/SnapRound.h>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+
+#include <CGAL/Kernel/global_functions.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace transform {
+
+namespace {
+
+///
+/// a triangle is flat when its snapped vertices are collinear
+///
+bool isFlat( const Point& a, const Point& b, const Point& c )
+{
+    return CGAL::collinear( a.toPoint_3(), b.toPoint_3(), c.toPoint_3() ) ;
+}
+
+///
+/// emptiness of the parts before the snapping
+///
+std::vector< bool > emptyParts( const GeometryCollection& g )
+{
+    std::vector< bool > empty( g.numGeometries() );
+
+    for ( size_t i = 0; i < g.numGeometries(); i++ ) {
+        empty[i] = g.geometryN( i ).isEmpty() ;
+    }
+
+    return empty ;
+}
+
+///
+/// removes the parts emptied by the snapping (parts which were already empty are kept)
+///
+void removeCollapsedParts( GeometryCollection& g, const std::vector< bool >& empty )
+{
+    for ( size_t i = g.numGeometries(); i > 0; i-- ) {
+        if ( ! empty[i - 1] && static_cast< const GeometryCollection& >( g ).geometryN( i - 1 ).isEmpty() ) {
+            g.removeGeometryN( i - 1 );
+        }
+    }
+}
+
+}
+
+///
+///
+///
+SnapRound::SnapRound( const long& scale ):
+    RoundTransform( scale )
+{
+
+}
+
+///
+///
+///
+void SnapRound::transform( Point& p )
+{
+    RoundTransform::transform( p );
+    p.coordinate().compact() ;
+}
+
+///
+///
+///
+void SnapRound::visit( LineString& g )
+{
+    RoundTransform::visit( g );
+    g.removeRepeatedPoints() ;
+
+    if ( g.numPoints() == 1 ) {
+        g.clear() ;
+    }
+}
+
+///
+///
+///
+void SnapRound::visit( Polygon& g )
+{
+    if ( g.isEmpty() ) {
+        return ;
+    }
+
+    // rings are snapped by visit( LineString& )
+    RoundTransform::visit( g );
+
+    if ( g.exteriorRing().numPoints() < 4 ) {
+        g = Polygon() ;
+        return ;
+    }
+
+    for ( size_t i = g.numInteriorRings(); i > 0; i-- ) {
+        if ( g.interiorRingN( i - 1 ).numPoints() < 4 ) {
+            g.removeInteriorRingN( i - 1 );
+        }
+    }
+}
+
+///
+///
+///
+void SnapRound::visit( Triangle& g )
+{
+    if ( g.isEmpty() ) {
+        return ;
+    }
+
+    RoundTransform::visit( g );
+
+    if ( isFlat( g.vertex( 0 ), g.vertex( 1 ), g.vertex( 2 ) ) ) {
+        g = Triangle() ;
+    }
+}
+
+///
+///
+///
+void SnapRound::visit( MultiLineString& g )
+{
+    const std::vector< bool > empty = emptyParts( g );
+    RoundTransform::visit( g );
+    removeCollapsedParts( g, empty );
+}
+
+///
+///
+///
+void SnapRound::visit( MultiPolygon& g )
+{
+    const std::vector< bool > empty = emptyParts( g );
+    RoundTransform::visit( g );
+    removeCollapsedParts( g, empty );
+}
+
+///
+///
+///
+void SnapRound::visit( GeometryCollection& g )
+{
+    const std::vector< bool > empty = emptyParts( g );
+    RoundTransform::visit( g );
+    removeCollapsedParts( g, empty );
+}
+
+///
+///
+///
+void SnapRound::visit( PolyhedralSurface& g )
+{
+    std::vector< bool > empty( g.numPolygons() );
+
+    for ( size_t i = 0; i < g.numPolygons(); i++ ) {
+        empty[i] = g.polygonN( i ).isEmpty() ;
+    }
+
+    RoundTransform::visit( g );
+
+    for ( size_t i = g.numPolygons(); i > 0; i-- ) {
+        if ( ! empty[i - 1] && g.polygonN( i - 1 ).isEmpty() ) {
+            g.removePolygonN( i - 1 );
+        }
+    }
+}
+
+///
+///
+///
+void SnapRound::visit( TriangulatedSurface& g )
+{
+    // snaps the shared vertices
+    RoundTransform::visit( g );
+
+    const TriangulatedSurface& mesh = g ;
+    std::vector< size_t > faces ;
+    faces.reserve( mesh.numTriangles() );
+
+    for ( size_t i = 0; i < mesh.numTriangles(); i++ ) {
+        if ( ! isFlat( mesh.triangleVertex( i, 0 ), mesh.triangleVertex( i, 1 ), mesh.triangleVertex( i, 2 ) ) ) {
+            faces.push_back( i );
+        }
+    }
+
+    if ( faces.size() == mesh.numTriangles() ) {
+        return ;
+    }
+
+    // rebuilds the mesh without the flat faces
+    TriangulatedSurface snapped ;
+
+    for ( size_t i = 0; i < mesh.numVertices(); i++ ) {
+        snapped.addVertex( mesh.vertexN( i ) );
+    }
+
+    for ( size_t i = 0; i < faces.size(); i++ ) {
+        snapped.addTriangle( mesh.vertexIndex( faces[i], 0 ), mesh.vertexIndex( faces[i], 1 ), mesh.vertexIndex( faces[i], 2 ) );
+    }
+
+    g = snapped ;
+}
+
+}//transform
+SFCGAL_END_NAMESPACE
+
@@ -0,0 +1,97 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SFCGAL_TRANSFORM_SNAPROUND_H_
+#define _SFCGAL_TRANSFORM_SNAPROUND_H_
+
+#include <SFCGAL/config.h>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/detail/transform/RoundTransform.h>
+
+SFCGAL_BEGIN_NAMESPACE
+namespace transform {
+
+/**
+ * Snaps the coordinates of a Geometry to a grid (1/scale). Snapped coordinates
+ * are compacted and the points collapsed by the snapping are removed from the
+ * linestrings and the rings.
+ *
+ * Parts collapsed by the snapping are dropped : LineStrings reduced to a point,
+ * rings with less than 4 points (a collapsed exterior ring drops the Polygon) and
+ * flat Triangles (including the faces of a TriangulatedSurface). A collapsed part
+ * is removed from its collection, a collapsed root geometry becomes empty.
+ */
+class SFCGAL_API SnapRound : public RoundTransform {
+public:
+    /**
+     * Constructor with a scale factor (default is nearest integer)
+     */
+    SnapRound( const long& scale = 1 ) ;
+
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void transform( Point& p ) ;
+
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( LineString& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( Polygon& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( Triangle& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( MultiLineString& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( MultiPolygon& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( GeometryCollection& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( PolyhedralSurface& g ) ;
+    /*
+     * [SFCGAL::Transform]
+     */
+    virtual void visit( TriangulatedSurface& g ) ;
+
+    using RoundTransform::visit ;
+};
+
+
+}//transform
+SFCGAL_END_NAMESPACE
+
+
+
+
+#endif
@@ -26,7 +26,9 @@
 
 #include <SFCGAL/detail/triangulate/markDomains.h>
 
-namespace SFCGAL {
+#include <map>
+
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 ///
@@ -134,6 +136,10 @@ void ConstraintDelaunayTriangulation::getTriangles( TriangulatedSurface& triangu
 {
     triangulatedSurface.reserve( triangulatedSurface.numTriangles() + numTriangles() );
 
+    // vertex of the triangulation => index of the vertex in the mesh (added once)
+    typedef std::map< const void*, size_t > VertexIndexMap ;
+    VertexIndexMap vertexIndex ;
+
     for ( Finite_faces_iterator it = finite_faces_begin(); it != finite_faces_end(); ++it ) {
         if ( filterExteriorParts && ( it->info().nestingLevel % 2 == 0 ) ) {
             continue ;
@@ -152,7 +158,26 @@ void ConstraintDelaunayTriangulation::getTriangles( TriangulatedSurface& triangu
                                    ) ) ;
         }
 
-        triangulatedSurface.addTriangle( new Triangle( Point( a ), Point( b ), Point( c ) ) );
+        if ( ! triangulatedSurface.isIndexed() ) {
+            triangulatedSurface.addTriangle( new Triangle( Point( a ), Point( b ), Point( c ) ) );
+            continue ;
+        }
+
+        size_t index[3] ;
+
+        for ( int i = 0; i < 3; i++ ) {
+            const std::pair< VertexIndexMap::iterator, bool > inserted = vertexIndex.insert(
+                        std::make_pair( static_cast< const void* >( &*it->vertex( i ) ), 0 )
+                    );
+
+            if ( inserted.second ) {
+                inserted.first->second = triangulatedSurface.addVertex( Point( it->vertex( i )->info().original ) );
+            }
+
+            index[i] = inserted.first->second ;
+        }
+
+        triangulatedSurface.addTriangle( index[0], index[1], index[2] );
     }
 }
 
@@ -168,5 +193,5 @@ std::auto_ptr< TriangulatedSurface > ConstraintDelaunayTriangulation::getTriangu
 
 
 } // namespace triangulate
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -30,12 +30,12 @@
 #include <CGAL/Triangulation_vertex_base_with_info_2.h>
 #include <CGAL/Triangulation_face_base_with_info_2.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class TriangulatedSurface ;
-}
+SFCGAL_END_NAMESPACE
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 /**
@@ -204,6 +204,6 @@ private:
 };
 
 } // namespace triangulate
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
@@ -21,8 +21,9 @@
 #ifndef _SFCGAL_TRIANGULATE_DETAIL_MARKDOMAINS_H_
 #define _SFCGAL_TRIANGULATE_DETAIL_MARKDOMAINS_H_
 
+#include <SFCGAL/config.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 namespace detail {
 
@@ -106,7 +107,7 @@ void markDomains( CDT& cdt )
 
 }//namespace detail
 }//namespace triangulate
-}//namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif
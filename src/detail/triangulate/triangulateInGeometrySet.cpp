@@ -29,7 +29,7 @@
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 /**
@@ -125,10 +125,9 @@ void triangulate( const CGAL::Polygon_with_holes_2<Kernel>& polygon, GeometrySet
     TriangulatedSurface surf;
     triangulatePolygon3D( poly, surf );
 
-    for ( size_t i = 0; i < surf.numTriangles(); ++i ) {
-        output.addGeometry( surf.triangleN( i ) );
-    }
+    // read through the const accessors (the mesh is not switched to a triangle soup)
+    output.addGeometry( static_cast< const TriangulatedSurface& >( surf ) );
 }
 
 }
-}
+SFCGAL_END_NAMESPACE
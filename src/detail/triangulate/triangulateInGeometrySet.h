@@ -25,7 +25,7 @@
 
 #include <SFCGAL/detail/GeometrySet.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 /**
@@ -38,7 +38,7 @@ SFCGAL_API void triangulate( const detail::MarkedPolyhedron& polyhedron, detail:
 SFCGAL_API void triangulate( const CGAL::Polygon_with_holes_2<Kernel>& polygon, detail::GeometrySet<2>& geometry );
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
 
@@ -21,13 +21,15 @@
 #ifndef _SFCGAL_UBLAS_H_
 #define _SFCGAL_UBLAS_H_
 
+#include <SFCGAL/config.h>
+
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace detail {
 namespace ublas = boost::numeric::ublas ;
 } // namespace detail
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
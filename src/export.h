@@ -37,6 +37,20 @@
 #endif
 
 
+//----- NAMESPACE ------------------------
+
+// The library built with the inexact constructions kernel (see SFCGAL_BUILD_INEXACT
+// and Kernel.h) declares its API in the SFCGAL::inexact inline namespace. Clients
+// keep on writing SFCGAL::Point, while the symbols of both variants differ so that
+// they can be linked in the same process.
+#ifdef SFCGAL_USE_INEXACT_KERNEL
+#  define SFCGAL_BEGIN_NAMESPACE namespace SFCGAL { inline namespace inexact {
+#  define SFCGAL_END_NAMESPACE   } }
+#else
+#  define SFCGAL_BEGIN_NAMESPACE namespace SFCGAL {
+#  define SFCGAL_END_NAMESPACE   }
+#endif
+
 //TODO : split cxx api and capi?
 
 #ifdef SFCGAL_USE_STATIC_LIBS
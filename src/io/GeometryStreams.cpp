@@ -22,7 +22,7 @@
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -41,4 +41,4 @@ std::ostream& operator<<( std::ostream& ostr, const Geometry& g )
     return ostr;
 }
 
-}
+SFCGAL_END_NAMESPACE
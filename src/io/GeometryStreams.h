@@ -25,7 +25,7 @@
 
 #include <SFCGAL/config.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 class Envelope;
 class Geometry;
@@ -39,6 +39,6 @@ SFCGAL_API std::ostream& operator<< ( std::ostream&, const Envelope& );
  * Ostream operator for Geometry;
  */
 SFCGAL_API std::ostream& operator<< ( std::ostream&, const Geometry& );
-}
+SFCGAL_END_NAMESPACE
 
 #endif
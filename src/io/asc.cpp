@@ -27,7 +27,7 @@
 
 using namespace SFCGAL::detail;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 ///
@@ -121,5 +121,5 @@ std::auto_ptr< Grid > readASC( std::istream& s )
 
 
 } // namespace io
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
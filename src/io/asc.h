@@ -27,7 +27,7 @@
 
 #include <SFCGAL/Grid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 /**
@@ -38,6 +38,6 @@ SFCGAL_API std::auto_ptr< Grid > readASC( std::istream& s ) ;
 
 
 } // namespace io
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
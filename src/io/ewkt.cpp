@@ -26,7 +26,7 @@
 
 using namespace SFCGAL::detail::io;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 ///
@@ -66,6 +66,6 @@ std::auto_ptr< PreparedGeometry > readEwkt( const char* str, size_t len )
 }
 
 }//io
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
@@ -27,12 +27,12 @@
 #include <string>
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
 class PreparedGeometry ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 /**
  * Read a EWKT prepared geometry from an input stream
@@ -47,6 +47,6 @@ SFCGAL_API std::auto_ptr< PreparedGeometry > readEwkt( const std::string& s ) ;
  */
 SFCGAL_API std::auto_ptr< PreparedGeometry > readEwkt( const char*, size_t );
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
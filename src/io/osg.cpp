@@ -30,7 +30,7 @@
 
 #include <osgDB/WriteFile>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 ///
@@ -58,7 +58,7 @@ osg::Geometry* toOsgGeometry( const Geometry& g )
 
 
 } // namespace io
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 #endif //SFCGAL_WITH_OSG
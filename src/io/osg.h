@@ -33,12 +33,12 @@ namespace osg {
 class Geometry ;
 }
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
-}
+SFCGAL_END_NAMESPACE
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 /**
@@ -56,7 +56,7 @@ SFCGAL_API osg::Geometry* toOsgGeometry( const Geometry& g ) ;
 
 
 } // namespace io
-} // namespace SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
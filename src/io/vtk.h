@@ -40,7 +40,7 @@
 
 using namespace SFCGAL ;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 // print each ring has a different polygon
 inline
@@ -128,23 +128,22 @@ void vtk( const TriangulatedSurface& s, const std::string& file )
 {
     std::stringstream pointStr;
     std::stringstream polyStr;
-    size_t numPoints=0;
-    size_t numTri=0;
-    size_t numData=0;
+    const size_t numPoints=s.numVertices();
+    const size_t numTri=s.numTriangles();
 
-    for ( size_t i=0; i!=s.numTriangles(); ++i ) {
-        const Triangle& tri = s.triangleN( i );
+    // the vertex buffer is written once, triangles refer to it
+    for ( size_t i=0; i!=numPoints; ++i ) {
+        const Point& p = s.vertexN( i );
+        pointStr << p.x() << " " << p.y() << " " << p.z() << "\n";
+    }
+
+    for ( size_t i=0; i!=numTri; ++i ) {
         polyStr << 3;
 
         for ( size_t p=0; p!=3; ++p ) {
-            pointStr << tri.vertex( p ).x() << " " << tri.vertex( p ).y() << " " << tri.vertex( p ).z() << "\n";
-            polyStr << " " << numPoints;
-            ++numPoints;
-            ++numData;
+            polyStr << " " << s.vertexIndex( i, p );
         }
 
-        ++numData;
-        ++numTri;
         polyStr << "\n";
     }
 
@@ -156,7 +155,7 @@ void vtk( const TriangulatedSurface& s, const std::string& file )
         << "DATASET POLYDATA\n"
         << "POINTS " << numPoints << " float\n"
         << pointStr.str()
-        << "POLYGONS " << numTri << " " << numData << "\n"
+        << "POLYGONS " << numTri << " " << 4 * numTri << "\n"
         << polyStr.str();
 }
 
@@ -200,6 +199,6 @@ void vtk( const Geometry& g, const std::string& file )
     }
 }
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
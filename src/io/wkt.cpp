@@ -26,7 +26,7 @@
 
 using namespace SFCGAL::detail::io;
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 
 ///
@@ -60,6 +60,6 @@ std::auto_ptr< Geometry > readWkt( const char* str, size_t len )
 }
 
 }//io
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
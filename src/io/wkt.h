@@ -27,11 +27,11 @@
 #include <string>
 #include <memory>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 class Geometry ;
-}
+SFCGAL_END_NAMESPACE
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace io {
 /**
  * Read a WKT geometry from an input stream
@@ -46,6 +46,6 @@ SFCGAL_API std::auto_ptr< Geometry > readWkt( const std::string& s ) ;
  */
 SFCGAL_API std::auto_ptr< Geometry > readWkt( const char*, size_t );
 }
-}
+SFCGAL_END_NAMESPACE
 
 #endif
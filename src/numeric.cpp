@@ -20,7 +20,7 @@
 
 #include <SFCGAL/numeric.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 ///
 ///
@@ -58,6 +58,6 @@ CGAL::Gmpz round( const CGAL::Gmpq& v )
     }
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
@@ -28,7 +28,7 @@
 
 #include <SFCGAL/Kernel.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 /**
  * shortcut to get NaN for double
  */
@@ -71,6 +71,6 @@ SFCGAL_API CGAL::Gmpz ceil( const CGAL::Gmpq& v ) ;
  */
 SFCGAL_API CGAL::Gmpz round( const CGAL::Gmpq& v ) ;
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
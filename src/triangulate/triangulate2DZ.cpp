@@ -24,11 +24,13 @@
 #include <SFCGAL/LineString.h>
 #include <SFCGAL/Polygon.h>
 #include <SFCGAL/Triangle.h>
+#include <SFCGAL/TriangulatedSurface.h>
 
 #include <SFCGAL/Exception.h>
+#include <SFCGAL/FilterStatistics.h>
 #include <SFCGAL/algorithm/isValid.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 typedef ConstraintDelaunayTriangulation::Vertex_handle Vertex_handle ;
@@ -88,6 +90,17 @@ void triangulate2DZ( const Triangle& g, ConstraintDelaunayTriangulation& triangu
 ///
 void triangulateCollection2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangulation )
 {
+    if ( g.is< TriangulatedSurface >() ) {
+        // one triangle at a time, not the triangle cache of the mesh
+        const TriangulatedSurface& tin = g.as< TriangulatedSurface >();
+
+        for ( size_t i = 0; i < tin.numTriangles(); i++ ) {
+            triangulate2DZ( tin.triangleN( i ).toTriangle(), triangulation ) ;
+        }
+
+        return ;
+    }
+
     for ( size_t i = 0; i < g.numGeometries(); i++ ) {
         triangulate2DZ( g.geometryN( i ), triangulation ) ;
     }
@@ -112,6 +125,7 @@ void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulation& triangu
         SFCGAL_ASSERT_GEOMETRY_VALIDITY_2D( g );
     }
 
+    SFCGAL_FILTER_STATISTICS_SCOPE( TRIANGULATION );
 
     switch ( g.geometryTypeId() ) {
     case TYPE_POINT:
@@ -164,6 +178,6 @@ ConstraintDelaunayTriangulation triangulate2DZ( const Geometry& g )
 
 
 }//triangulate
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
@@ -26,7 +26,7 @@
 #include <SFCGAL/Geometry.h>
 #include <SFCGAL/detail/triangulate/ConstraintDelaunayTriangulation.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 /**
  * @brief Constraint 2DZ Delaunay Triangulation (keep Z if defined, a projectionPlane may be provided)
@@ -38,7 +38,7 @@ SFCGAL_API void triangulate2DZ( const Geometry& g, ConstraintDelaunayTriangulati
 SFCGAL_API ConstraintDelaunayTriangulation triangulate2DZ( const Geometry& g );
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
 
@@ -24,6 +24,7 @@
 #include <SFCGAL/PolyhedralSurface.h>
 #include <SFCGAL/Solid.h>
 #include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/FilterStatistics.h>
 
 #include <SFCGAL/detail/triangulate/ConstraintDelaunayTriangulation.h>
 
@@ -34,7 +35,7 @@
 #include <iostream>
 
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 typedef ConstraintDelaunayTriangulation::Vertex_handle Vertex_handle ;
@@ -53,6 +54,8 @@ void triangulatePolygon3D(
 
     SFCGAL_ASSERT_GEOMETRY_VALIDITY( g );
 
+    SFCGAL_FILTER_STATISTICS_SCOPE( TRIANGULATION );
+
     switch ( g.geometryTypeId() ) {
     case TYPE_TRIANGLE:
         return triangulatePolygon3D( g.as< Triangle >(), triangulatedSurface );
@@ -145,6 +148,8 @@ void triangulatePolygon3D(
         return ;
     }
 
+    SFCGAL_FILTER_STATISTICS_SCOPE( TRIANGULATION );
+
     /*
      * Prepare a Constraint Delaunay Triangulation
      */
@@ -224,7 +229,7 @@ void triangulatePolygon3D(
 
 
 }//triangulate
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 
 
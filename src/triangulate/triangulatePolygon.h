@@ -25,7 +25,7 @@
 
 #include <SFCGAL/Geometry.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 namespace triangulate {
 
 /**
@@ -100,7 +100,7 @@ SFCGAL_API void triangulatePolygon3D(
 );
 
 }//algorithm
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
 #endif
 
@@ -20,7 +20,7 @@
 
 #include <SFCGAL/version.h>
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
 
 const char _sfcgal_version[] = SFCGAL_VERSION;
 
@@ -29,5 +29,5 @@ const char* Version()
     return _sfcgal_version;
 }
 
-}//SFCGAL
+SFCGAL_END_NAMESPACE
 
@@ -29,9 +29,9 @@
 
 #define SFCGAL_VERSION "@SFCGAL_VERSION@"
 
-namespace SFCGAL {
+SFCGAL_BEGIN_NAMESPACE
     SFCGAL_API const char* Version();
-}
+SFCGAL_END_NAMESPACE
 
 #endif
 
@@ -0,0 +1,256 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <contact@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/algorithm/collectionToMulti.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/compactExact.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/io/wkt.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/config.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+//
+// counts the calls to the global operator new and the allocated bytes in the bench program
+namespace {
+size_t allocationCount = 0 ;
+size_t allocatedBytes = 0 ;
+// the size of each allocation is stored before the returned block (keeps the alignment)
+const size_t headerSize = 16 ;
+}
+
+#ifdef BOOST_NO_CXX11_NOEXCEPT
+void* operator new( std::size_t size ) throw( std::bad_alloc )
+#else
+void* operator new( std::size_t size )
+#endif
+{
+    ++allocationCount ;
+    char* p = static_cast< char* >( std::malloc( headerSize + size ) );
+
+    if ( p == NULL ) {
+        throw std::bad_alloc();
+    }
+
+    *reinterpret_cast< std::size_t* >( p ) = size ;
+    allocatedBytes += size ;
+    return p + headerSize ;
+}
+
+void* operator new( std::size_t size, const std::nothrow_t& ) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    try {
+        return operator new( size );
+    }
+    catch ( std::bad_alloc& ) {
+        return NULL ;
+    }
+}
+
+void operator delete( void* p ) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    if ( p == NULL ) {
+        return ;
+    }
+
+    char* block = static_cast< char* >( p ) - headerSize ;
+    allocatedBytes -= *reinterpret_cast< std::size_t* >( block );
+    std::free( block );
+}
+
+void operator delete( void* p, const std::nothrow_t& ) BOOST_NOEXCEPT_OR_NOTHROW
+{
+    operator delete( p );
+}
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchAllocations )
+
+#define N_PARTS 10000
+#define N_RING_POINTS 50
+#define N_OVERLAYS 30
+
+namespace {
+
+/**
+ * a GeometryCollection of N_PARTS polygons and polyhedral surfaces
+ */
+std::auto_ptr< GeometryCollection > makeCollection()
+{
+    std::auto_ptr< GeometryCollection > collection( new GeometryCollection );
+
+    for ( int i = 0; i < N_PARTS; i++ ) {
+        LineString ring ;
+
+        for ( int j = 0; j < N_RING_POINTS; j++ ) {
+            ring.addPoint( Point( i + j, j, 0.0 ) );
+        }
+
+        ring.addPoint( ring.startPoint() );
+
+        if ( i % 2 == 0 ) {
+            collection->addGeometry( new Polygon( ring ) );
+        }
+        else {
+            std::auto_ptr< PolyhedralSurface > surface( new PolyhedralSurface );
+            surface->addPolygon( Polygon( ring ) );
+            collection->addGeometry( surface.release() );
+        }
+    }
+
+    return collection ;
+}
+
+/**
+ * previous collectionToMulti behaviour : each part is cloned, then cloned again by addGeometry
+ */
+std::auto_ptr< MultiPolygon > collectionToMultiByCopy( const GeometryCollection& collection )
+{
+    std::auto_ptr< MultiPolygon > multi( new MultiPolygon );
+
+    for ( size_t i = 0; i < collection.numGeometries(); i++ ) {
+        std::auto_ptr< Geometry > part( collection.geometryN( i ).clone() );
+
+        for ( size_t j = 0; j < part->numGeometries(); j++ ) {
+            multi->addGeometry( part->geometryN( j ) );
+        }
+    }
+
+    return multi ;
+}
+
+/**
+ * a TriangulatedSurface made of N_PARTS disconnected triangles
+ */
+std::auto_ptr< TriangulatedSurface > makeDisconnectedTriangles()
+{
+    std::auto_ptr< TriangulatedSurface > tin( new TriangulatedSurface );
+
+    for ( int i = 0; i < N_PARTS; i++ ) {
+        tin->addTriangle( new Triangle( Point( 2 * i, 0.0, 0.0 ), Point( 2 * i + 1, 0.0, 0.0 ), Point( 2 * i, 1.0, 1.0 ) ) );
+    }
+
+    return tin ;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testCollectionToMultiAllocations )
+{
+    std::auto_ptr< GeometryCollection > collection( makeCollection() );
+
+    size_t count = allocationCount ;
+    bench().start( "collectionToMulti by copy (previous)" ) ;
+    std::auto_ptr< MultiPolygon > copied( collectionToMultiByCopy( *collection ) );
+    bench().stop();
+    bench().s() << boost::format( "collectionToMulti by copy (previous) allocations : %1%" ) % ( allocationCount - count ) << std::endl ;
+
+    count = allocationCount ;
+    bench().start( "collectionToMulti by move" ) ;
+    std::auto_ptr< Geometry > moved( algorithm::collectionToMulti( std::auto_ptr< Geometry >( collection.release() ) ) );
+    bench().stop();
+    bench().s() << boost::format( "collectionToMulti by move allocations : %1%" ) % ( allocationCount - count ) << std::endl ;
+
+    BOOST_CHECK_EQUAL( moved->numGeometries(), copied->numGeometries() );
+}
+
+BOOST_AUTO_TEST_CASE( testRecomposeAllocations )
+{
+    std::auto_ptr< TriangulatedSurface > tin( makeDisconnectedTriangles() );
+    const detail::GeometrySet< 3 > geometrySet( *tin );
+
+    size_t count = allocationCount ;
+    bench().start( "recompose" ) ;
+    std::auto_ptr< Geometry > recomposed( geometrySet.recompose() );
+    bench().stop();
+    const size_t recomposeCount = allocationCount - count ;
+    bench().s() << boost::format( "recompose (triangles moved) allocations : %1%" ) % recomposeCount << std::endl ;
+
+    // previous behaviour : triangles were copied to their connected component
+    count = allocationCount ;
+    bench().start( "recompose components by copy (previous)" ) ;
+    std::auto_ptr< GeometryCollection > components( new GeometryCollection );
+
+    for ( size_t i = 0; i < recomposed->numGeometries(); i++ ) {
+        const Geometry& component = recomposed->geometryN( i );
+        std::auto_ptr< TriangulatedSurface > copy( new TriangulatedSurface );
+
+        for ( size_t j = 0; j < component.numGeometries(); j++ ) {
+            copy->addTriangle( component.geometryN( j ).as< Triangle >() );
+        }
+
+        components->addGeometry( copy.release() );
+    }
+
+    bench().stop();
+    bench().s() << boost::format( "recompose (previous, triangles copied) allocations : %1%" ) % ( recomposeCount + allocationCount - count ) << std::endl ;
+
+    BOOST_CHECK_EQUAL( recomposed->numGeometries(), static_cast< size_t >( N_PARTS ) );
+}
+
+BOOST_AUTO_TEST_CASE( testCompactExactMemory )
+{
+    // iterative overlay : each result is clipped by a rotated square
+    std::auto_ptr< Geometry > result( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+
+    for ( int i = 1; i <= N_OVERLAYS; i++ ) {
+        const double angle = 0.05 * i ;
+        const double c = 7.0 * std::cos( angle ) ;
+        const double s = 7.0 * std::sin( angle ) ;
+
+        LineString ring ;
+        ring.addPoint( Point( 5.0 + c, 5.0 + s ) );
+        ring.addPoint( Point( 5.0 - s, 5.0 + c ) );
+        ring.addPoint( Point( 5.0 - c, 5.0 - s ) );
+        ring.addPoint( Point( 5.0 + s, 5.0 - c ) );
+        ring.addPoint( ring.startPoint() );
+
+        result = algorithm::intersection( *result, Polygon( ring ) );
+    }
+
+    const size_t bytes = allocatedBytes ;
+    bench().start( "compactExact" ) ;
+    algorithm::CompactExactStatistics statistics = algorithm::compactExact( *result );
+    bench().stop();
+
+    bench().s() << boost::format( "compactExact : %1% coordinates (%2% doubles), %3% bytes reclaimed" )
+                % statistics.numCoordinates % statistics.numDoubles % ( static_cast< long >( bytes ) - static_cast< long >( allocatedBytes ) ) << std::endl ;
+
+    BOOST_CHECK_EQUAL( statistics.numCoordinates, result->as< Polygon >().exteriorRing().numPoints() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -31,6 +31,8 @@
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
 
+#include <boost/ptr_container/ptr_vector.hpp>
+
 #include "../test_config.h"
 
 #include "Bench.h"
@@ -43,6 +45,70 @@ using namespace SFCGAL ;
 
 BOOST_AUTO_TEST_SUITE( SFCGAL_BenchContainer )
 
+#define N_POINTS 1000000
+
+//
+// previous LineString layout (one heap allocated Point per vertex)
+BOOST_AUTO_TEST_CASE( testLineStringPtrVectorLayout )
+{
+    bench().start( "LineString boost::ptr_vector< Point > create" ) ;
+    std::auto_ptr< boost::ptr_vector< Point > > points( new boost::ptr_vector< Point >() ) ;
+    points->reserve( N_POINTS ) ;
+
+    for ( int i = 0; i < N_POINTS; i++ ) {
+        points->push_back( new Point( i, i ) ) ;
+    }
+
+    bench().stop();
+
+    bench().start( "LineString boost::ptr_vector< Point > iterate" ) ;
+    double x = 0.0 , y = 0.0 ;
+
+    for ( boost::ptr_vector< Point >::const_iterator it = points->begin(); it != points->end(); ++it ) {
+        x += CGAL::to_double( it->x() ) ;
+        y += CGAL::to_double( it->y() ) ;
+    }
+
+    bench().stop();
+
+    bench().start( "LineString boost::ptr_vector< Point > destroy" ) ;
+    points.reset();
+    bench().stop();
+
+    BOOST_CHECK( x > 0.0 && y > 0.0 );
+}
+
+//
+// current LineString layout (contiguous point storage)
+BOOST_AUTO_TEST_CASE( testLineStringContiguousLayout )
+{
+    bench().start( "LineString contiguous create" ) ;
+    std::auto_ptr< LineString > lineString( new LineString() ) ;
+    lineString->reserve( N_POINTS ) ;
+
+    for ( int i = 0; i < N_POINTS; i++ ) {
+        lineString->addPoint( Point( i, i ) ) ;
+    }
+
+    bench().stop();
+
+    bench().start( "LineString contiguous iterate" ) ;
+    double x = 0.0 , y = 0.0 ;
+
+    for ( LineString::const_iterator it = lineString->begin(); it != lineString->end(); ++it ) {
+        x += CGAL::to_double( it->x() ) ;
+        y += CGAL::to_double( it->y() ) ;
+    }
+
+    bench().stop();
+
+    bench().start( "LineString contiguous destroy" ) ;
+    lineString.reset();
+    bench().stop();
+
+    BOOST_CHECK( x > 0.0 && y > 0.0 );
+}
+
 #if 0
 
 //
@@ -0,0 +1,98 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/algorithm/coverageOverlay.h>
+#include <SFCGAL/algorithm/spatialJoin.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/isValid.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchCoverageOverlay )
+
+#define N_PARCELS_PER_SIDE 30
+#define N_ZONES_PER_SIDE 7
+
+namespace {
+
+//
+// grid of squares covering [0,240]x[0,240], shifted by offset
+void addGrid( MultiPolygon& grid, const int& n, const double& offset )
+{
+    const double size = 240.0 / n ;
+
+    for ( int i = 0; i < n; i++ ) {
+        for ( int j = 0; j < n; j++ ) {
+            const double x = offset + i * size ;
+            const double y = offset + j * size ;
+            grid.addGeometry( Envelope( x, x + size, y, y + size ).toPolygon().release() );
+        }
+    }
+}
+
+}
+
+//
+// parcels x zoning, both coverages sharing the edges of their polygons
+BOOST_AUTO_TEST_CASE( testParcelsZoningOverlay )
+{
+    MultiPolygon parcels ;
+    addGrid( parcels, N_PARCELS_PER_SIDE, 0.0 );
+    MultiPolygon zoning ;
+    addGrid( zoning, N_ZONES_PER_SIDE, 3.0 );
+
+    bench().s() << boost::format( "overlay of %1% parcels and %2% zones" ) % parcels.numGeometries() % zoning.numGeometries() << std::endl ;
+
+    // previous way : intersection of the candidate pairs
+    bench().start( "spatialJoin + intersection (previous)" ) ;
+    std::vector< std::pair< size_t, size_t > > pairs ;
+    algorithm::spatialJoin( parcels, zoning, algorithm::JOIN_INTERSECTS, pairs );
+
+    double expectedArea = 0.0 ;
+
+    for ( size_t k = 0; k < pairs.size(); k++ ) {
+        std::auto_ptr< Geometry > inter( algorithm::intersection( parcels.polygonN( pairs[k].first ), zoning.polygonN( pairs[k].second ), algorithm::NoValidityCheck() ) );
+        expectedArea += algorithm::area( *inter );
+    }
+
+    bench().stop();
+
+    bench().start( "coverageOverlay" ) ;
+    std::vector< std::pair< size_t, size_t > > provenance ;
+    std::auto_ptr< MultiPolygon > overlay( algorithm::coverageOverlay( parcels, zoning, provenance, algorithm::NoValidityCheck() ) );
+    bench().stop();
+
+    BOOST_CHECK_EQUAL( overlay->numGeometries(), provenance.size() );
+    BOOST_CHECK( std::abs( algorithm::area( *overlay ) - expectedArea ) < 1e-6 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
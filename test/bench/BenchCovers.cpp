@@ -0,0 +1,100 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/isValid.h>
+#include <SFCGAL/detail/generator/disc.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchCovers )
+
+#define N_PARCELS_PER_SIDE 30
+#define N_ZONE_QUADRANT_SEGMENTS 256
+
+//
+// parcels on a grid, inside, outside or across the boundary of a zone (a disc)
+BOOST_AUTO_TEST_CASE( testParcelsWithinZone )
+{
+    std::auto_ptr< Polygon > zone( generator::disc( Point( 0.0, 0.0 ), 100.0, N_ZONE_QUADRANT_SEGMENTS ) );
+
+    boost::ptr_vector< Polygon > parcels ;
+    const double size = 240.0 / N_PARCELS_PER_SIDE ;
+
+    for ( int i = 0; i < N_PARCELS_PER_SIDE; i++ ) {
+        for ( int j = 0; j < N_PARCELS_PER_SIDE; j++ ) {
+            const double x = -120.0 + i * size ;
+            const double y = -120.0 + j * size ;
+            parcels.push_back( Envelope( x, x + size * 0.9, y, y + size * 0.9 ).toPolygon().release() );
+        }
+    }
+
+    bench().s() << boost::format( "%1% parcels within a zone of %2% points" ) % parcels.size() % zone->exteriorRing().numPoints() << std::endl ;
+
+    // previous way : area of the intersection
+    std::vector< bool > expected ;
+    bench().start( "area( intersection ) == area (previous)" ) ;
+
+    for ( size_t i = 0; i < parcels.size(); i++ ) {
+        std::auto_ptr< Geometry > inter( algorithm::intersection( *zone, parcels[i], algorithm::NoValidityCheck() ) );
+        expected.push_back( std::abs( algorithm::area( *inter ) - algorithm::area( parcels[i] ) ) < 1e-9 );
+    }
+
+    bench().stop();
+
+    std::vector< bool > results ;
+    bench().start( "covers" ) ;
+
+    for ( size_t i = 0; i < parcels.size(); i++ ) {
+        results.push_back( algorithm::covers( *zone, parcels[i] ) );
+    }
+
+    bench().stop();
+
+    const PreparedGeometry preparedZone( zone->clone() );
+    std::vector< bool > preparedResults ;
+    bench().start( "covers (prepared zone)" ) ;
+
+    for ( size_t i = 0; i < parcels.size(); i++ ) {
+        preparedResults.push_back( algorithm::covers( preparedZone, parcels[i] ) );
+    }
+
+    bench().stop();
+
+    BOOST_CHECK( results == expected );
+    BOOST_CHECK( preparedResults == expected );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/isValid.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchIntersects )
+
+#define N_SQUARES 5000
+
+//
+// interleaved squares along a line, overlapping along one axis and disjoint along the other :
+// no pair of squares intersects, the sweep has to pick the axis where they are spread
+void interleavedSquares( MultiPolygon& a, MultiPolygon& b, const bool& column )
+{
+    for ( int i = 0; i < N_SQUARES; i++ ) {
+        const double s = 2.0 * i ;
+
+        if ( column ) {
+            a.addGeometry( Envelope( 0.0, 1.0, s, s + 0.9 ).toPolygon().release() );
+            b.addGeometry( Envelope( 0.0, 1.0, s + 1.0, s + 1.9 ).toPolygon().release() );
+        }
+        else {
+            a.addGeometry( Envelope( s, s + 0.9, 0.0, 1.0 ).toPolygon().release() );
+            b.addGeometry( Envelope( s + 1.0, s + 1.9, 0.0, 1.0 ).toPolygon().release() );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDisjointRow )
+{
+    MultiPolygon a, b ;
+    interleavedSquares( a, b, false );
+
+    bench().start( boost::format( "intersects, %1% x %1% disjoint squares in a row" ) % N_SQUARES ) ;
+    BOOST_CHECK( ! algorithm::intersects( a, b, algorithm::NoValidityCheck() ) );
+    bench().stop();
+}
+
+BOOST_AUTO_TEST_CASE( testDisjointColumn )
+{
+    MultiPolygon a, b ;
+    interleavedSquares( a, b, true );
+
+    bench().start( boost::format( "intersects, %1% x %1% disjoint squares in a column" ) % N_SQUARES ) ;
+    BOOST_CHECK( ! algorithm::intersects( a, b, algorithm::NoValidityCheck() ) );
+    bench().stop();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,141 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/PolyhedralSurface.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/algorithm/solidBoolean.h>
+#include <SFCGAL/algorithm/difference.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/volume.h>
+#include <SFCGAL/algorithm/isValid.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchSolidBoolean )
+
+// 6 x 2 x 23 x 23 triangles, about the size of test/data/teapot.obj (6320 triangles)
+#define N_FACE_SUBDIVISIONS 23
+
+namespace {
+
+//
+// appends the n x n x 2 triangles of the face o + [0,1].u + [0,1].v (outward if u x v is)
+void addFace( PolyhedralSurface& shell, const Kernel::Vector_3& o, const Kernel::Vector_3& u, const Kernel::Vector_3& v, const int& n )
+{
+    for ( int i = 0; i < n; i++ ) {
+        for ( int j = 0; j < n; j++ ) {
+            const Kernel::FT si = Kernel::FT( i ) / n ;
+            const Kernel::FT si1 = Kernel::FT( i + 1 ) / n ;
+            const Kernel::FT sj = Kernel::FT( j ) / n ;
+            const Kernel::FT sj1 = Kernel::FT( j + 1 ) / n ;
+
+            const Point a( CGAL::ORIGIN + o + u * si + v * sj );
+            const Point b( CGAL::ORIGIN + o + u * si1 + v * sj );
+            const Point c( CGAL::ORIGIN + o + u * si1 + v * sj1 );
+            const Point d( CGAL::ORIGIN + o + u * si + v * sj1 );
+
+            LineString* abc = new LineString ;
+            abc->addPoint( a );
+            abc->addPoint( b );
+            abc->addPoint( c );
+            abc->addPoint( a );
+            shell.addPolygon( new Polygon( abc ) );
+
+            LineString* acd = new LineString ;
+            acd->addPoint( a );
+            acd->addPoint( c );
+            acd->addPoint( d );
+            acd->addPoint( a );
+            shell.addPolygon( new Polygon( acd ) );
+        }
+    }
+}
+
+//
+// cube of side size at (x,y,z), each face subdivided in n x n squares
+std::auto_ptr< Solid > subdividedCube( const double& x, const double& y, const double& z, const double& size, const int& n )
+{
+    const Kernel::Vector_3 o( x, y, z );
+    const Kernel::Vector_3 ux( size, 0, 0 ), uy( 0, size, 0 ), uz( 0, 0, size );
+
+    std::auto_ptr< PolyhedralSurface > shell( new PolyhedralSurface );
+    addFace( *shell, o, uy, ux, n );
+    addFace( *shell, o + uz, ux, uy, n );
+    addFace( *shell, o, ux, uz, n );
+    addFace( *shell, o + uy, uz, ux, n );
+    addFace( *shell, o, uz, uy, n );
+    addFace( *shell, o + ux, uy, uz, n );
+
+    return std::auto_ptr< Solid >( new Solid( shell.release() ) );
+}
+
+}
+
+//
+// dense meshes crossing each other, through GeometrySet (previous) and by corefinement of the meshes
+BOOST_AUTO_TEST_CASE( testSolidBooleanDenseMeshes )
+{
+    std::auto_ptr< Solid > a( subdividedCube( 0.0, 0.0, 0.0, 10.0, N_FACE_SUBDIVISIONS ) );
+    std::auto_ptr< Solid > b( subdividedCube( 3.25, 2.75, 4.125, 10.0, N_FACE_SUBDIVISIONS ) );
+
+    bench().s() << boost::format( "solids of %1% triangles" ) % a->exteriorShell().numPolygons() << std::endl ;
+
+    bench().start( "difference3D (previous)" );
+    std::auto_ptr< Geometry > expected( algorithm::difference3D( *a, *b, algorithm::NoValidityCheck() ) );
+    bench().stop();
+
+    bench().start( "solidBoolean difference" );
+    std::auto_ptr< Geometry > difference( algorithm::solidBoolean( *a, *b, algorithm::SOLID_DIFFERENCE, algorithm::NoValidityCheck() ) );
+    bench().stop();
+
+    BOOST_CHECK_CLOSE( CGAL::to_double( algorithm::volume( *difference ) ), CGAL::to_double( algorithm::volume( *expected ) ), 1e-9 );
+
+    bench().start( "intersection3D (previous)" );
+    expected = algorithm::intersection3D( *a, *b, algorithm::NoValidityCheck() );
+    bench().stop();
+
+    bench().start( "solidBoolean intersection" );
+    std::auto_ptr< Geometry > intersection( algorithm::solidBoolean( *a, *b, algorithm::SOLID_INTERSECTION, algorithm::NoValidityCheck() ) );
+    bench().stop();
+
+    BOOST_CHECK_CLOSE( CGAL::to_double( algorithm::volume( *intersection ) ), CGAL::to_double( algorithm::volume( *expected ) ), 1e-9 );
+
+    bench().start( "union3D (previous)" );
+    expected = algorithm::union3D( *a, *b, algorithm::NoValidityCheck() );
+    bench().stop();
+
+    bench().start( "solidBoolean union" );
+    std::auto_ptr< Geometry > u( algorithm::solidBoolean( *a, *b, algorithm::SOLID_UNION, algorithm::NoValidityCheck() ) );
+    bench().stop();
+
+    BOOST_CHECK_CLOSE( CGAL::to_double( algorithm::volume( *u ) ), CGAL::to_double( algorithm::volume( *expected ) ), 1e-9 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
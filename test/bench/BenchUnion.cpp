@@ -0,0 +1,101 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <fstream>
+
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/UnionAccumulator.h>
+#include <SFCGAL/algorithm/area.h>
+
+#include "../test_config.h"
+#include "Bench.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/format.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_BenchUnion )
+
+//
+// dissolves the polygons of test/data/countries.wkt
+BOOST_AUTO_TEST_CASE( testUnaryUnionCountries )
+{
+    std::string filename( SFCGAL_TEST_DIRECTORY );
+    filename += "/data/countries.wkt" ;
+
+    std::ifstream ifs( filename.c_str() );
+    BOOST_REQUIRE( ifs.good() ) ;
+
+    GeometryCollection countries ;
+    std::string wkt ;
+
+    while ( std::getline( ifs, wkt ) ) {
+        std::auto_ptr< Geometry > g( io::readWkt( wkt ) );
+
+        for ( size_t i = 0; i < g->numGeometries(); i++ ) {
+            countries.addGeometry( g->geometryN( i ) );
+        }
+    }
+
+    bench().s() << boost::format( "dissolving %1% polygons" ) % countries.numGeometries() << std::endl ;
+
+    // previous way : binary unions on an accumulator
+    bench().start( "union_ accumulator (previous)" ) ;
+    std::auto_ptr< Geometry > accumulator( new GeometryCollection() );
+
+    for ( size_t i = 0; i < countries.numGeometries(); i++ ) {
+        accumulator = algorithm::union_( *accumulator, countries.geometryN( i ) );
+    }
+
+    bench().stop();
+
+    bench().start( "unaryUnion" ) ;
+    std::auto_ptr< Geometry > dissolved( algorithm::unaryUnion( countries ) );
+    bench().stop();
+
+    // parallel execution requires CGAL with thread support
+    const size_t numThreads = ExecutionPolicy::parallelSupported() ? 0 : 1 ;
+    bench().start( boost::format( "unaryUnion (%1% thread(s))" ) % ExecutionPolicy( numThreads, 2 ).threadsFor( countries.numGeometries() ) ) ;
+    std::auto_ptr< Geometry > dissolvedInParallel( algorithm::unaryUnion( countries, numThreads ) );
+    bench().stop();
+
+    // streamed, recomposed once
+    bench().start( "UnionAccumulator" ) ;
+    algorithm::UnionAccumulator unionAccumulator ;
+
+    for ( size_t i = 0; i < countries.numGeometries(); i++ ) {
+        unionAccumulator.add( countries.geometryN( i ) );
+    }
+
+    std::auto_ptr< Geometry > streamed( unionAccumulator.finish() );
+    bench().stop();
+
+    BOOST_CHECK_CLOSE( algorithm::area( *dissolved ), algorithm::area( *accumulator ), 1e-6 );
+    BOOST_CHECK_CLOSE( algorithm::area( *dissolvedInParallel ), algorithm::area( *accumulator ), 1e-6 );
+    BOOST_CHECK_CLOSE( algorithm::area( *streamed ), algorithm::area( *accumulator ), 1e-6 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
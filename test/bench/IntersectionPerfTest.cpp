@@ -18,6 +18,8 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <fstream>
+#include <algorithm>
+#include <list>
 
 #include <SFCGAL/Point.h>
 #include <SFCGAL/LineString.h>
@@ -31,10 +33,19 @@
 #include <SFCGAL/MultiLineString.h>
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/ExecutionPolicy.h>
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/algorithm/intersection.h>
 #include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/batch.h>
+#include <SFCGAL/algorithm/spatialJoin.h>
 #include <SFCGAL/algorithm/convexHull.h>
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/detail/generator/disc.h>
+
+#include <CGAL/box_intersection_d.h>
+#include <CGAL/Boolean_set_operations_2.h>
 
 #include "../test_config.h"
 #include "Bench.h"
@@ -50,6 +61,84 @@ BOOST_AUTO_TEST_SUITE( SFCGAL_IntersectionPerfTest )
 
 #define N_POLYGONS 10000
 #define N_POINTS 50
+#define N_ZIGZAGS 1000
+#define N_ZIGZAG_SEGMENTS 100
+#define N_CANDIDATES 10000
+#define N_PROBE_QUADRANT_SEGMENTS 250
+#define N_JOIN_GRID 300
+#define N_SURFACE_GRID 60
+
+namespace {
+
+/**
+ * N_SURFACE_GRID x N_SURFACE_GRID grid of squares (two triangles each) with z = slope * x + offset
+ */
+std::auto_ptr< TriangulatedSurface > makeSlopedSurface( const double& slope, const double& offset )
+{
+    std::auto_ptr< TriangulatedSurface > surface( new TriangulatedSurface );
+
+    for ( int i = 0; i < N_SURFACE_GRID; i++ ) {
+        for ( int j = 0; j < N_SURFACE_GRID; j++ ) {
+            const Point a( i, j, slope * i + offset );
+            const Point b( i + 1, j, slope * ( i + 1 ) + offset );
+            const Point c( i + 1, j + 1, slope * ( i + 1 ) + offset );
+            const Point d( i, j + 1, slope * i + offset );
+            surface->addTriangle( Triangle( a, b, c ) );
+            surface->addTriangle( Triangle( a, c, d ) );
+        }
+    }
+
+    return surface ;
+}
+
+/**
+ * zigzag of N_ZIGZAG_SEGMENTS segments along x (or along y if transposed), crossing the other ones
+ */
+std::auto_ptr< LineString > makeZigzag( const double& offset, const bool& transposed )
+{
+    std::auto_ptr< LineString > zigzag( new LineString );
+
+    for ( int i = 0; i <= N_ZIGZAG_SEGMENTS; i++ ) {
+        const double u = i ;
+        const double v = offset + ( i % 2 );
+        zigzag->addPoint( transposed ? Point( v, u ) : Point( u, v ) );
+    }
+
+    return zigzag ;
+}
+
+struct found_an_intersection {};
+
+/**
+ * previous intersects() : CGAL::box_intersection_d interrupted by an exception
+ */
+struct throwing_intersects_cb {
+    void operator()( const detail::PrimitiveBox<2>::Type& a, const detail::PrimitiveBox<2>::Type& b ) {
+        if ( algorithm::intersects( *a.handle(), *b.handle() ) ) {
+            throw found_an_intersection();
+        }
+    }
+};
+
+bool intersectsWithException( const Geometry& ga, const Geometry& gb )
+{
+    detail::GeometrySet<2> gsa( ga ), gsb( gb );
+    detail::HandleCollection<2>::Type ahandles, bhandles;
+    detail::BoxCollection<2>::Type aboxes, bboxes;
+    gsa.computeBoundingBoxes( ahandles, aboxes );
+    gsb.computeBoundingBoxes( bhandles, bboxes );
+
+    try {
+        CGAL::box_intersection_d( aboxes.begin(), aboxes.end(), bboxes.begin(), bboxes.end(), throwing_intersects_cb() );
+    }
+    catch ( found_an_intersection& ) {
+        return true;
+    }
+
+    return false;
+}
+
+}
 
 //
 // Test limit case
@@ -73,13 +162,184 @@ BOOST_AUTO_TEST_CASE( testIntersectionPerf )
         polygons.push_back( g.release() );
     }
 
+    std::vector< CGAL::Polygon_with_holes_2< Kernel > > cgalPolygons;
+
+    for ( size_t i = 0; i < N_POLYGONS; ++i ) {
+        cgalPolygons.push_back( polygons[i]->as< Polygon >().toPolygon_with_holes_2() );
+    }
+
+    size_t count = 0 ;
+    bench().start( "intersects convex hull (CGAL::do_intersect)" );
+
+    for ( size_t i = 0; i < N_POLYGONS / 2; ++i ) {
+        count += CGAL::do_intersect( cgalPolygons[2*i], cgalPolygons[2*i+1] ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+
+    size_t countConvex = 0 ;
     bench().start( "intersects convex hull" );
 
     for ( size_t i = 0; i < N_POLYGONS / 2; ++i ) {
-        algorithm::intersects( *polygons[2*i], *polygons[2*i+1] );
+        countConvex += algorithm::intersects( *polygons[2*i], *polygons[2*i+1] ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+    BOOST_CHECK_EQUAL( countConvex, count );
+
+    bench().start( "intersection convex hull (CGAL::intersection)" );
+
+    for ( size_t i = 0; i < N_POLYGONS / 2; ++i ) {
+        std::list< CGAL::Polygon_with_holes_2< Kernel > > output ;
+        CGAL::intersection( cgalPolygons[2*i], cgalPolygons[2*i+1], std::back_inserter( output ) );
+    }
+
+    bench().stop();
+
+    bench().start( "intersection convex hull" );
+
+    for ( size_t i = 0; i < N_POLYGONS / 2; ++i ) {
+        algorithm::intersection( *polygons[2*i], *polygons[2*i+1] );
+    }
+
+    bench().stop();
+
+    for ( size_t i = 0; i < N_POLYGONS; ++i ) {
+        delete polygons[i];
+    }
+}
+
+//
+// Hit-heavy case : every test returns true
+BOOST_AUTO_TEST_CASE( testIntersectsHitHeavyPerf )
+{
+    std::vector< Geometry* > horizontals, verticals;
+
+    for ( size_t i = 0; i < N_ZIGZAGS; ++i ) {
+        horizontals.push_back( makeZigzag( ( i % 50 ) * 2.0, false ).release() );
+        verticals.push_back( makeZigzag( ( i % 50 ) * 2.0, true ).release() );
+    }
+
+    size_t count = 0 ;
+    bench().start( "intersects hit-heavy (exception, previous)" );
+
+    for ( size_t i = 0; i < N_ZIGZAGS; ++i ) {
+        count += intersectsWithException( *horizontals[i], *verticals[i] ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+    BOOST_CHECK_EQUAL( count, static_cast< size_t >( N_ZIGZAGS ) );
+
+    count = 0 ;
+    bench().start( "intersects hit-heavy" );
+
+    for ( size_t i = 0; i < N_ZIGZAGS; ++i ) {
+        count += algorithm::intersects( *horizontals[i], *verticals[i] ) ? 1 : 0 ;
+    }
+
+    bench().stop();
+    BOOST_CHECK_EQUAL( count, static_cast< size_t >( N_ZIGZAGS ) );
+
+    for ( size_t i = 0; i < N_ZIGZAGS; ++i ) {
+        delete horizontals[i];
+        delete verticals[i];
+    }
+}
+
+//
+// One probe against many candidates : point in zone like workload
+BOOST_AUTO_TEST_CASE( testIntersectsManyPerf )
+{
+    // probe : a disc centered in the grid of candidates
+    std::auto_ptr< Polygon > probe( generator::disc( Point( 50.0, 50.0 ), 30.0, N_PROBE_QUADRANT_SEGMENTS ) );
+
+    // candidates : small squares on a 100x100 grid
+    std::vector< Geometry* > squares;
+    std::vector< const Geometry* > candidates;
+
+    for ( size_t i = 0; i < N_CANDIDATES; ++i ) {
+        const double x = ( i % 100 ) + 0.25 ;
+        const double y = ( i / 100 ) + 0.25 ;
+        squares.push_back( Envelope( x, x + 0.5, y, y + 0.5 ).toPolygon().release() );
+        candidates.push_back( squares.back() );
+    }
+
+    size_t count = 0 ;
+    bench().start( "intersects one to many (loop)" );
+
+    for ( size_t i = 0; i < N_CANDIDATES; ++i ) {
+        count += algorithm::intersects( *probe, *candidates[i] ) ? 1 : 0 ;
     }
 
     bench().stop();
+
+    std::vector< bool > results ;
+    bench().start( "intersectsMany" );
+    algorithm::intersectsMany( *probe, candidates, results );
+    bench().stop();
+    BOOST_CHECK_EQUAL( static_cast< size_t >( std::count( results.begin(), results.end(), true ) ), count );
+
+    // parallel execution requires CGAL with thread support
+    if ( ExecutionPolicy::parallelSupported() ) {
+        bench().start( "intersectsMany (one thread per core)" );
+        algorithm::intersectsMany( *probe, candidates, results, 0 );
+        bench().stop();
+        BOOST_CHECK_EQUAL( static_cast< size_t >( std::count( results.begin(), results.end(), true ) ), count );
+    }
+
+    for ( size_t i = 0; i < N_CANDIDATES; ++i ) {
+        delete squares[i];
+    }
+}
+
+//
+// Many to many : two shifted grids of N_JOIN_GRID x N_JOIN_GRID squares
+BOOST_AUTO_TEST_CASE( testSpatialJoinPerf )
+{
+    GeometryCollection a, b ;
+
+    for ( size_t i = 0; i < N_JOIN_GRID; ++i ) {
+        for ( size_t j = 0; j < N_JOIN_GRID; ++j ) {
+            a.addGeometry( Envelope( i, i + 0.75, j, j + 0.75 ).toPolygon().release() );
+            b.addGeometry( Envelope( i + 0.5, i + 0.9, j + 0.5, j + 0.9 ).toPolygon().release() );
+        }
+    }
+
+    std::vector< std::pair< size_t, size_t > > pairs ;
+    bench().start( boost::format( "spatialJoin %1% x %1% squares" ) % a.numGeometries() );
+    algorithm::spatialJoin( a, b, algorithm::JOIN_INTERSECTS, pairs );
+    bench().stop();
+
+    // each square of a only intersects the square of b with the same (i,j)
+    BOOST_CHECK_EQUAL( pairs.size(), a.numGeometries() );
+}
+
+//
+// Many triangle pairs : two crossing surfaces, intersected sequentially then by one thread per core
+BOOST_AUTO_TEST_CASE( testIntersection3DParallelPerf )
+{
+    std::auto_ptr< TriangulatedSurface > a( makeSlopedSurface( 0.0, 0.5 ) );
+    std::auto_ptr< TriangulatedSurface > b( makeSlopedSurface( 0.125, -1.0 ) );
+
+    bench().start( boost::format( "intersection3D %1% x %1% triangles (sequential)" ) % a->numTriangles() );
+    std::auto_ptr< Geometry > expected( algorithm::intersection3D( *a, *b ) );
+    bench().stop();
+
+    // parallel execution requires CGAL with thread support
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        return ;
+    }
+
+    std::auto_ptr< Geometry > result ;
+    {
+        ExecutionPolicy::Scope scope( ExecutionPolicy::parallel() );
+        bench().start( boost::format( "intersection3D %1% x %1% triangles (one thread per core)" ) % a->numTriangles() );
+        result = algorithm::intersection3D( *a, *b );
+        bench().stop();
+    }
+
+    // the parallel results are merged in the sequential order
+    BOOST_CHECK_EQUAL( result->asText(), expected->asText() );
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -145,6 +145,33 @@ BOOST_AUTO_TEST_CASE( testRoundOneDecimal )
     BOOST_CHECK_EQUAL( oss.str(), "1/2 8/5" ); //16/10
 }
 
+/// bool compact( const bool& roundToDouble = false ) ;
+BOOST_AUTO_TEST_CASE( testCompactExactDoubles )
+{
+    // exact construction whose exact value is a double
+    Coordinate g( Kernel::Point_2( 1, 2 ) + Kernel::Vector_2( 0.5, 0.25 ) );
+    BOOST_CHECK( g.compact() );
+    BOOST_CHECK_EQUAL( g.x(), 1.5 );
+    BOOST_CHECK_EQUAL( g.y(), 2.25 );
+}
+BOOST_AUTO_TEST_CASE( testCompactKeepsExact )
+{
+    Coordinate g( Kernel::FT( 1 ) / 3, Kernel::FT( 2 ), Kernel::FT( 3 ) );
+    BOOST_CHECK( ! g.compact() );
+    BOOST_CHECK( g.is3D() );
+    BOOST_CHECK_EQUAL( g.x(), Kernel::FT( 1 ) / 3 );
+
+    BOOST_CHECK( g.compact( true ) );
+    BOOST_CHECK_EQUAL( g.x(), 1.0 / 3.0 );
+    BOOST_CHECK_EQUAL( g.z(), 3 );
+}
+BOOST_AUTO_TEST_CASE( testCompactEmpty )
+{
+    Coordinate g ;
+    BOOST_CHECK( ! g.compact( true ) );
+    BOOST_CHECK( g.isEmpty() );
+}
+
 
 
 ///--- comparators
@@ -176,12 +203,38 @@ BOOST_AUTO_TEST_CASE( testLessXY_XYZ )
     BOOST_CHECK_THROW( ( Coordinate( 0,0 ) < Coordinate( 0,0,0 ) ), Exception ) ;
 }
 
+BOOST_AUTO_TEST_CASE( testLessDoubleExact )
+{
+    BOOST_CHECK(   ( Coordinate( 0.0,0.0 ) < Coordinate( Kernel::FT( 1 ),Kernel::FT( 0 ) ) ) ) ;
+    BOOST_CHECK(   ( Coordinate( Kernel::FT( 1 ),Kernel::FT( 0 ) ) < Coordinate( 1.0,0.5 ) ) ) ;
+    BOOST_CHECK( ! ( Coordinate( 1.0,0.0 ) < Coordinate( Kernel::FT( 1 ),Kernel::FT( 0 ) ) ) ) ;
+}
+
 /// bool operator == ( const Coordinate & other ) const ;
+BOOST_AUTO_TEST_CASE( testEqualDoubleExact )
+{
+    BOOST_CHECK( Coordinate( 0.5,1.0 ) == Coordinate( Kernel::FT( 1 ) / 2,Kernel::FT( 1 ) ) ) ;
+    BOOST_CHECK( Coordinate( 0.5,1.0,2.0 ) == Coordinate( Kernel::FT( 1 ) / 2,Kernel::FT( 1 ),Kernel::FT( 2 ) ) ) ;
+    BOOST_CHECK( Coordinate( 0.5,1.0 ) == Coordinate( 0.5,1.0 ) ) ;
+    BOOST_CHECK( Coordinate( 0.5,1.0 ) != Coordinate( 0.5,1.5 ) ) ;
+    BOOST_CHECK( Coordinate( 0.5,1.0 ) == Coordinate( 0.5,1.0,0.0 ) ) ;
+}
+
 /// bool operator != ( const Coordinate & other ) const ;
 /// inline Kernel::Vector_2 toVector_2() const
 /// inline Kernel::Vector_3 toVector_3() const
 /// Kernel::Point_2 toPoint_2() const;
+BOOST_AUTO_TEST_CASE( testToPoint2Double )
+{
+    BOOST_CHECK_EQUAL( Coordinate( 3.0,4.0 ).toPoint_2(), Kernel::Point_2( 3,4 ) );
+    BOOST_CHECK_EQUAL( Coordinate( 3.0,4.0,5.0 ).toPoint_2(), Kernel::Point_2( 3,4 ) );
+}
 /// Kernel::Point_3 toPoint_3() const;
+BOOST_AUTO_TEST_CASE( testToPoint3Double )
+{
+    BOOST_CHECK_EQUAL( Coordinate( 3.0,4.0 ).toPoint_3(), Kernel::Point_3( 3,4,0 ) );
+    BOOST_CHECK_EQUAL( Coordinate( 3.0,4.0,5.0 ).toPoint_3(), Kernel::Point_3( 3,4,5 ) );
+}
 
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/difference.h>
+#include <SFCGAL/algorithm/translate.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_ExecutionPolicyTest )
+
+namespace {
+
+// pairs of geometries with many candidate pairs of primitives
+const char* geometriesWkt[][2] = {
+    {
+        "MULTILINESTRING((0 0,10 1),(0 1,10 2),(0 2,10 3),(0 3,10 4),(0 4,10 5),(0 5,10 6))",
+        "MULTILINESTRING((1 0,0 10),(2 0,1 10),(3 0,2 10),(4 0,3 10),(5 0,4 10),(6 0,5 10))"
+    },
+    {
+        "MULTIPOLYGON(((0 0,2 0,2 2,0 2,0 0)),((3 0,5 0,5 2,3 2,3 0)),((0 3,2 3,2 5,0 5,0 3)),((3 3,5 3,5 5,3 5,3 3)))",
+        "MULTIPOLYGON(((1 1,4 1,4 4,1 4,1 1)),((-1 -1,6 -1,6 0.5,-1 0.5,-1 -1)))"
+    },
+    {
+        "MULTIPOINT((0 0),(1 1),(2 2),(3 3),(4 4),(5 5))",
+        "MULTIPOLYGON(((0.5 0.5,3.5 0.5,3.5 3.5,0.5 3.5,0.5 0.5)),((-1 -1,0.5 -1,0.5 0.5,-1 0.5,-1 -1)))"
+    }
+};
+
+// 3D pairs, with volumes (computed in the calling thread) and triangles
+const char* geometries3DWkt[][2] = {
+    {
+        "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 1,1 0 1,1 1 1,0 1 1,0 0 1)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 0,0 1 0,0 1 1,1 1 1,1 1 0)),((1 0 0,1 1 0,1 1 1,1 0 1,1 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0))))",
+        "MULTILINESTRING((-1 0.5 0.5,2 0.5 0.5),(0.5 -1 0.5,0.5 2 0.5),(0.5 0.5 -1,0.5 0.5 2))"
+    },
+    {
+        "TIN(((0 0 0,1 0 0,0 1 0,0 0 0)),((1 0 0,1 1 0,0 1 0,1 0 0)),((1 0 0,2 0 0,1 1 0,1 0 0)),((2 0 0,2 1 0,1 1 0,2 0 0)))",
+        "TIN(((0 0.5 -1,2 0.5 -1,2 0.5 1,0 0.5 -1)),((0 0.5 -1,2 0.5 1,0 0.5 1,0 0.5 -1)))"
+    }
+};
+
+}
+
+BOOST_AUTO_TEST_CASE( testDefaultIsSequential )
+{
+    BOOST_CHECK_EQUAL( ExecutionPolicy::global().numThreads(), 1U );
+    BOOST_CHECK_EQUAL( ExecutionPolicy::current().numThreads(), 1U );
+    BOOST_CHECK_EQUAL( ExecutionPolicy::current().threadsFor( 1000 ), 1U );
+}
+
+BOOST_AUTO_TEST_CASE( testScope )
+{
+    {
+        ExecutionPolicy::Scope scope( ExecutionPolicy( 1, 10 ) );
+        BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 10U );
+        {
+            ExecutionPolicy::Scope nested( ExecutionPolicy::sequential() );
+            BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 64U );
+        }
+        BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 10U );
+    }
+    BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 64U );
+}
+
+BOOST_AUTO_TEST_CASE( testGlobal )
+{
+    ExecutionPolicy::setGlobal( ExecutionPolicy( 1, 3 ) );
+    BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 3U );
+    {
+        ExecutionPolicy::Scope scope( ExecutionPolicy::sequential() );
+        BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 64U );
+    }
+    ExecutionPolicy::setGlobal( ExecutionPolicy::sequential() );
+    BOOST_CHECK_EQUAL( ExecutionPolicy::current().minPairs(), 64U );
+}
+
+//
+// without thread support, only the sequential policy can be built
+BOOST_AUTO_TEST_CASE( testParallelSupported )
+{
+    if ( ExecutionPolicy::parallelSupported() ) {
+        BOOST_CHECK_EQUAL( ExecutionPolicy::parallel( 4 ).numThreads(), 4U );
+    }
+    else {
+        BOOST_CHECK_THROW( ExecutionPolicy( 4 ), NotImplementedException );
+        BOOST_CHECK_THROW( ExecutionPolicy::parallel(), NotImplementedException );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testThreadsFor )
+{
+    BOOST_CHECK_EQUAL( ExecutionPolicy( 1, 0 ).threadsFor( 1000 ), 1U );
+
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        return ;
+    }
+
+    const ExecutionPolicy policy( 4, 10 );
+    BOOST_CHECK_EQUAL( policy.threadsFor( 9 ), 1U );
+    BOOST_CHECK_EQUAL( policy.threadsFor( 10 ), 4U );
+    BOOST_CHECK_EQUAL( ExecutionPolicy( 4, 0 ).threadsFor( 3 ), 3U );
+    BOOST_CHECK_EQUAL( ExecutionPolicy( 4, 0 ).threadsFor( 1 ), 1U );
+    BOOST_CHECK( ExecutionPolicy::parallel().threadsFor( 1000 ) >= 1U );
+}
+
+//
+// the parallel results are merged in the order of the sequential computation
+BOOST_AUTO_TEST_CASE( testParallelMatchesSequential )
+{
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        return ;
+    }
+
+    const ExecutionPolicy parallel( 4, 0 );
+
+    for ( size_t i = 0; i < sizeof( geometriesWkt ) / sizeof( geometriesWkt[0] ); i++ ) {
+        std::auto_ptr< Geometry > a( io::readWkt( geometriesWkt[i][0] ) );
+        std::auto_ptr< Geometry > b( io::readWkt( geometriesWkt[i][1] ) );
+
+        std::auto_ptr< Geometry > intersection( algorithm::intersection( *a, *b ) );
+        std::auto_ptr< Geometry > difference( algorithm::difference( *a, *b ) );
+
+        ExecutionPolicy::Scope scope( parallel );
+        BOOST_CHECK_EQUAL( algorithm::intersection( *a, *b )->asText(), intersection->asText() );
+        BOOST_CHECK_EQUAL( algorithm::difference( *a, *b )->asText(), difference->asText() );
+    }
+
+    for ( size_t i = 0; i < sizeof( geometries3DWkt ) / sizeof( geometries3DWkt[0] ); i++ ) {
+        std::auto_ptr< Geometry > a( io::readWkt( geometries3DWkt[i][0] ) );
+        std::auto_ptr< Geometry > b( io::readWkt( geometries3DWkt[i][1] ) );
+
+        std::auto_ptr< Geometry > intersection( algorithm::intersection3D( *a, *b ) );
+        std::auto_ptr< Geometry > difference( algorithm::difference3D( *a, *b ) );
+
+        ExecutionPolicy::Scope scope( parallel );
+        BOOST_CHECK_EQUAL( algorithm::intersection3D( *a, *b )->asText(), intersection->asText() );
+        BOOST_CHECK_EQUAL( algorithm::difference3D( *a, *b )->asText(), difference->asText() );
+    }
+}
+
+//
+// the translated geometries share the lazy exact numbers of the translation vector : each thread
+// works on its own copies
+BOOST_AUTO_TEST_CASE( testParallelExactCoordinates )
+{
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        return ;
+    }
+
+    const ExecutionPolicy parallel( 4, 0 );
+    const Kernel::Vector_2 v( Kernel::FT( 1 ) / 3, Kernel::FT( 1 ) / 7 );
+
+    for ( size_t i = 0; i < sizeof( geometriesWkt ) / sizeof( geometriesWkt[0] ); i++ ) {
+        std::auto_ptr< Geometry > a( io::readWkt( geometriesWkt[i][0] ) );
+        std::auto_ptr< Geometry > b( io::readWkt( geometriesWkt[i][1] ) );
+        algorithm::translate( *a, v );
+        algorithm::translate( *b, v );
+
+        std::auto_ptr< Geometry > intersection( algorithm::intersection( *a, *b ) );
+        std::auto_ptr< Geometry > difference( algorithm::difference( *a, *b ) );
+
+        ExecutionPolicy::Scope scope( parallel );
+        BOOST_CHECK_EQUAL( algorithm::intersection( *a, *b )->asText( 10 ), intersection->asText( 10 ) );
+        BOOST_CHECK_EQUAL( algorithm::difference( *a, *b )->asText( 10 ), difference->asText( 10 ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
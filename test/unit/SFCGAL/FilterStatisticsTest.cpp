@@ -0,0 +1,120 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/FilterStatistics.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_FilterStatisticsTest )
+
+BOOST_AUTO_TEST_CASE( testFamilyName )
+{
+    BOOST_CHECK_EQUAL( FilterStatistics::familyName( FilterStatistics::INTERSECTS ), "intersects" );
+    BOOST_CHECK_EQUAL( FilterStatistics::familyName( FilterStatistics::COVERS ), "covers" );
+    BOOST_CHECK_EQUAL( FilterStatistics::familyName( FilterStatistics::IS_VALID ), "isValid" );
+    BOOST_CHECK_EQUAL( FilterStatistics::familyName( FilterStatistics::TRIANGULATION ), "triangulation" );
+    BOOST_CHECK_THROW( FilterStatistics::familyName( FilterStatistics::NUM_FAMILIES ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testReset )
+{
+    std::auto_ptr< Geometry > ga( io::readWkt( "LINESTRING(0.0 0.0,0.3 0.3)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "POINT(0.1 0.1)" ) );
+    algorithm::intersects( *ga, *gb );
+
+    FilterStatistics::reset();
+
+    for ( int i = 0; i < FilterStatistics::NUM_FAMILIES; i++ ) {
+        FilterStatistics::Counters counters = FilterStatistics::counters( FilterStatistics::Family( i ) );
+        BOOST_CHECK_EQUAL( counters.calls, 0U );
+        BOOST_CHECK_EQUAL( counters.exactFallbacks, 0U );
+        BOOST_CHECK_EQUAL( counters.exactAllocations, 0U );
+    }
+}
+
+#ifdef SFCGAL_WITH_FILTER_STATISTICS
+
+BOOST_AUTO_TEST_CASE( testCounters )
+{
+    BOOST_CHECK( FilterStatistics::enabled() );
+    FilterStatistics::reset();
+
+    // degenerate : the point is on the segment, the interval filter can't decide the orientation
+    std::auto_ptr< Geometry > ga( io::readWkt( "LINESTRING(0.0 0.0,0.3 0.3)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "POINT(0.1 0.1)" ) );
+    BOOST_CHECK( algorithm::intersects( *ga, *gb ) );
+    BOOST_CHECK( algorithm::intersects( *ga, *gb ) );
+    algorithm::covers( *ga, *gb );
+
+    FilterStatistics::Counters intersects = FilterStatistics::counters( FilterStatistics::INTERSECTS );
+    FilterStatistics::Counters covers     = FilterStatistics::counters( FilterStatistics::COVERS );
+
+    BOOST_CHECK_EQUAL( intersects.calls, 2U );
+    BOOST_CHECK_EQUAL( covers.calls, 1U );
+
+    BOOST_CHECK_GT( intersects.exactFallbacks, 0U );
+    BOOST_CHECK( intersects.exactFallbacks <= intersects.calls );
+    BOOST_CHECK( intersects.exactFallbacks <= intersects.exactAllocations );
+    BOOST_CHECK( covers.exactFallbacks <= covers.calls );
+}
+
+BOOST_AUTO_TEST_CASE( testNestedScopes )
+{
+    FilterStatistics::reset();
+    {
+        FilterStatistics::Scope scope( FilterStatistics::TRIANGULATION );
+        FilterStatistics::Scope nested( FilterStatistics::TRIANGULATION );
+    }
+
+    BOOST_CHECK_EQUAL( FilterStatistics::counters( FilterStatistics::TRIANGULATION ).calls, 1U );
+}
+
+#else
+
+// the counters stay to 0 when the statistics are compiled out
+BOOST_AUTO_TEST_CASE( testDisabled )
+{
+    BOOST_CHECK( ! FilterStatistics::enabled() );
+    FilterStatistics::reset();
+
+    std::auto_ptr< Geometry > ga( io::readWkt( "LINESTRING(0.0 0.0,0.3 0.3)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "POINT(0.1 0.1)" ) );
+    algorithm::intersects( *ga, *gb );
+    algorithm::covers( *ga, *gb );
+    {
+        FilterStatistics::Scope scope( FilterStatistics::TRIANGULATION );
+    }
+
+    for ( int i = 0; i < FilterStatistics::NUM_FAMILIES; i++ ) {
+        FilterStatistics::Counters counters = FilterStatistics::counters( FilterStatistics::Family( i ) );
+        BOOST_CHECK_EQUAL( counters.calls, 0U );
+        BOOST_CHECK_EQUAL( counters.exactFallbacks, 0U );
+    }
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
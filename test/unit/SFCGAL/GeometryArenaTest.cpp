@@ -0,0 +1,119 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/GeometryArena.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/io/wkt.h>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include <new>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_GeometryArenaTest )
+
+BOOST_AUTO_TEST_CASE( testNoArena )
+{
+    BOOST_CHECK( GeometryArena::current() == NULL );
+    std::auto_ptr< Geometry > g( new Point( 1.0, 2.0 ) );
+    BOOST_CHECK_EQUAL( g->asText( 1 ), "POINT(1.0 2.0)" );
+}
+
+BOOST_AUTO_TEST_CASE( testScope )
+{
+    GeometryArena arena ;
+    {
+        GeometryArena::Scope scope( arena );
+        BOOST_CHECK( GeometryArena::current() == &arena );
+        {
+            GeometryArena nested ;
+            GeometryArena::Scope nestedScope( nested );
+            BOOST_CHECK( GeometryArena::current() == &nested );
+        }
+        BOOST_CHECK( GeometryArena::current() == &arena );
+    }
+    BOOST_CHECK( GeometryArena::current() == NULL );
+}
+
+BOOST_AUTO_TEST_CASE( testAllocate )
+{
+    GeometryArena arena( 1024 );
+    void* a = arena.allocate( 10 );
+    void* b = arena.allocate( 10 );
+    BOOST_CHECK( a != b );
+    BOOST_CHECK_EQUAL( arena.reservedSize(), 1024U );
+
+    // large allocation
+    arena.allocate( 2048 );
+    BOOST_CHECK_EQUAL( arena.reservedSize(), 1024U + 2048U );
+}
+
+BOOST_AUTO_TEST_CASE( testReadWktInArena )
+{
+    GeometryArena arena ;
+    {
+        GeometryArena::Scope scope( arena );
+        std::auto_ptr< Geometry > g( io::readWkt( "MULTIPOLYGON(((0 0,1 0,1 1,0 1,0 0)),((2 0,3 0,3 1,2 1,2 0)))" ) );
+        BOOST_CHECK_EQUAL( g->numGeometries(), 2U );
+
+        if ( ! GeometryArena::enabled() ) {
+            BOOST_CHECK_EQUAL( arena.allocatedSize(), 0U );
+            return ;
+        }
+
+        BOOST_CHECK( arena.allocatedSize() >= 2 * sizeof( Polygon ) + sizeof( MultiPolygon ) );
+
+        // clones are allocated in the arena too
+        const size_t allocatedSize = arena.allocatedSize() ;
+        std::auto_ptr< Geometry > clone( g->clone() );
+        BOOST_CHECK( arena.allocatedSize() > allocatedSize );
+        BOOST_CHECK( *clone == *g );
+    }
+
+    // not in the arena any more
+    const size_t allocatedSize = arena.allocatedSize() ;
+    std::auto_ptr< Geometry > p( new Point( 1.0, 2.0 ) );
+    BOOST_CHECK_EQUAL( arena.allocatedSize(), allocatedSize );
+}
+
+BOOST_AUTO_TEST_CASE( testPlacementAndNothrowNew )
+{
+    GeometryArena arena ;
+    GeometryArena::Scope scope( arena );
+
+    // placement new constructs in the given memory, not in the arena
+    boost::aligned_storage< sizeof( Point ), boost::alignment_of< Point >::value >::type storage ;
+    Point* p = new( &storage ) Point( 1.0, 2.0 );
+    BOOST_CHECK_EQUAL( static_cast< void* >( p ), static_cast< void* >( &storage ) );
+    BOOST_CHECK_EQUAL( p->asText( 1 ), "POINT(1.0 2.0)" );
+    p->~Point();
+
+    std::auto_ptr< Geometry > q( new( std::nothrow ) Point( 3.0, 4.0 ) );
+    BOOST_REQUIRE( q.get() != NULL );
+    BOOST_CHECK_EQUAL( q->asText( 1 ), "POINT(3.0 4.0)" );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
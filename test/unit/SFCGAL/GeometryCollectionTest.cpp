@@ -71,6 +71,118 @@ BOOST_AUTO_TEST_CASE( testAccessors )
     BOOST_CHECK_EQUAL( g.geometryN( 2 ).asText( 0 ), "TRIANGLE((0 0,1 0,1 1,0 0))"  ) ;
 }
 
+//void                      releaseGeometries( boost::ptr_vector< Geometry >& geometries ) ;
+BOOST_AUTO_TEST_CASE( testReleaseGeometries )
+{
+    GeometryCollection g ;
+    Point* point = new Point( 2.0,3.0 ) ;
+    LineString* lineString = new LineString( Point( 0.0,0.0 ),Point( 1.0,1.0 ) ) ;
+    g.addGeometry( point ) ;
+    g.addGeometry( lineString ) ;
+
+    boost::ptr_vector< Geometry > geometries ;
+    g.releaseGeometries( geometries );
+    BOOST_CHECK( g.isEmpty() );
+    BOOST_REQUIRE_EQUAL( geometries.size(), 2U );
+    BOOST_CHECK_EQUAL( &geometries[0], point );
+    BOOST_CHECK_EQUAL( &geometries[1], lineString );
+}
+
+//GeometryCollection( GeometryCollection const& other ) ;
+BOOST_AUTO_TEST_CASE( testCopyOnWrite )
+{
+    GeometryCollection g ;
+    g.addGeometry( new Point( 2.0,3.0 ) ) ;
+    g.addGeometry( new LineString( Point( 0.0,0.0 ),Point( 1.0,1.0 ) ) ) ;
+
+    const GeometryCollection copy( g );
+    const GeometryCollection& constG = g ;
+    BOOST_REQUIRE_EQUAL( copy.numGeometries(), 2U );
+
+    // geometries are shared by the copy
+    BOOST_CHECK_EQUAL( &copy.geometryN( 0 ), &constG.geometryN( 0 ) );
+    BOOST_CHECK_EQUAL( &copy.geometryN( 1 ), &constG.geometryN( 1 ) );
+
+    // ...until they are modified
+    g.geometryN( 1 ).as< LineString >().addPoint( Point( 2.0,2.0 ) );
+    BOOST_CHECK( &copy.geometryN( 1 ) != &constG.geometryN( 1 ) );
+    BOOST_CHECK_EQUAL( &copy.geometryN( 0 ), &constG.geometryN( 0 ) );
+    BOOST_CHECK_EQUAL( g.geometryN( 1 ).asText( 0 ), "LINESTRING(0 0,1 1,2 2)" );
+    BOOST_CHECK_EQUAL( copy.geometryN( 1 ).asText( 0 ), "LINESTRING(0 0,1 1)" );
+
+    // a geometry that is no longer shared is not copied
+    const Geometry* lineString = &constG.geometryN( 1 ) ;
+    BOOST_CHECK_EQUAL( &g.geometryN( 1 ), lineString );
+
+    // clones are shallow too
+    std::auto_ptr< GeometryCollection > cloned( copy.clone() );
+    BOOST_CHECK_EQUAL( &cloned->geometryN( 0 ), &copy.geometryN( 0 ) );
+}
+
+//void                      releaseGeometries( boost::ptr_vector< Geometry >& geometries ) ;
+BOOST_AUTO_TEST_CASE( testReleaseSharedGeometries )
+{
+    GeometryCollection g ;
+    g.addGeometry( new Point( 2.0,3.0 ) ) ;
+    const GeometryCollection copy( g );
+    LineString* lineString = new LineString( Point( 0.0,0.0 ),Point( 1.0,1.0 ) ) ;
+    g.addGeometry( lineString ) ;
+
+    boost::ptr_vector< Geometry > geometries ;
+    g.releaseGeometries( geometries );
+    BOOST_CHECK( g.isEmpty() );
+    BOOST_REQUIRE_EQUAL( geometries.size(), 2U );
+    // the shared geometry is cloned, the other one is moved, the order is kept
+    BOOST_CHECK( &geometries[0] != &copy.geometryN( 0 ) );
+    BOOST_CHECK_EQUAL( geometries[0].asText( 0 ), "POINT(2 3)" );
+    BOOST_CHECK_EQUAL( &geometries[1], lineString );
+    BOOST_CHECK_EQUAL( copy.geometryN( 0 ).asText( 0 ), "POINT(2 3)" );
+}
+
+//void                      removeGeometryN( const size_t& n ) ;
+BOOST_AUTO_TEST_CASE( testRemoveGeometryN )
+{
+    GeometryCollection g ;
+    g.addGeometry( new Point( 2.0,3.0 ) ) ;
+    g.addGeometry( new LineString( Point( 0.0,0.0 ),Point( 1.0,1.0 ) ) ) ;
+    const GeometryCollection copy( g );
+
+    g.removeGeometryN( 0 );
+    BOOST_REQUIRE_EQUAL( g.numGeometries(), 1U );
+    BOOST_CHECK_EQUAL( g.geometryN( 0 ).asText( 0 ), "LINESTRING(0 0,1 1)" );
+    // the copy is not modified
+    BOOST_CHECK_EQUAL( copy.numGeometries(), 2U );
+}
+
+#ifndef BOOST_NO_CXX11_SMART_PTR
+//void                      addGeometry( std::unique_ptr< Geometry > geometry ) ;
+BOOST_AUTO_TEST_CASE( testAddGeometryUniquePtr )
+{
+    GeometryCollection g ;
+    std::unique_ptr< Point > point( new Point( 2.0,3.0 ) );
+    const Point* p = point.get() ;
+    g.addGeometry( std::move( point ) );
+    BOOST_CHECK( point.get() == NULL );
+    BOOST_REQUIRE_EQUAL( g.numGeometries(), 1U );
+    BOOST_CHECK_EQUAL( &g.geometryN( 0 ), p );
+}
+#endif
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+//GeometryCollection( GeometryCollection&& other ) ;
+BOOST_AUTO_TEST_CASE( testMoveConstructor )
+{
+    GeometryCollection g ;
+    g.addGeometry( new Point( 2.0,3.0 ) ) ;
+    const Geometry* p = &g.geometryN( 0 ) ;
+
+    GeometryCollection moved( std::move( g ) );
+    BOOST_CHECK( g.isEmpty() );
+    BOOST_REQUIRE_EQUAL( moved.numGeometries(), 1U );
+    BOOST_CHECK_EQUAL( &moved.geometryN( 0 ), p );
+}
+#endif
+
 
 //-- iterators
 
@@ -91,6 +203,13 @@ BOOST_AUTO_TEST_CASE( testIterators )
     BOOST_CHECK_EQUAL( it->asText( 0 ), "POINT(1 1)" );
     ++it ;
     BOOST_CHECK( it == g.end() );
+
+    // modifiable iterators don't modify the copies
+    g.addGeometry( LineString( Point( 0.0,0.0 ),Point( 1.0,1.0 ) ) );
+    const GeometryCollection copy( g );
+    ( g.begin() + 2 )->as< LineString >().reverse();
+    BOOST_CHECK_EQUAL( g.geometryN( 2 ).asText( 0 ), "LINESTRING(1 1,0 0)" );
+    BOOST_CHECK_EQUAL( copy.geometryN( 2 ).asText( 0 ), "LINESTRING(0 0,1 1)" );
 }
 
 
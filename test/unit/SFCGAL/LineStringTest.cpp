@@ -96,6 +96,20 @@ BOOST_AUTO_TEST_CASE( testReverse_twoPoints )
     BOOST_CHECK_EQUAL( g.pointN( 1 ).y(), 0.0 );
 }
 
+///void removeRepeatedPoints() ;
+BOOST_AUTO_TEST_CASE( testRemoveRepeatedPoints )
+{
+    LineString g ;
+    g.addPoint( Point( 0.0,0.0 ) );
+    g.addPoint( Point( 0.0,0.0 ) );
+    g.addPoint( Point( 1.0,0.0 ) );
+    g.addPoint( Point( 1.0,1.0 ) );
+    g.addPoint( Point( 1.0,1.0 ) );
+    g.addPoint( Point( 0.0,0.0 ) );
+    g.removeRepeatedPoints();
+    BOOST_CHECK_EQUAL( g.asText( 0 ), "LINESTRING(0 0,1 0,1 1,0 0)" );
+}
+
 ///inline size_t          numPoints() const { return _points.size(); }
 
 ///size_t                 numSegments() const ;
@@ -198,6 +212,29 @@ BOOST_AUTO_TEST_CASE( iteratorTests )
     }
 }
 
+BOOST_AUTO_TEST_CASE( iteratorConvertOncePerPosition )
+{
+    LineString g( Point( 2.0, 3.0 ), Point( 4.0, 5.0 ) );
+
+    LineString::Point_2_const_iterator pi = g.points_2_begin();
+    const Kernel::Point_2& first = *pi ;
+    BOOST_CHECK_EQUAL( &*pi, &first );
+    BOOST_CHECK_EQUAL( *pi, g.pointN( 0 ).toPoint_2() );
+
+    // moving converts the new position
+    ++pi ;
+    BOOST_CHECK_EQUAL( *pi, g.pointN( 1 ).toPoint_2() );
+    --pi ;
+    BOOST_CHECK_EQUAL( *pi, g.pointN( 0 ).toPoint_2() );
+
+    // a copy keeps the converted point
+    LineString::Point_3_const_iterator ppi = g.points_3_end();
+    --ppi ;
+    BOOST_CHECK_EQUAL( *ppi, g.pointN( 1 ).toPoint_3() );
+    LineString::Point_3_const_iterator copy( ppi );
+    BOOST_CHECK_EQUAL( *copy, *ppi );
+}
+
 
 ///void reserve( const size_t & n ) ;
 
@@ -161,6 +161,49 @@ BOOST_AUTO_TEST_CASE( testClone )
     BOOST_CHECK_EQUAL( copy->exteriorRing().numPoints(), 5U );
 }
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+//Polygon( Polygon&& other ) ;
+BOOST_AUTO_TEST_CASE( testMoveConstructor )
+{
+    Polygon g( LineString( Point( 0.0,0.0 ),Point( 1.0,0.0 ) ) );
+    g.exteriorRing().addPoint( Point( 1.0,1.0 ) );
+    g.exteriorRing().addPoint( Point( 0.0,0.0 ) );
+    const LineString* ring = &g.exteriorRing() ;
+
+    Polygon moved( std::move( g ) );
+    BOOST_CHECK( g.isEmpty() );
+    BOOST_CHECK_EQUAL( g.numRings(), 1U );
+    BOOST_CHECK_EQUAL( &moved.exteriorRing(), ring );
+    BOOST_CHECK_EQUAL( moved.exteriorRing().numPoints(), 4U );
+}
+
+//void addInteriorRing( LineString&& ls ) ;
+BOOST_AUTO_TEST_CASE( testAddInteriorRingMove )
+{
+    Polygon g( LineString( Point( 0.0,0.0 ),Point( 1.0,0.0 ) ) );
+    LineString hole( Point( 0.2,0.2 ),Point( 0.3,0.2 ) );
+    hole.addPoint( Point( 0.2,0.2 ) );
+    g.addInteriorRing( std::move( hole ) );
+
+    BOOST_CHECK( hole.isEmpty() );
+    BOOST_REQUIRE_EQUAL( g.numInteriorRings(), 1U );
+    BOOST_CHECK_EQUAL( g.interiorRingN( 0 ).numPoints(), 3U );
+}
+#endif
+
+//inline void            removeInteriorRingN( const size_t& n )
+BOOST_AUTO_TEST_CASE( testRemoveInteriorRingN )
+{
+    Polygon g( LineString( Point( 0.0,0.0 ),Point( 1.0,0.0 ) ) );
+    g.addInteriorRing( LineString( Point( 0.2,0.2 ),Point( 0.3,0.2 ) ) );
+    g.addInteriorRing( LineString( Point( 0.5,0.5 ),Point( 0.6,0.5 ) ) );
+
+    g.removeInteriorRingN( 0 );
+    BOOST_REQUIRE_EQUAL( g.numInteriorRings(), 1U );
+    BOOST_CHECK_EQUAL( g.interiorRingN( 0 ).asText( 1 ), "LINESTRING(0.5 0.5,0.6 0.5)" );
+    BOOST_CHECK_EQUAL( g.exteriorRing().asText( 0 ), "LINESTRING(0 0,1 0)" );
+}
+
 //virtual Geometry*    Geometry::boundary() const ;
 BOOST_AUTO_TEST_CASE( testBoundaryEmpty )
 {
@@ -0,0 +1,128 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/detail/PreparedGeometrySet.h>
+
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_PreparedGeometryTest )
+
+BOOST_AUTO_TEST_CASE( testGeometrySetIsCached )
+{
+    PreparedGeometry prepared( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+
+    const detail::PreparedGeometrySet<2>& gs = prepared.geometrySet2D();
+    BOOST_CHECK_EQUAL( gs.geometrySet().surfaces().size(), 1U );
+    BOOST_CHECK_EQUAL( gs.boxes().size(), 1U );
+    BOOST_CHECK( &prepared.geometrySet2D() == &gs );
+}
+
+BOOST_AUTO_TEST_CASE( testInvalidateCache )
+{
+    PreparedGeometry prepared( io::readWkt( "POINT(1 2)" ) );
+    BOOST_CHECK_EQUAL( prepared.geometrySet2D().geometrySet().points().size(), 1U );
+
+    prepared.resetGeometry( io::readWkt( "MULTIPOINT(1 2,3 4)" ).release() );
+    BOOST_CHECK_EQUAL( prepared.geometrySet2D().geometrySet().points().size(), 2U );
+    BOOST_CHECK_EQUAL( prepared.envelope().xMax(), 3.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testAssertValidity )
+{
+    PreparedGeometry valid( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    BOOST_CHECK_NO_THROW( valid.assertValidity2D() );
+    BOOST_CHECK_NO_THROW( valid.assertValidity3D() );
+
+    // self-intersecting ring
+    PreparedGeometry invalid( io::readWkt( "POLYGON((0 0,10 10,10 0,0 10,0 0))" ) );
+    BOOST_CHECK_THROW( invalid.assertValidity2D(), GeometryInvalidityException );
+    BOOST_CHECK_THROW( invalid.assertValidity2D(), GeometryInvalidityException );
+}
+
+BOOST_AUTO_TEST_CASE( testPreparedPredicates )
+{
+    PreparedGeometry query( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    const char* wkts[] = {
+        "POINT(5 5)",
+        "POINT(20 20)",
+        "LINESTRING(-5 5,15 5)",
+        "POLYGON((2 2,4 2,4 4,2 4,2 2))",
+        "POLYGON((20 0,30 0,30 10,20 10,20 0))",
+        "TRIANGLE((10 0,20 0,10 10,10 0))"
+    };
+
+    for ( size_t i = 0; i < sizeof( wkts ) / sizeof( const char* ); i++ ) {
+        std::auto_ptr< Geometry > g( io::readWkt( wkts[i] ) );
+        PreparedGeometry preparedG( g->clone() );
+
+        BOOST_CHECK_EQUAL( algorithm::intersects( query, *g ), algorithm::intersects( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::intersects( query, preparedG ), algorithm::intersects( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::intersects3D( query, *g ), algorithm::intersects3D( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::covers( query, *g ), algorithm::covers( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::covers( query, preparedG ), algorithm::covers( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::distance( query, *g ), algorithm::distance( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::distance( query, preparedG ), algorithm::distance( query.geometry(), *g ) );
+        BOOST_CHECK_EQUAL( algorithm::intersection( query, *g )->asText( 3 ), algorithm::intersection( query.geometry(), *g )->asText( 3 ) );
+        BOOST_CHECK_EQUAL( algorithm::intersection( query, preparedG )->asText( 3 ), algorithm::intersection( query.geometry(), *g )->asText( 3 ) );
+    }
+}
+
+namespace {
+void countIntersections( const PreparedGeometry& query, const Geometry& g, size_t& count )
+{
+    for ( int i = 0; i < 100; i++ ) {
+        if ( algorithm::intersects( query, g ) ) {
+            ++count ;
+        }
+    }
+}
+}
+
+BOOST_AUTO_TEST_CASE( testSharedBetweenThreads )
+{
+    PreparedGeometry query( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(-5 5,15 5)" ) );
+
+    size_t counts[4] = { 0, 0, 0, 0 };
+    boost::thread_group threads ;
+
+    for ( int i = 0; i < 4; i++ ) {
+        threads.create_thread( boost::bind( &countIntersections, boost::cref( query ), boost::cref( *g ), boost::ref( counts[i] ) ) );
+    }
+
+    threads.join_all();
+
+    for ( int i = 0; i < 4; i++ ) {
+        BOOST_CHECK_EQUAL( counts[i], 100U );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <SFCGAL/Kernel.h>
+#include <SFCGAL/Exception.h>
 #include <SFCGAL/Envelope.h>
 #include <SFCGAL/Triangle.h>
 #include <SFCGAL/PolyhedralSurface.h>
@@ -79,6 +80,155 @@ BOOST_AUTO_TEST_CASE( constructorWithTriangles )
 
 
 
+//-- indexed mesh
+
+//size_t addVertex( const Point& p ) ;
+//void addTriangle( const size_t& a, const size_t& b, const size_t& c ) ;
+BOOST_AUTO_TEST_CASE( testIndexedMesh )
+{
+    TriangulatedSurface g ;
+    const size_t a = g.addVertex( Point( 0.0,0.0 ) );
+    const size_t b = g.addVertex( Point( 1.0,0.0 ) );
+    const size_t c = g.addVertex( Point( 1.0,1.0 ) );
+    const size_t d = g.addVertex( Point( 0.0,1.0 ) );
+    g.addTriangle( a, b, c );
+    g.addTriangle( a, c, d );
+
+    BOOST_CHECK( g.isIndexed() );
+    BOOST_CHECK_EQUAL( g.numVertices(), 4U );
+    BOOST_CHECK_EQUAL( g.numTriangles(), 2U );
+    BOOST_CHECK_EQUAL( g.vertexIndex( 1, 1 ), c );
+    BOOST_CHECK_EQUAL( g.triangleN( 1 ).vertex( 2 ).asText( 0 ), "POINT(0 1)" );
+    BOOST_CHECK_EQUAL( g.asText( 0 ), "TIN(((0 0,1 0,1 1,0 0)),((0 0,1 1,0 1,0 0)))" );
+}
+
+//void weldVertices() ;
+//void computeNeighbours( std::vector< size_t >& neighbours ) const ;
+BOOST_AUTO_TEST_CASE( testWeldVerticesAndNeighbours )
+{
+    std::vector< Triangle > triangles ;
+    triangles.push_back( Triangle( Point( 0.0,0.0 ), Point( 1.0,0.0 ), Point( 1.0,1.0 ) ) ) ;
+    triangles.push_back( Triangle( Point( 0.0,0.0 ), Point( 1.0,1.0 ), Point( 0.0,1.0 ) ) ) ;
+
+    TriangulatedSurface g( triangles ) ;
+    BOOST_CHECK_EQUAL( g.numVertices(), 6U );
+
+    std::vector< size_t > neighbours ;
+    g.computeNeighbours( neighbours );
+    BOOST_REQUIRE_EQUAL( neighbours.size(), 6U );
+    BOOST_CHECK_EQUAL( neighbours[2], TriangulatedSurface::NO_NEIGHBOUR );
+
+    g.weldVertices();
+    BOOST_CHECK_EQUAL( g.numVertices(), 4U );
+    BOOST_CHECK_EQUAL( g.vertexIndex( 0, 0 ), g.vertexIndex( 1, 0 ) );
+    BOOST_CHECK_EQUAL( g.asText( 0 ), "TIN(((0 0,1 0,1 1,0 0)),((0 0,1 1,0 1,0 0)))" );
+
+    g.computeNeighbours( neighbours );
+    // edge (1 1,0 0) of the first triangle is the edge (0 0,1 1) of the second one
+    BOOST_CHECK_EQUAL( neighbours[0], TriangulatedSurface::NO_NEIGHBOUR );
+    BOOST_CHECK_EQUAL( neighbours[1], TriangulatedSurface::NO_NEIGHBOUR );
+    BOOST_CHECK_EQUAL( neighbours[2], 1U );
+    BOOST_CHECK_EQUAL( neighbours[3], 0U );
+    BOOST_CHECK_EQUAL( neighbours[4], TriangulatedSurface::NO_NEIGHBOUR );
+    BOOST_CHECK_EQUAL( neighbours[5], TriangulatedSurface::NO_NEIGHBOUR );
+
+    // a shared vertex is modified for every triangle
+    g.vertexN( g.vertexIndex( 0, 0 ) ) = Point( -1.0,0.0 );
+    BOOST_CHECK_EQUAL( g.asText( 0 ), "TIN(((-1 0,1 0,1 1,-1 0)),((-1 0,1 1,0 1,-1 0)))" );
+}
+
+//virtual const Triangle&  geometryN( size_t const& n ) const ;
+//virtual Triangle&        geometryN( size_t const& n ) ;
+BOOST_AUTO_TEST_CASE( testTriangleSoup )
+{
+    std::vector< Triangle > triangles ;
+    triangles.push_back( Triangle( Point( 0.0,0.0 ), Point( 1.0,0.0 ), Point( 1.0,1.0 ) ) ) ;
+    triangles.push_back( Triangle( Point( 0.0,0.0 ), Point( 1.0,1.0 ), Point( 0.0,1.0 ) ) ) ;
+
+    TriangulatedSurface g( triangles ) ;
+    g.weldVertices();
+
+    // read-only access keeps the indexed mesh
+    const TriangulatedSurface& constG = g ;
+    const Triangle* first = &constG.geometryN( 0 ) ;
+    BOOST_CHECK_EQUAL( first->asText( 0 ), "TRIANGLE((0 0,1 0,1 1,0 0))" );
+    BOOST_CHECK( g.isIndexed() );
+
+    // modifiable access switches to a triangle soup, with the same triangles
+    g.geometryN( 1 ).reverse();
+    BOOST_CHECK( ! g.isIndexed() );
+    BOOST_CHECK_EQUAL( &g.geometryN( 0 ), first );
+    BOOST_CHECK_EQUAL( g.numVertices(), 6U );
+    BOOST_CHECK_EQUAL( g.vertexIndex( 1, 0 ), 3U );
+    BOOST_CHECK_THROW( g.addVertex( Point( 0.0,0.0 ) ), Exception );
+
+    g.addTriangle( Triangle( Point( 1.0,1.0 ), Point( 2.0,1.0 ), Point( 2.0,2.0 ) ) );
+    BOOST_CHECK_EQUAL( g.numTriangles(), 3U );
+
+    // a copy is an indexed mesh
+    TriangulatedSurface copy( g );
+    BOOST_CHECK( copy.isIndexed() );
+    BOOST_CHECK_EQUAL( copy.asText( 0 ), g.asText( 0 ) );
+}
+
+//virtual const Triangle&  geometryN( size_t const& n ) const ;
+BOOST_AUTO_TEST_CASE( testTriangleCache )
+{
+    TriangulatedSurface g ;
+    const size_t a = g.addVertex( Point( 0.0,0.0 ) );
+    const size_t b = g.addVertex( Point( 1.0,0.0 ) );
+    const size_t c = g.addVertex( Point( 1.0,1.0 ) );
+    g.addTriangle( a, b, c );
+
+    // the cache is built once
+    const TriangulatedSurface& constG = g ;
+    const Triangle* first = &constG.geometryN( 0 ) ;
+    BOOST_CHECK_EQUAL( &constG.geometryN( 0 ), first );
+
+    // and completed when triangles are added
+    const size_t d = g.addVertex( Point( 0.0,1.0 ) );
+    g.addTriangle( a, c, d );
+    BOOST_CHECK_EQUAL( constG.geometryN( 1 ).asText( 0 ), "TRIANGLE((0 0,1 1,0 1,0 0))" );
+    BOOST_CHECK_EQUAL( &constG.geometryN( 0 ), first );
+
+    // and rebuilt when a vertex is modified
+    g.vertexN( a ) = Point( -1.0,0.0 );
+    BOOST_CHECK_EQUAL( constG.geometryN( 0 ).asText( 0 ), "TRIANGLE((-1 0,1 0,1 1,-1 0))" );
+    BOOST_CHECK( g.isIndexed() );
+
+    // an assigned mesh is consistent with its own triangles
+    TriangulatedSurface other ;
+    other = g ;
+    BOOST_CHECK_EQUAL( static_cast< const TriangulatedSurface& >( other ).geometryN( 1 ).asText( 0 ), "TRIANGLE((-1 0,1 1,0 1,-1 0))" );
+
+    // the cache is freed on demand
+    BOOST_CHECK_EQUAL( g.numCachedTriangles(), 2U );
+    g.clearTriangleCache();
+    BOOST_CHECK_EQUAL( g.numCachedTriangles(), 0U );
+    BOOST_CHECK_EQUAL( g.numTriangles(), 2U );
+}
+
+// producers share the vertices of the triangles
+BOOST_AUTO_TEST_CASE( testSharedVerticesOnConstruction )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "TIN(((0 0,1 0,1 1,0 0)),((0 0,1 1,0 1,0 0)))" ) );
+    const TriangulatedSurface& tin = g->as< TriangulatedSurface >() ;
+    BOOST_CHECK_EQUAL( tin.numVertices(), 4U );
+    BOOST_CHECK_EQUAL( tin.numCachedTriangles(), 0U );
+    BOOST_CHECK_EQUAL( tin.asText( 0 ), "TIN(((0 0,1 0,1 1,0 0)),((0 0,1 1,0 1,0 0)))" );
+
+    // vertices with different m are not merged
+    std::auto_ptr< Geometry > measured( io::readWkt( "TIN M(((0 0 1,1 0 1,1 1 1,0 0 1)),((0 0 2,1 1 1,0 1 2,0 0 2)))" ) );
+    BOOST_CHECK_EQUAL( measured->as< TriangulatedSurface >().numVertices(), 5U );
+
+    std::auto_ptr< Geometry > square( io::readWkt( "POLYGON((0 0,1 0,1 1,0 1,0 0))" ) );
+    TriangulatedSurface triangulated ;
+    triangulate::triangulatePolygon3D( *square, triangulated );
+    BOOST_CHECK_EQUAL( triangulated.numTriangles(), 2U );
+    BOOST_CHECK_EQUAL( triangulated.numVertices(), 4U );
+}
+
+
 //-- helpers
 
 //template < typename K, typename Polyhedron > std::auto_ptr<Polyhedron> toPolyhedron_3() const;
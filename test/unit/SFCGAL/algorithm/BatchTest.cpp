@@ -0,0 +1,213 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/batch.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/distance.h>
+#include <SFCGAL/algorithm/translate.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_BatchTest )
+
+namespace {
+
+// candidates around the probe POLYGON((0 0,4 0,4 4,0 4,0 0))
+const char* candidatesWkt[] = {
+    "POINT(2 2)",
+    "POINT(4 2)",
+    "POINT(5 5)",
+    "LINESTRING(1 1,3 3)",
+    "LINESTRING(3 3,6 6)",
+    "LINESTRING(5 0,5 4)",
+    "POLYGON((1 1,2 1,2 2,1 2,1 1))",
+    "POLYGON((4 0,5 0,5 1,4 1,4 0))",
+    "POLYGON((6 6,7 6,7 7,6 7,6 6))",
+    "POLYGON((-1 -1,5 -1,5 5,-1 5,-1 -1))",
+    // bounding box overlapping the probe, but disjoint
+    "LINESTRING(-1 3,1 5)",
+    "MULTIPOINT((1 1),(3 3))",
+    "MULTIPOINT((1 1),(6 6))",
+    "POINT EMPTY",
+    "POLYGON EMPTY"
+};
+
+const char* probeWkt = "POLYGON((0 0,4 0,4 4,0 4,0 0))" ;
+
+void readCandidates( boost::ptr_vector< Geometry >& geometries, std::vector< const Geometry* >& candidates )
+{
+    for ( size_t i = 0; i < sizeof( candidatesWkt ) / sizeof( candidatesWkt[0] ); i++ ) {
+        geometries.push_back( io::readWkt( candidatesWkt[i] ).release() );
+        candidates.push_back( &geometries.back() );
+    }
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testIntersectsMany )
+{
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    boost::ptr_vector< Geometry > geometries ;
+    std::vector< const Geometry* > candidates ;
+    readCandidates( geometries, candidates );
+
+    std::vector< bool > results ;
+    algorithm::intersectsMany( *probe, candidates, results );
+    BOOST_REQUIRE_EQUAL( results.size(), candidates.size() );
+
+    for ( size_t i = 0; i < candidates.size(); i++ ) {
+        BOOST_TEST_MESSAGE( candidates[i]->asText() );
+        BOOST_CHECK_EQUAL( results[i], algorithm::intersects( *probe, *candidates[i] ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testCoversMany )
+{
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    boost::ptr_vector< Geometry > geometries ;
+    std::vector< const Geometry* > candidates ;
+    readCandidates( geometries, candidates );
+
+    std::vector< bool > results ;
+    algorithm::coversMany( *probe, candidates, results );
+    BOOST_REQUIRE_EQUAL( results.size(), candidates.size() );
+
+    for ( size_t i = 0; i < candidates.size(); i++ ) {
+        BOOST_TEST_MESSAGE( candidates[i]->asText() );
+        BOOST_CHECK_EQUAL( results[i], algorithm::covers( *probe, *candidates[i] ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDistanceMany )
+{
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    boost::ptr_vector< Geometry > geometries ;
+    std::vector< const Geometry* > candidates ;
+    readCandidates( geometries, candidates );
+
+    std::vector< double > results ;
+    algorithm::distanceMany( *probe, candidates, results );
+    BOOST_REQUIRE_EQUAL( results.size(), candidates.size() );
+
+    for ( size_t i = 0; i < candidates.size(); i++ ) {
+        BOOST_TEST_MESSAGE( candidates[i]->asText() );
+        BOOST_CHECK_EQUAL( results[i], algorithm::distance( *probe, *candidates[i] ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testThreads )
+{
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    boost::ptr_vector< Geometry > geometries ;
+    std::vector< const Geometry* > candidates ;
+    readCandidates( geometries, candidates );
+
+    std::vector< bool > expected, results ;
+    algorithm::intersectsMany( *probe, candidates, expected );
+
+    // parallel execution requires CGAL with thread support
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        BOOST_CHECK_THROW( algorithm::intersectsMany( *probe, candidates, results, 4 ), NotImplementedException );
+        return ;
+    }
+
+    // more threads than candidates, one thread per core
+    const size_t numThreads[] = { 4, 100, 0 };
+
+    for ( size_t i = 0; i < 3; i++ ) {
+        algorithm::intersectsMany( *probe, candidates, results, numThreads[i] );
+        BOOST_CHECK( results == expected );
+    }
+}
+
+//
+// the translated geometries share the lazy exact numbers of the translation vector
+BOOST_AUTO_TEST_CASE( testThreadsExactCoordinates )
+{
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        return ;
+    }
+
+    const Kernel::Vector_2 v( Kernel::FT( 1 ) / 3, Kernel::FT( 1 ) / 7 );
+
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    algorithm::translate( *probe, v );
+    boost::ptr_vector< Geometry > geometries ;
+    std::vector< const Geometry* > candidates ;
+    readCandidates( geometries, candidates );
+
+    for ( size_t i = 0; i < geometries.size(); i++ ) {
+        algorithm::translate( geometries[i], v );
+    }
+
+    std::vector< bool > expected, results ;
+    algorithm::intersectsMany( *probe, candidates, expected );
+    algorithm::intersectsMany( *probe, candidates, results, 4 );
+    BOOST_CHECK( results == expected );
+
+    algorithm::coversMany( *probe, candidates, expected );
+    algorithm::coversMany( *probe, candidates, results, 4 );
+    BOOST_CHECK( results == expected );
+
+    std::vector< double > expectedDistances, distances ;
+    algorithm::distanceMany( *probe, candidates, expectedDistances );
+    algorithm::distanceMany( *probe, candidates, distances, 4 );
+    BOOST_CHECK( distances == expectedDistances );
+}
+
+BOOST_AUTO_TEST_CASE( testEmptyCandidates )
+{
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    std::vector< const Geometry* > candidates ;
+
+    std::vector< bool > results( 3, true );
+    algorithm::intersectsMany( *probe, candidates, results, ExecutionPolicy::parallelSupported() ? 4 : 1 );
+    BOOST_CHECK( results.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testInvalidCandidate )
+{
+    std::auto_ptr< Geometry > probe( io::readWkt( probeWkt ) );
+    // self-intersecting ring overlapping the probe
+    std::auto_ptr< Geometry > invalid( io::readWkt( "POLYGON((1 1,3 3,3 1,1 3,1 1))" ) );
+    // not checked, rejected by its envelope
+    std::auto_ptr< Geometry > invalidOutside( io::readWkt( "POLYGON((11 11,13 13,13 11,11 13,11 11))" ) );
+
+    std::vector< const Geometry* > candidates ;
+    candidates.push_back( invalidOutside.get() );
+
+    std::vector< bool > results ;
+    algorithm::intersectsMany( *probe, candidates, results );
+    BOOST_CHECK( ! results[0] );
+
+    candidates.push_back( invalid.get() );
+    BOOST_CHECK_THROW( algorithm::intersectsMany( *probe, candidates, results ), GeometryInvalidityException );
+    BOOST_CHECK_THROW( algorithm::intersectsMany( *probe, candidates, results, 2 ), GeometryInvalidityException );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,176 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/clipByEnvelope.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/area.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_ClipByEnvelopeTest )
+
+namespace {
+
+// geometries around the envelope (0,4,0,4), clipped directly or through intersection
+const char* geometriesWkt[] = {
+    "POINT(2 2)",
+    "POINT(4 2)",
+    "POINT(5 5)",
+    "LINESTRING(-1 2,5 2)",
+    "LINESTRING(1 1,3 3,6 3,6 1,3 1)",
+    "LINESTRING(5 0,5 4)",
+    // touches a corner
+    "LINESTRING(4 5,5 4)",
+    "LINESTRING(3 -1,5 1)",
+    "POLYGON((1 1,2 1,2 2,1 2,1 1))",
+    "POLYGON((2 2,6 2,6 6,2 6,2 2))",
+    "POLYGON((-1 -1,5 -1,5 5,-1 5,-1 -1))",
+    "POLYGON((-1 -1,5 -1,5 5,-1 5,-1 -1),(1 1,2 1,2 2,1 2,1 1))",
+    "POLYGON((-1 -1,5 -1,5 5,-1 5,-1 -1),(5 5,6 5,6 6,5 6,5 5))",
+    // hole crossing a side
+    "POLYGON((-1 -1,5 -1,5 5,-1 5,-1 -1),(3 1,4.5 1,4.5 2,3 2,3 1))",
+    // U shape, leaves and reenters the rectangle
+    "POLYGON((1 -1,2 -1,2 5,3 5,3 -1,4 -1,4 6,1 6,1 -1))",
+    // shares a side
+    "POLYGON((4 0,5 0,5 4,4 4,4 0))",
+    "POLYGON((6 6,7 6,7 7,6 7,6 6))",
+    "TRIANGLE((1 1,3 1,1 3,1 1))",
+    "TRIANGLE((2 2,6 2,2 6,2 2))",
+    "MULTIPOLYGON(((-1 -1,1 -1,1 1,-1 1,-1 -1)),((3 3,5 3,5 5,3 5,3 3)))",
+    "GEOMETRYCOLLECTION(POINT(1 1),LINESTRING(-1 2,5 2),POLYGON((2 2,6 2,6 6,2 6,2 2)))",
+    "POLYHEDRALSURFACE(((2 2,6 2,6 6,2 6,2 2)))",
+    "POINT EMPTY",
+    "POLYGON EMPTY"
+};
+
+// true if a and b are the same point set
+bool samePointSet( const Geometry& a, const Geometry& b )
+{
+    if ( a.isEmpty() || b.isEmpty() ) {
+        return a.isEmpty() && b.isEmpty();
+    }
+
+    return algorithm::covers( a, b ) && algorithm::covers( b, a );
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testClipByEnvelopeMatchesIntersection )
+{
+    const Envelope envelope( 0.0, 4.0, 0.0, 4.0 );
+    std::auto_ptr< Geometry > rectangle( envelope.toPolygon() );
+
+    for ( size_t i = 0; i < sizeof( geometriesWkt ) / sizeof( geometriesWkt[0] ); i++ ) {
+        std::auto_ptr< Geometry > g( io::readWkt( geometriesWkt[i] ) );
+        std::auto_ptr< Geometry > clipped( algorithm::clipByEnvelope( *g, envelope ) );
+        std::auto_ptr< Geometry > expected( algorithm::intersection( *g, *rectangle ) );
+
+        BOOST_CHECK_MESSAGE( samePointSet( *clipped, *expected ), geometriesWkt[i] << " : " << clipped->asText() << " != " << expected->asText() );
+        BOOST_CHECK_CLOSE( algorithm::area( *clipped ), algorithm::area( *expected ), 1e-9 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testClipByEnvelopePolygon )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "POLYGON((2 2,6 2,6 6,2 6,2 2))" ) );
+    std::auto_ptr< Geometry > clipped( algorithm::clipByEnvelope( *g, Envelope( 0.0, 4.0, 0.0, 4.0 ) ) );
+    BOOST_CHECK_EQUAL( clipped->geometryTypeId(), TYPE_POLYGON );
+    BOOST_CHECK_EQUAL( algorithm::area( *clipped ), 4.0 );
+
+    // the polygon is kept as is when it is inside
+    std::auto_ptr< Geometry > inside( algorithm::clipByEnvelope( *g, Envelope( 0.0, 10.0, 0.0, 10.0 ) ) );
+    BOOST_CHECK_EQUAL( inside->asText( 0 ), g->asText( 0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testClipByEnvelopeLineString )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(1 1,3 3,6 3,6 1,3 1)" ) );
+    std::auto_ptr< Geometry > clipped( algorithm::clipByEnvelope( *g, Envelope( 0.0, 4.0, 0.0, 4.0 ) ) );
+    BOOST_CHECK_EQUAL( clipped->asText( 0 ), "MULTILINESTRING((1 1,3 3,4 3),(4 1,3 1))" );
+}
+
+BOOST_AUTO_TEST_CASE( testClipByEnvelopeInterpolatesZ )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(-2 0 0,6 0 8)" ) );
+    std::auto_ptr< Geometry > clipped( algorithm::clipByEnvelope( *g, Envelope( 0.0, 4.0, -1.0, 1.0 ) ) );
+    BOOST_CHECK_EQUAL( clipped->asText( 0 ), "LINESTRING Z(0 0 2,4 0 6)" );
+}
+
+BOOST_AUTO_TEST_CASE( testClipByEnvelope3D )
+{
+    const Envelope envelope( 0.0, 4.0, 0.0, 4.0, 0.0, 4.0 );
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(-2 2 -2,6 2 6)" ) );
+    std::auto_ptr< Geometry > clipped( algorithm::clipByEnvelope3D( *g, envelope ) );
+    BOOST_CHECK_EQUAL( clipped->asText( 0 ), "LINESTRING Z(0 2 0,4 2 4)" );
+
+    std::auto_ptr< Geometry > triangle( io::readWkt( "TRIANGLE((2 2 2,6 2 2,2 6 2,2 2 2))" ) );
+    std::auto_ptr< Geometry > clippedTriangle( algorithm::clipByEnvelope3D( *triangle, envelope ) );
+    std::auto_ptr< Geometry > expected( algorithm::intersection3D( *triangle, *envelope.toSolid() ) );
+    BOOST_CHECK( algorithm::covers3D( *clippedTriangle, *expected ) );
+    BOOST_CHECK( algorithm::covers3D( *expected, *clippedTriangle ) );
+
+    // 2D envelope
+    BOOST_CHECK_THROW( algorithm::clipByEnvelope3D( *g, Envelope( 0.0, 4.0, 0.0, 4.0 ) ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testClipByEnvelopeEmptyOrCollapsed )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "POLYGON((2 2,6 2,6 6,2 6,2 2))" ) );
+    BOOST_CHECK( algorithm::clipByEnvelope( *g, Envelope() )->isEmpty() );
+    BOOST_CHECK_THROW( algorithm::clipByEnvelope( *g, Envelope( 1.0, 1.0, 0.0, 4.0 ) ), Exception );
+}
+
+namespace {
+
+struct TileArea : public algorithm::ClipByGridVisitor {
+    TileArea():
+        numTiles( 0 ),
+        area( 0 ) {
+    }
+
+    virtual void visit( const size_t& /*column*/, const size_t& /*row*/, std::auto_ptr< Geometry > clipped ) {
+        numTiles++ ;
+        area += algorithm::area( *clipped );
+    }
+
+    size_t numTiles ;
+    double area ;
+};
+
+}
+
+BOOST_AUTO_TEST_CASE( testClipByGrid )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "POLYGON((0.5 0.5,3.5 0.5,3.5 2.5,0.5 2.5,0.5 0.5),(1.5 1.5,2.5 1.5,2.5 2.2,1.5 2.2,1.5 1.5))" ) );
+
+    TileArea visitor ;
+    algorithm::clipByGrid( *g, Envelope( 0.0, 10.0, 0.0, 10.0 ), 10, 10, visitor );
+    BOOST_CHECK_EQUAL( visitor.numTiles, 12U );
+    BOOST_CHECK_CLOSE( visitor.area, algorithm::area( *g ), 1e-9 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/compactExact.h>
+#include <SFCGAL/algorithm/intersection.h>
+
+#include <SFCGAL/detail/tools/Registry.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_CompactExactTest )
+
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    tools::Registry& registry = tools::Registry::instance() ;
+    std::vector< std::string > typeNames = tools::Registry::instance().getGeometryTypes();
+
+    for ( size_t i = 0; i < typeNames.size(); i++ ) {
+        BOOST_TEST_MESSAGE( typeNames[i] ) ;
+
+        std::auto_ptr< Geometry > g( registry.newGeometryByTypeName( typeNames[i] ) ) ;
+        BOOST_REQUIRE( g.get() != NULL ) ;
+        algorithm::CompactExactStatistics statistics = algorithm::compactExact( *g );
+        BOOST_CHECK( g->isEmpty() );
+        BOOST_CHECK_EQUAL( statistics.numCoordinates, 0U );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testIntersectionResult )
+{
+    std::auto_ptr< Geometry > ga( io::readWkt( "LINESTRING(0 0,3 1)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "LINESTRING(0 1,3 0)" ) );
+
+    std::auto_ptr< Geometry > result( algorithm::intersection( *ga, *gb ) );
+    BOOST_REQUIRE( result->is< Point >() );
+
+    algorithm::CompactExactStatistics statistics = algorithm::compactExact( *result );
+    BOOST_CHECK_EQUAL( statistics.numCoordinates, 1U );
+    BOOST_CHECK_EQUAL( statistics.numDoubles, 1U );
+    BOOST_CHECK_EQUAL( result->asText( 1 ), "POINT(1.5 0.5)" );
+}
+
+BOOST_AUTO_TEST_CASE( testRoundToDouble )
+{
+    std::auto_ptr< Geometry > ga( io::readWkt( "LINESTRING(0 0,3 1)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "LINESTRING(0 1,1 0)" ) );
+
+    // (3/4 1/4) is exactly represented by doubles
+    std::auto_ptr< Geometry > result( algorithm::intersection( *ga, *gb ) );
+    BOOST_REQUIRE( result->is< Point >() );
+    const Kernel::FT x = result->as< Point >().x() ;
+
+    algorithm::CompactExactStatistics statistics = algorithm::compactExact( *result );
+    BOOST_CHECK_EQUAL( statistics.numCoordinates, 1U );
+    BOOST_CHECK_EQUAL( result->as< Point >().x(), x );
+
+    std::auto_ptr< Geometry > gc( io::readWkt( "LINESTRING(0 0,3 1)" ) );
+    std::auto_ptr< Geometry > gd( io::readWkt( "LINESTRING(0 1,1 -1)" ) );
+    // (3/7 1/7) is not
+    std::auto_ptr< Geometry > inexact( algorithm::intersection( *gc, *gd ) );
+    BOOST_REQUIRE( inexact->is< Point >() );
+
+    statistics = algorithm::compactExact( *inexact );
+    BOOST_CHECK_EQUAL( statistics.numDoubles, 0U );
+    statistics = algorithm::compactExact( *inexact, true );
+    BOOST_CHECK_EQUAL( statistics.numDoubles, 1U );
+    BOOST_CHECK_EQUAL( inexact->as< Point >().x(), CGAL::to_double( Kernel::FT( 3 ) / 7 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testAutoCompactExact )
+{
+    BOOST_CHECK( ! algorithm::autoCompactExact() );
+    algorithm::setAutoCompactExact( true );
+
+    std::auto_ptr< Geometry > ga( io::readWkt( "POLYGON((0 0,2 0,2 2,0 2,0 0))" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "POLYGON((1 1,3 1,3 3,1 3,1 1))" ) );
+    std::auto_ptr< Geometry > result( algorithm::intersection( *ga, *gb ) );
+
+    // already compacted
+    algorithm::CompactExactStatistics statistics = algorithm::compactExact( *result );
+    BOOST_CHECK_EQUAL( statistics.numDoubles, statistics.numCoordinates );
+
+    algorithm::setAutoCompactExact( false );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
@@ -0,0 +1,144 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/coverageOverlay.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/covers.h>
+#include <SFCGAL/algorithm/area.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_CoverageOverlayTest )
+
+namespace {
+
+// pairs of layers, overlaid directly or pair by pair through intersection
+const char* layersWkt[][2] = {
+    // adjacent parcels across a zone
+    {
+        "MULTIPOLYGON(((0 0,2 0,2 2,0 2,0 0)),((2 0,4 0,4 2,2 2,2 0)))",
+        "MULTIPOLYGON(((1 1,3 1,3 3,1 3,1 1)),((5 5,6 5,6 6,5 6,5 5)))"
+    },
+    // a parcel inside a zone, far from its boundary
+    {
+        "MULTIPOLYGON(((1 1,2 1,2 2,1 2,1 1)))",
+        "MULTIPOLYGON(((0 0,10 0,10 10,0 10,0 0)))"
+    },
+    // same coverage on both sides
+    {
+        "MULTIPOLYGON(((0 0,2 0,2 2,0 2,0 0)),((2 0,4 0,4 2,2 2,2 0)))",
+        "MULTIPOLYGON(((0 0,2 0,2 2,0 2,0 0)),((2 0,4 0,4 2,2 2,2 0)))"
+    },
+    // a hole filled by a polygon of the same layer, crossed by a zone
+    {
+        "MULTIPOLYGON(((0 0,6 0,6 6,0 6,0 0),(2 2,4 2,4 4,2 4,2 2)),((2 2,4 2,4 4,2 4,2 2)))",
+        "MULTIPOLYGON(((1 1,3 1,3 3,1 3,1 1)),((3 3,7 3,7 7,3 7,3 3)))"
+    },
+    // a zone inside a hole, a zone around the hole
+    {
+        "MULTIPOLYGON(((0 0,6 0,6 6,0 6,0 0),(2 2,4 2,4 4,2 4,2 2)))",
+        "MULTIPOLYGON(((2.5 2.5,3.5 2.5,3.5 3.5,2.5 3.5,2.5 2.5)),((-1 -1,7 -1,7 7,-1 7,-1 -1),(1 1,5 1,5 5,1 5,1 1)))"
+    },
+    // non convex faces (U shape across a bar)
+    {
+        "MULTIPOLYGON(((0 0,5 0,5 3,4 3,4 1,1 1,1 3,0 3,0 0)))",
+        "MULTIPOLYGON(((-1 2,6 2,6 4,-1 4,-1 2)),((-1 -1,6 -1,6 2,-1 2,-1 -1)))"
+    },
+    {
+        "MULTIPOLYGON EMPTY",
+        "MULTIPOLYGON(((0 0,1 0,1 1,0 1,0 0)))"
+    }
+};
+
+// true if a and b are the same point set
+bool samePointSet( const Geometry& a, const Geometry& b )
+{
+    if ( a.isEmpty() || b.isEmpty() ) {
+        return a.isEmpty() && b.isEmpty();
+    }
+
+    return algorithm::covers( a, b ) && algorithm::covers( b, a );
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testCoverageOverlayMatchesIntersection )
+{
+    for ( size_t k = 0; k < sizeof( layersWkt ) / sizeof( layersWkt[0] ); k++ ) {
+        std::auto_ptr< Geometry > a( io::readWkt( layersWkt[k][0] ) );
+        std::auto_ptr< Geometry > b( io::readWkt( layersWkt[k][1] ) );
+
+        std::vector< std::pair< size_t, size_t > > provenance ;
+        std::auto_ptr< MultiPolygon > overlay( algorithm::coverageOverlay( a->as< MultiPolygon >(), b->as< MultiPolygon >(), provenance ) );
+        BOOST_REQUIRE_EQUAL( overlay->numGeometries(), provenance.size() );
+
+        for ( size_t i = 0; i < a->numGeometries(); i++ ) {
+            for ( size_t j = 0; j < b->numGeometries(); j++ ) {
+                MultiPolygon faces ;
+
+                for ( size_t f = 0; f < provenance.size(); f++ ) {
+                    if ( provenance[f] == std::make_pair( i, j ) ) {
+                        faces.addGeometry( overlay->polygonN( f ) );
+                    }
+                }
+
+                std::auto_ptr< Geometry > expected( algorithm::intersection( a->geometryN( i ), b->geometryN( j ) ) );
+                BOOST_CHECK_MESSAGE( std::abs( algorithm::area( faces ) - algorithm::area( *expected ) ) < 1e-9,
+                                     k << " (" << i << "," << j << ") : " << faces.asText() << " != " << expected->asText() );
+
+                if ( algorithm::area( *expected ) > 0.0 ) {
+                    BOOST_CHECK_MESSAGE( samePointSet( faces, *expected ),
+                                         k << " (" << i << "," << j << ") : " << faces.asText() << " != " << expected->asText() );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testCoverageOverlayProvenance )
+{
+    std::auto_ptr< Geometry > a( io::readWkt( layersWkt[0][0] ) );
+    std::auto_ptr< Geometry > b( io::readWkt( layersWkt[0][1] ) );
+
+    std::vector< std::pair< size_t, size_t > > provenance ;
+    std::auto_ptr< MultiPolygon > overlay( algorithm::coverageOverlay( a->as< MultiPolygon >(), b->as< MultiPolygon >(), provenance ) );
+
+    BOOST_REQUIRE_EQUAL( overlay->numGeometries(), 2U );
+    BOOST_CHECK( provenance[0] == std::make_pair( size_t( 0 ), size_t( 0 ) ) );
+    BOOST_CHECK( provenance[1] == std::make_pair( size_t( 1 ), size_t( 0 ) ) );
+    BOOST_CHECK_EQUAL( algorithm::area( overlay->polygonN( 0 ) ), 1.0 );
+    BOOST_CHECK_EQUAL( algorithm::area( overlay->polygonN( 1 ) ), 1.0 );
+}
+
+BOOST_AUTO_TEST_CASE( testCoverageOverlayEmpty )
+{
+    std::vector< std::pair< size_t, size_t > > provenance( 1 );
+    std::auto_ptr< MultiPolygon > overlay( algorithm::coverageOverlay( MultiPolygon(), MultiPolygon(), provenance ) );
+    BOOST_CHECK( overlay->isEmpty() );
+    BOOST_CHECK( provenance.empty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/MultiPoint.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/PreparedGeometry.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/memoryFootprint.h>
+#include <SFCGAL/algorithm/compactExact.h>
+
+#include <SFCGAL/detail/tools/Registry.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_MemoryFootprintTest )
+
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    tools::Registry& registry = tools::Registry::instance() ;
+    std::vector< std::string > typeNames = tools::Registry::instance().getGeometryTypes();
+
+    for ( size_t i = 0; i < typeNames.size(); i++ ) {
+        BOOST_TEST_MESSAGE( typeNames[i] ) ;
+
+        std::auto_ptr< Geometry > g( registry.newGeometryByTypeName( typeNames[i] ) ) ;
+        BOOST_REQUIRE( g.get() != NULL ) ;
+        algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( *g );
+        BOOST_CHECK( footprint.structuralBytes > 0 );
+        BOOST_CHECK_EQUAL( footprint.exactBytes, 0U );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testDoubleCoordinates )
+{
+    LineString g( Point( 0.0,0.0 ), Point( 1.0,1.0 ) );
+    algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( g );
+    BOOST_CHECK_EQUAL( footprint.structuralBytes, sizeof( LineString ) + 2 * sizeof( Point ) );
+    BOOST_CHECK_EQUAL( footprint.exactBytes, 0U );
+    BOOST_CHECK_EQUAL( footprint.totalBytes(), footprint.structuralBytes );
+}
+
+BOOST_AUTO_TEST_CASE( testExactCoordinates )
+{
+    Point p( Kernel::FT( 1 ) / 3, Kernel::FT( 2 ) / 3 );
+    algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( p );
+    BOOST_CHECK_EQUAL( footprint.structuralBytes, sizeof( Point ) );
+    BOOST_CHECK( footprint.exactBytes > 0 );
+}
+
+BOOST_AUTO_TEST_CASE( testSharedLazyExactCountedOnce )
+{
+    // copies of a point share its lazy exact node
+    Point p( Kernel::FT( 1 ) / 3, Kernel::FT( 2 ) / 3 );
+    const algorithm::MemoryFootprint single = algorithm::memoryFootprint( p );
+
+    MultiPoint g ;
+
+    for ( int i = 0; i < 10; i++ ) {
+        g.addGeometry( p );
+    }
+
+    algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( g );
+    BOOST_CHECK_EQUAL( footprint.exactBytes, single.exactBytes );
+    BOOST_CHECK_EQUAL( footprint.numLazyNodes, single.numLazyNodes );
+}
+
+BOOST_AUTO_TEST_CASE( testCompactExactReducesFootprint )
+{
+    // unevaluated constructions with integer results
+    const Kernel::Vector_2 v( Kernel::FT( 1 ), Kernel::FT( 2 ) );
+    LineString g( Point( Kernel::Point_2( Kernel::FT( 0 ), Kernel::FT( 0 ) ) + v ), Point( Kernel::Point_2( Kernel::FT( 3 ), Kernel::FT( 1 ) ) + v ) );
+
+    const algorithm::MemoryFootprint before = algorithm::memoryFootprint( g );
+    BOOST_CHECK( before.exactBytes > 0 );
+    BOOST_CHECK_EQUAL( before.numLazyNodes, 2U );
+
+    // exact values are doubles
+    algorithm::compactExact( g );
+    const algorithm::MemoryFootprint after = algorithm::memoryFootprint( g );
+    BOOST_CHECK_EQUAL( after.exactBytes, 0U );
+    BOOST_CHECK_EQUAL( after.numLazyNodes, 0U );
+    BOOST_CHECK_LT( after.totalBytes(), before.totalBytes() );
+}
+
+BOOST_AUTO_TEST_CASE( testCompactExactEvaluatesLazyNodes )
+{
+    const Kernel::Vector_2 v( Kernel::FT( 1 ) / 3, Kernel::FT( 1 ) / 7 );
+    LineString g( Point( Kernel::Point_2( Kernel::FT( 0 ), Kernel::FT( 0 ) ) + v ), Point( Kernel::Point_2( Kernel::FT( 3 ), Kernel::FT( 1 ) ) + v ) );
+    BOOST_CHECK_EQUAL( algorithm::memoryFootprint( g ).numLazyNodes, 2U );
+
+    // exact values kept, histories dropped
+    algorithm::compactExact( g );
+    const algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( g );
+    BOOST_CHECK( footprint.exactBytes > 0 );
+    BOOST_CHECK_EQUAL( footprint.numLazyNodes, 0U );
+}
+
+BOOST_AUTO_TEST_CASE( testSolid )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "SOLID((((0 0 0,0 1 0,1 1 0,1 0 0,0 0 0)),((0 0 0,0 0 1,0 1 1,0 1 0,0 0 0)),((0 0 0,1 0 0,1 0 1,0 0 1,0 0 0)),((1 1 1,0 1 1,0 0 1,1 0 1,1 1 1)),((1 1 1,1 0 1,1 0 0,1 1 0,1 1 1)),((1 1 1,1 1 0,0 1 0,0 1 1,1 1 1))))" ) );
+    algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( *g );
+
+    // 6 polygons with a ring of 5 points
+    const size_t polygonBytes = sizeof( Polygon ) + sizeof( LineString* ) + sizeof( LineString ) + 5 * sizeof( Point ) ;
+    BOOST_CHECK( footprint.structuralBytes > 6 * polygonBytes );
+}
+
+BOOST_AUTO_TEST_CASE( testTriangulatedSurfaceSharedVertices )
+{
+    TriangulatedSurface g ;
+    const size_t a = g.addVertex( Point( 0.0,0.0 ) );
+    const size_t b = g.addVertex( Point( 1.0,0.0 ) );
+    const size_t c = g.addVertex( Point( 1.0,1.0 ) );
+    const size_t d = g.addVertex( Point( 0.0,1.0 ) );
+    g.addTriangle( a, b, c );
+    g.addTriangle( a, c, d );
+
+    algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( g );
+    BOOST_CHECK_EQUAL( footprint.structuralBytes, sizeof( TriangulatedSurface ) + 4 * sizeof( Point ) + 6 * sizeof( size_t ) );
+}
+
+BOOST_AUTO_TEST_CASE( testPreparedGeometry )
+{
+    PreparedGeometry prepared( io::readWkt( "POINT(1 2)" ) );
+    algorithm::MemoryFootprint footprint = algorithm::memoryFootprint( prepared );
+    BOOST_CHECK_EQUAL( footprint.structuralBytes, sizeof( PreparedGeometry ) + sizeof( Point ) );
+}
+
+BOOST_AUTO_TEST_CASE( testPreparedGeometryCaches )
+{
+    PreparedGeometry prepared( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(2 2,2 4,4 4,4 2,2 2))" ) );
+    const algorithm::MemoryFootprint unprepared = algorithm::memoryFootprint( prepared );
+
+    prepared.geometrySet2D();
+    const algorithm::MemoryFootprint prepared2D = algorithm::memoryFootprint( prepared );
+    BOOST_CHECK_GT( prepared2D.structuralBytes, unprepared.structuralBytes );
+    BOOST_CHECK_GE( prepared2D.exactBytes, unprepared.exactBytes );
+
+    prepared.geometrySet3D();
+    const algorithm::MemoryFootprint prepared3D = algorithm::memoryFootprint( prepared );
+    BOOST_CHECK_GT( prepared3D.structuralBytes, prepared2D.structuralBytes );
+    BOOST_CHECK_GE( prepared3D.exactBytes, prepared2D.exactBytes );
+}
+
+BOOST_AUTO_TEST_CASE( testPreparedGeometrySharedLazyExact )
+{
+    // the decomposition copies the exact points of the geometry
+    PreparedGeometry prepared( new Point( Kernel::FT( 1 ) / 3, Kernel::FT( 2 ) / 3 ) );
+    const algorithm::MemoryFootprint unprepared = algorithm::memoryFootprint( prepared );
+
+    prepared.geometrySet2D();
+    const algorithm::MemoryFootprint prepared2D = algorithm::memoryFootprint( prepared );
+    BOOST_CHECK_EQUAL( prepared2D.exactBytes, unprepared.exactBytes );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
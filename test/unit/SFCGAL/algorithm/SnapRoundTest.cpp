@@ -0,0 +1,169 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Kernel.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/Triangle.h>
+#include <SFCGAL/MultiLineString.h>
+#include <SFCGAL/MultiPolygon.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/snapRound.h>
+#include <SFCGAL/algorithm/intersection.h>
+#include <SFCGAL/algorithm/difference.h>
+#include <SFCGAL/algorithm/isValid.h>
+
+#include <SFCGAL/detail/tools/Registry.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_SnapRoundTest )
+
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    tools::Registry& registry = tools::Registry::instance() ;
+    std::vector< std::string > typeNames = tools::Registry::instance().getGeometryTypes();
+
+    for ( size_t i = 0; i < typeNames.size(); i++ ) {
+        BOOST_TEST_MESSAGE( typeNames[i] ) ;
+
+        std::auto_ptr< Geometry > g( registry.newGeometryByTypeName( typeNames[i] ) ) ;
+        BOOST_REQUIRE( g.get() != NULL ) ;
+        algorithm::snapRound( *g, 100 );
+        BOOST_CHECK( g->isEmpty() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( testSnapRound )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(0.123 0.456,0.124 0.455,1.5 2.25)" ) );
+    algorithm::snapRound( *g, 100 );
+
+    // the second point collapses on the first one
+    BOOST_REQUIRE_EQUAL( g->as< LineString >().numPoints(), 2U );
+    BOOST_CHECK_EQUAL( g->as< LineString >().pointN( 0 ).x(), Kernel::FT( 12 ) / 100 );
+    BOOST_CHECK_EQUAL( g->as< LineString >().pointN( 0 ).y(), Kernel::FT( 46 ) / 100 );
+    BOOST_CHECK_EQUAL( g->asText( 2 ), "LINESTRING(0.12 0.46,1.50 2.25)" );
+}
+
+BOOST_AUTO_TEST_CASE( testCollapsedLineString )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(0.001 0.001,0.002 0.002)" ) );
+    algorithm::snapRound( *g, 100 );
+    BOOST_CHECK( g->isEmpty() );
+
+    std::auto_ptr< Geometry > multi( io::readWkt( "MULTILINESTRING((0 0,1 1),(0.001 0.001,0.002 0.002))" ) );
+    algorithm::snapRound( *multi, 100 );
+    BOOST_CHECK_EQUAL( multi->asText( 0 ), "MULTILINESTRING((0 0,1 1))" );
+}
+
+BOOST_AUTO_TEST_CASE( testCollapsedRings )
+{
+    // the hole collapses to a point
+    std::auto_ptr< Geometry > g( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0),(1 1,1.001 1,1.001 1.001,1 1))" ) );
+    algorithm::snapRound( *g, 100 );
+    BOOST_REQUIRE( g->is< Polygon >() );
+    BOOST_CHECK_EQUAL( g->as< Polygon >().numInteriorRings(), 0U );
+
+    // the exterior ring collapses to a segment (3 points)
+    std::auto_ptr< Geometry > sliver( io::readWkt( "POLYGON((0 0,1 0,1 0.001,0 0))" ) );
+    algorithm::snapRound( *sliver, 100 );
+    BOOST_CHECK( sliver->isEmpty() );
+
+    std::auto_ptr< Geometry > multi( io::readWkt( "MULTIPOLYGON(((0 0,1 0,1 1,0 0)),((5 5,5.001 5,5.001 5.001,5 5)))" ) );
+    algorithm::snapRound( *multi, 100 );
+    BOOST_CHECK_EQUAL( multi->asText( 0 ), "MULTIPOLYGON(((0 0,1 0,1 1,0 0)))" );
+}
+
+BOOST_AUTO_TEST_CASE( testCollapsedTriangles )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "TRIANGLE((0 0,1 0,0.5 0.001,0 0))" ) );
+    algorithm::snapRound( *g, 100 );
+    BOOST_CHECK( g->isEmpty() );
+
+    std::auto_ptr< Geometry > tin( io::readWkt( "TIN(((0 0,1 0,0 1,0 0)),((0 0,1 0,0.5 -0.001,0 0)))" ) );
+    algorithm::snapRound( *tin, 100 );
+    BOOST_REQUIRE( tin->is< TriangulatedSurface >() );
+    BOOST_CHECK_EQUAL( tin->as< TriangulatedSurface >().numTriangles(), 1U );
+    BOOST_CHECK_EQUAL( tin->asText( 0 ), "TIN(((0 0,1 0,0 1,0 0)))" );
+}
+
+BOOST_AUTO_TEST_CASE( testCollapsedCollectionParts )
+{
+    // empty parts of the input are kept, collapsed parts are removed
+    std::auto_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT EMPTY,LINESTRING(0 0,0.001 0),POINT(1 1))" ) );
+    algorithm::snapRound( *g, 100 );
+    BOOST_REQUIRE_EQUAL( g->numGeometries(), 2U );
+    BOOST_CHECK( g->geometryN( 0 ).isEmpty() );
+    BOOST_CHECK_EQUAL( g->geometryN( 1 ).asText( 0 ), "POINT(1 1)" );
+}
+
+BOOST_AUTO_TEST_CASE( testInvalidScale )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "POINT(0.5 0.5)" ) );
+    BOOST_CHECK_THROW( algorithm::snapRound( *g, 0 ), Exception );
+    BOOST_CHECK_THROW( algorithm::setFixedPrecision( -1 ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testFixedPrecisionIntersection )
+{
+    BOOST_CHECK_EQUAL( algorithm::fixedPrecision(), 0 );
+    algorithm::setFixedPrecision( 100 );
+
+    // (3/7 1/7) is snapped to (0.43 0.14)
+    std::auto_ptr< Geometry > ga( io::readWkt( "LINESTRING(0 0,3 1)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "LINESTRING(0 1,1 -1)" ) );
+    std::auto_ptr< Geometry > result( algorithm::intersection( *ga, *gb ) );
+
+    algorithm::setFixedPrecision( 0 );
+
+    BOOST_REQUIRE( result->is< Point >() );
+    BOOST_CHECK_EQUAL( result->as< Point >().x(), Kernel::FT( 43 ) / 100 );
+    BOOST_CHECK_EQUAL( result->as< Point >().y(), Kernel::FT( 14 ) / 100 );
+}
+
+// the results are not validated again after the snapping
+BOOST_AUTO_TEST_CASE( testFixedPrecisionMayInvalidate )
+{
+    // the hole is 0.2 away from the exterior ring
+    std::auto_ptr< Geometry > ga( io::readWkt( "POLYGON((0 0,10 0,10 10,0 10,0 0))" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "POLYGON((2 0.2,8 0.2,8 5,2 5,2 0.2))" ) );
+
+    std::auto_ptr< Geometry > exact( algorithm::difference( *ga, *gb ) );
+    BOOST_CHECK( algorithm::isValid( *exact ) );
+
+    // the hole is snapped on the exterior ring
+    algorithm::setFixedPrecision( 1 );
+    std::auto_ptr< Geometry > result( algorithm::difference( *ga, *gb ) );
+    algorithm::setFixedPrecision( 0 );
+
+    BOOST_REQUIRE( result->is< Polygon >() );
+    BOOST_CHECK_EQUAL( result->as< Polygon >().numRings(), 2U );
+    BOOST_CHECK( ! algorithm::isValid( *result ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/solidBoolean.h>
+#include <SFCGAL/algorithm/volume.h>
+#include <SFCGAL/algorithm/covers.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_SolidBooleanTest )
+
+namespace {
+
+std::auto_ptr< Solid > cube( const double& xmin, const double& size )
+{
+    return Envelope( xmin, xmin + size, xmin, xmin + size, xmin, xmin + size ).toSolid();
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( testOverlappingCubes )
+{
+    std::auto_ptr< Solid > a( cube( 0.0, 1.0 ) );
+    std::auto_ptr< Solid > b( cube( 0.5, 1.0 ) );
+
+    std::auto_ptr< Geometry > u( algorithm::solidBoolean( *a, *b, algorithm::SOLID_UNION ) );
+    BOOST_REQUIRE_EQUAL( u->geometryTypeId(), TYPE_SOLID );
+    BOOST_CHECK_EQUAL( algorithm::volume( *u ), Kernel::FT( 1.875 ) );
+    BOOST_CHECK( algorithm::covers3D( *u, *a ) && algorithm::covers3D( *u, *b ) );
+
+    std::auto_ptr< Geometry > i( algorithm::solidBoolean( *a, *b, algorithm::SOLID_INTERSECTION ) );
+    BOOST_REQUIRE_EQUAL( i->geometryTypeId(), TYPE_SOLID );
+    BOOST_CHECK_EQUAL( algorithm::volume( *i ), Kernel::FT( 0.125 ) );
+    BOOST_CHECK( algorithm::covers3D( *i, *cube( 0.5, 0.5 ) ) );
+
+    std::auto_ptr< Geometry > d( algorithm::solidBoolean( *a, *b, algorithm::SOLID_DIFFERENCE ) );
+    BOOST_REQUIRE_EQUAL( d->geometryTypeId(), TYPE_SOLID );
+    BOOST_CHECK_EQUAL( algorithm::volume( *d ), Kernel::FT( 0.875 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testDisjointCubes )
+{
+    std::auto_ptr< Solid > a( cube( 0.0, 1.0 ) );
+    std::auto_ptr< Solid > b( cube( 2.0, 1.0 ) );
+
+    std::auto_ptr< Geometry > u( algorithm::solidBoolean( *a, *b, algorithm::SOLID_UNION ) );
+    BOOST_REQUIRE_EQUAL( u->geometryTypeId(), TYPE_MULTISOLID );
+    BOOST_CHECK_EQUAL( u->numGeometries(), 2U );
+
+    std::auto_ptr< Geometry > i( algorithm::solidBoolean( *a, *b, algorithm::SOLID_INTERSECTION ) );
+    BOOST_CHECK( i->isEmpty() );
+
+    std::auto_ptr< Geometry > d( algorithm::solidBoolean( *a, *b, algorithm::SOLID_DIFFERENCE ) );
+    BOOST_REQUIRE_EQUAL( d->geometryTypeId(), TYPE_SOLID );
+    BOOST_CHECK_EQUAL( algorithm::volume( *d ), Kernel::FT( 1 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testCavity )
+{
+    std::auto_ptr< Solid > a( cube( 0.0, 3.0 ) );
+    std::auto_ptr< Solid > b( cube( 1.0, 1.0 ) );
+
+    // b is inside a : the difference has an interior shell
+    std::auto_ptr< Geometry > d( algorithm::solidBoolean( *a, *b, algorithm::SOLID_DIFFERENCE ) );
+    BOOST_REQUIRE_EQUAL( d->geometryTypeId(), TYPE_SOLID );
+    BOOST_CHECK_EQUAL( d->as< Solid >().numInteriorShells(), 1U );
+
+    std::auto_ptr< Geometry > u( algorithm::solidBoolean( *a, *b, algorithm::SOLID_UNION ) );
+    BOOST_CHECK_EQUAL( algorithm::volume( *u ), Kernel::FT( 27 ) );
+
+    // solids with interior shells are not supported as inputs
+    BOOST_CHECK_THROW( algorithm::solidBoolean( d->as< Solid >(), *b, algorithm::SOLID_UNION ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    std::auto_ptr< Solid > a( cube( 0.0, 1.0 ) );
+    const Solid empty ;
+
+    BOOST_CHECK_EQUAL( algorithm::volume( *algorithm::solidBoolean( *a, empty, algorithm::SOLID_UNION ) ), Kernel::FT( 1 ) );
+    BOOST_CHECK_EQUAL( algorithm::volume( *algorithm::solidBoolean( empty, *a, algorithm::SOLID_UNION ) ), Kernel::FT( 1 ) );
+    BOOST_CHECK( algorithm::solidBoolean( *a, empty, algorithm::SOLID_INTERSECTION )->isEmpty() );
+    BOOST_CHECK_EQUAL( algorithm::volume( *algorithm::solidBoolean( *a, empty, algorithm::SOLID_DIFFERENCE ) ), Kernel::FT( 1 ) );
+    BOOST_CHECK( algorithm::solidBoolean( empty, *a, algorithm::SOLID_DIFFERENCE )->isEmpty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,220 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Point.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Polygon.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/spatialJoin.h>
+#include <SFCGAL/algorithm/intersects.h>
+#include <SFCGAL/algorithm/covers.h>
+
+using namespace boost::unit_test ;
+using namespace SFCGAL ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_algorithm_SpatialJoinTest )
+
+namespace {
+
+typedef std::vector< std::pair< size_t, size_t > > PairCollection ;
+
+// squares of size 1.5 on a regular grid, with some empty geometries
+std::auto_ptr< GeometryCollection > makeGrid( const double& offset, const size_t& n )
+{
+    std::auto_ptr< GeometryCollection > grid( new GeometryCollection );
+
+    for ( size_t i = 0; i < n; i++ ) {
+        for ( size_t j = 0; j < n; j++ ) {
+            const double x = offset + 2.0 * i ;
+            const double y = offset + 2.0 * j ;
+            grid->addGeometry( Envelope( x, x + 1.5, y, y + 1.5 ).toPolygon().release() );
+        }
+
+        grid->addGeometry( new Polygon() );
+    }
+
+    return grid ;
+}
+
+// the pairs found by a loop on all the pairs
+PairCollection bruteForce( const GeometryCollection& a, const GeometryCollection& b, const algorithm::SpatialJoinPredicate& predicate )
+{
+    PairCollection pairs ;
+
+    for ( size_t i = 0; i < a.numGeometries(); i++ ) {
+        for ( size_t j = 0; j < b.numGeometries(); j++ ) {
+            const Geometry& ga = a.geometryN( i );
+            const Geometry& gb = b.geometryN( j );
+            bool result = false ;
+
+            switch ( predicate ) {
+            case algorithm::JOIN_INTERSECTS:
+                result = algorithm::intersects( ga, gb );
+                break;
+
+            case algorithm::JOIN_INTERSECTS_3D:
+                result = algorithm::intersects3D( ga, gb );
+                break;
+
+            case algorithm::JOIN_COVERS:
+                result = algorithm::covers( ga, gb );
+                break;
+
+            case algorithm::JOIN_COVERS_3D:
+                result = algorithm::covers3D( ga, gb );
+                break;
+            }
+
+            if ( result ) {
+                pairs.push_back( std::make_pair( i, j ) );
+            }
+        }
+    }
+
+    return pairs ;
+}
+
+// counts the visited pairs
+class PairCounter : public algorithm::SpatialJoinVisitor {
+public:
+    PairCounter():
+        count( 0 ) {
+    }
+
+    virtual void visit( const size_t& /*i*/, const size_t& /*j*/ ) {
+        count++ ;
+    }
+
+    size_t count ;
+};
+
+}
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    GeometryCollection a, b ;
+    a.addGeometry( Point() );
+
+    PairCollection pairs ;
+    algorithm::spatialJoin( a, b, algorithm::JOIN_INTERSECTS, pairs );
+    BOOST_CHECK( pairs.empty() );
+
+    b.addGeometry( Point() );
+    algorithm::spatialJoin( a, b, algorithm::JOIN_INTERSECTS, pairs );
+    BOOST_CHECK( pairs.empty() );
+}
+
+BOOST_AUTO_TEST_CASE( testIntersects )
+{
+    std::auto_ptr< GeometryCollection > a( makeGrid( 0.0, 6 ) );
+    std::auto_ptr< GeometryCollection > b( makeGrid( 1.0, 5 ) );
+
+    PairCollection pairs ;
+    algorithm::spatialJoin( *a, *b, algorithm::JOIN_INTERSECTS, pairs );
+    BOOST_CHECK( ! pairs.empty() );
+    BOOST_CHECK( pairs == bruteForce( *a, *b, algorithm::JOIN_INTERSECTS ) );
+}
+
+BOOST_AUTO_TEST_CASE( testTouching )
+{
+    std::auto_ptr< Geometry > a( io::readWkt( "GEOMETRYCOLLECTION(POLYGON((0 0,1 0,1 1,0 1,0 0)),LINESTRING(3 0,3 1))" ) );
+    std::auto_ptr< Geometry > b( io::readWkt( "GEOMETRYCOLLECTION(POINT(1 1),POINT(2 2),LINESTRING(2 0.5,3 0.5),LINESTRING(-1 2,2 -1))" ) );
+
+    PairCollection pairs ;
+    algorithm::spatialJoin( a->as< GeometryCollection >(), b->as< GeometryCollection >(), algorithm::JOIN_INTERSECTS, pairs );
+    // LINESTRING(-1 2,2 -1) intersects the polygon
+    BOOST_REQUIRE_EQUAL( pairs.size(), 3U );
+    BOOST_CHECK( pairs[0] == std::make_pair( size_t( 0 ), size_t( 0 ) ) );
+    BOOST_CHECK( pairs[1] == std::make_pair( size_t( 0 ), size_t( 3 ) ) );
+    BOOST_CHECK( pairs[2] == std::make_pair( size_t( 1 ), size_t( 2 ) ) );
+}
+
+BOOST_AUTO_TEST_CASE( testIntersects3D )
+{
+    std::auto_ptr< Geometry > a( io::readWkt( "GEOMETRYCOLLECTION(LINESTRING(0 0 0,1 1 0),LINESTRING(0 0 1,1 1 1),POLYGON((0 0,1 0,1 1,0 1,0 0)))" ) );
+    std::auto_ptr< Geometry > b( io::readWkt( "GEOMETRYCOLLECTION(LINESTRING(0 1 0,1 0 0),POINT(0.5 0.5 1),POINT(0.5 0.5))" ) );
+
+    PairCollection pairs ;
+    algorithm::spatialJoin( a->as< GeometryCollection >(), b->as< GeometryCollection >(), algorithm::JOIN_INTERSECTS_3D, pairs );
+    BOOST_CHECK( pairs == bruteForce( a->as< GeometryCollection >(), b->as< GeometryCollection >(), algorithm::JOIN_INTERSECTS_3D ) );
+    BOOST_CHECK_EQUAL( pairs.size(), 5U );
+
+    // in 2D, every pair intersects
+    algorithm::spatialJoin( a->as< GeometryCollection >(), b->as< GeometryCollection >(), algorithm::JOIN_INTERSECTS, pairs );
+    BOOST_CHECK_EQUAL( pairs.size(), 9U );
+}
+
+BOOST_AUTO_TEST_CASE( testCovers )
+{
+    std::auto_ptr< GeometryCollection > a( makeGrid( 0.0, 4 ) );
+    std::auto_ptr< Geometry > b( io::readWkt( "GEOMETRYCOLLECTION(POINT(0.5 0.5),POINT(1.75 1.75),LINESTRING(2 2,3 3),LINESTRING(0 0,3 3),POLYGON((0 0,1.5 0,1.5 1.5,0 1.5,0 0)))" ) );
+
+    PairCollection pairs ;
+    algorithm::spatialJoin( *a, b->as< GeometryCollection >(), algorithm::JOIN_COVERS, pairs );
+    BOOST_CHECK_EQUAL( pairs.size(), 3U );
+    BOOST_CHECK( pairs == bruteForce( *a, b->as< GeometryCollection >(), algorithm::JOIN_COVERS ) );
+}
+
+// more candidates of b than prepared geometries kept by the join : they are prepared again
+BOOST_AUTO_TEST_CASE( testManyCandidates )
+{
+    GeometryCollection a, b ;
+    a.addGeometry( Envelope( 0.0, 100.0, 0.0, 100.0 ).toPolygon().release() );
+    a.addGeometry( Envelope( 50.0, 150.0, 0.0, 100.0 ).toPolygon().release() );
+
+    for ( int i = 0; i < 40; i++ ) {
+        for ( int j = 0; j < 40; j++ ) {
+            b.addGeometry( new Point( 0.5 + 2.0 * i, 0.5 + 2.0 * j ) );
+        }
+    }
+
+    PairCollection pairs ;
+    algorithm::spatialJoin( a, b, algorithm::JOIN_INTERSECTS, pairs );
+    BOOST_CHECK_EQUAL( pairs.size(), 1600U + 15U * 40U );
+    BOOST_CHECK( pairs == bruteForce( a, b, algorithm::JOIN_INTERSECTS ) );
+
+    algorithm::spatialJoin( a, b, algorithm::JOIN_COVERS, pairs );
+    BOOST_CHECK( pairs == bruteForce( a, b, algorithm::JOIN_COVERS ) );
+}
+
+BOOST_AUTO_TEST_CASE( testVisitor )
+{
+    std::auto_ptr< GeometryCollection > a( makeGrid( 0.0, 6 ) );
+    std::auto_ptr< GeometryCollection > b( makeGrid( 1.0, 5 ) );
+
+    std::vector< const Geometry* > aparts, bparts ;
+
+    for ( size_t i = 0; i < a->numGeometries(); i++ ) {
+        aparts.push_back( &a->geometryN( i ) );
+    }
+
+    for ( size_t i = 0; i < b->numGeometries(); i++ ) {
+        bparts.push_back( &b->geometryN( i ) );
+    }
+
+    PairCounter counter ;
+    algorithm::spatialJoin( aparts, bparts, algorithm::JOIN_INTERSECTS, counter );
+    BOOST_CHECK_EQUAL( counter.count, bruteForce( *a, *b, algorithm::JOIN_INTERSECTS ).size() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,11 +18,18 @@
  *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
  */
 #include <SFCGAL/Exception.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/ExecutionPolicy.h>
+#include <SFCGAL/GeometryCollection.h>
+#include <SFCGAL/LineString.h>
+#include <SFCGAL/Point.h>
 #include <SFCGAL/algorithm/isValid.h>
 #include <SFCGAL/algorithm/union.h>
+#include <SFCGAL/algorithm/UnionAccumulator.h>
 #include <SFCGAL/algorithm/volume.h>
 #include <SFCGAL/algorithm/translate.h>
 #include <SFCGAL/algorithm/area.h>
+#include <SFCGAL/algorithm/length.h>
 #include <SFCGAL/detail/tools/Registry.h>
 #include <SFCGAL/algorithm/tesselate.h>
 #include <SFCGAL/triangulate/triangulatePolygon.h>
@@ -397,5 +404,177 @@ BOOST_AUTO_TEST_CASE( VolumeVolume )
     }
 }
 
-BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_CASE( UnaryUnionEmpty )
+{
+    std::auto_ptr<Geometry> u = algorithm::unaryUnion( *io::readWkt( "GEOMETRYCOLLECTION EMPTY" ) );
+    BOOST_CHECK( u->isEmpty() );
+
+    u = algorithm::unaryUnion( *io::readWkt( "GEOMETRYCOLLECTION(POINT EMPTY,POLYGON((0 0,1 0,1 1,0 1,0 0)))" ) );
+    BOOST_CHECK_EQUAL( algorithm::area( *u ), 1.0 );
+}
+
+BOOST_AUTO_TEST_CASE( UnaryUnionGrid )
+{
+    // 10x10 adjacent unit squares, dissolved in a single square
+    GeometryCollection grid;
+
+    for ( int i = 0; i < 10; i++ ) {
+        for ( int j = 0; j < 10; j++ ) {
+            grid.addGeometry( Envelope( i, i + 1, j, j + 1 ).toPolygon().release() );
+        }
+    }
+
+    const size_t numThreads[] = { 1, 4, 3, 0 };
+    // parallel execution requires CGAL with thread support
+    const size_t numCases = ExecutionPolicy::parallelSupported() ? 4 : 1 ;
+
+    if ( ! ExecutionPolicy::parallelSupported() ) {
+        BOOST_CHECK_THROW( algorithm::unaryUnion( grid, 4 ), NotImplementedException );
+    }
+
+    for ( size_t i = 0; i < numCases; i++ ) {
+        std::auto_ptr<Geometry> u = algorithm::unaryUnion( grid, numThreads[i] );
+        BOOST_CHECK_EQUAL( algorithm::area( *u ), 100.0 );
+        BOOST_CHECK( u->geometryTypeId() == TYPE_POLYGON );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( UnionList )
+{
+    std::auto_ptr<Geometry> a = io::readWkt( "POLYGON((0 0,2 0,2 2,0 2,0 0))" );
+    std::auto_ptr<Geometry> b = io::readWkt( "POLYGON((1 1,3 1,3 3,1 3,1 1))" );
+    std::auto_ptr<Geometry> c = io::readWkt( "POLYGON((10 10,11 10,11 11,10 11,10 10))" );
+    std::auto_ptr<Geometry> d = io::readWkt( "POINT(0.5 0.5)" );
+
+    std::vector< const Geometry* > geometries;
+    geometries.push_back( a.get() );
+    geometries.push_back( b.get() );
+    geometries.push_back( c.get() );
+    geometries.push_back( d.get() );
+
+    std::auto_ptr<Geometry> u = algorithm::union_( geometries );
+    BOOST_CHECK_EQUAL( algorithm::area( *u ), 8.0 );
+
+    // same as the binary union
+    std::auto_ptr<Geometry> ab = algorithm::union_( *a, *b );
+    std::auto_ptr<Geometry> abc = algorithm::union_( *ab, *c );
+    BOOST_CHECK( algorithm::area( *algorithm::union_( *abc, *d ) ) == algorithm::area( *u ) );
+}
 
+BOOST_AUTO_TEST_CASE( UnionListInvalid )
+{
+    std::auto_ptr<Geometry> a = io::readWkt( "POLYGON((0 0,2 0,2 2,0 2,0 0))" );
+    std::auto_ptr<Geometry> b = io::readWkt( "POLYGON((0 0,1 1,1 0,0 1,0 0))" );
+
+    std::vector< const Geometry* > geometries;
+    geometries.push_back( a.get() );
+    geometries.push_back( b.get() );
+
+    BOOST_CHECK_THROW( algorithm::union_( geometries ), GeometryInvalidityException );
+    BOOST_CHECK_THROW( algorithm::union_( geometries, 2 ), GeometryInvalidityException );
+}
+
+BOOST_AUTO_TEST_CASE( UnaryUnion3D )
+{
+    std::auto_ptr<Geometry> u = algorithm::unaryUnion3D( *io::readWkt( "MULTILINESTRING((0 0 0,2 0 0),(1 0 0,3 0 0),(0 0 1,1 1 1))" ) );
+    BOOST_CHECK( u->is3D() );
+    // the overlapping part is counted once
+    BOOST_CHECK_CLOSE( algorithm::length3D( *u ), 3.0 + sqrt( 2.0 ), 1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAccumulatorGrid )
+{
+    // 10x10 adjacent unit squares, streamed one by one
+    algorithm::UnionAccumulator accumulator;
+    BOOST_CHECK( accumulator.isEmpty() );
+
+    for ( int i = 0; i < 10; i++ ) {
+        for ( int j = 0; j < 10; j++ ) {
+            accumulator.add( *Envelope( i, i + 1, j, j + 1 ).toPolygon() );
+        }
+    }
+
+    accumulator.add( *io::readWkt( "POINT EMPTY" ) );
+    BOOST_CHECK( ! accumulator.isEmpty() );
+
+    std::auto_ptr<Geometry> u = accumulator.finish();
+    BOOST_CHECK_EQUAL( algorithm::area( *u ), 100.0 );
+    BOOST_CHECK( u->geometryTypeId() == TYPE_POLYGON );
+    BOOST_CHECK( accumulator.isEmpty() );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAccumulatorMixed )
+{
+    algorithm::UnionAccumulator accumulator;
+    accumulator.add( *io::readWkt( "POLYGON((0 0,2 0,2 2,0 2,0 0))" ) );
+    // on the polygon
+    accumulator.add( *io::readWkt( "POINT(1 1)" ) );
+    // partly on the polygon
+    accumulator.add( *io::readWkt( "LINESTRING(1 1,5 1)" ) );
+    accumulator.add( *io::readWkt( "LINESTRING(4 1,6 1)" ) );
+
+    std::auto_ptr<Geometry> u = accumulator.finish();
+    BOOST_CHECK_EQUAL( algorithm::area( *u ), 4.0 );
+    BOOST_CHECK_EQUAL( algorithm::length( *u ), 4.0 );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAccumulatorSegmentStream )
+{
+    // overlapping segments and repeated points, merged by finish()
+    algorithm::UnionAccumulator accumulator;
+
+    for ( int i = 0; i < 100; i++ ) {
+        accumulator.add( LineString( Point( double( i ), 0.0 ), Point( double( i + 2 ), 0.0 ) ) );
+        accumulator.add( Point( 0.0, 5.0 ) );
+    }
+
+    BOOST_CHECK( ! accumulator.isEmpty() );
+
+    std::auto_ptr<Geometry> u = accumulator.finish();
+    BOOST_CHECK_EQUAL( algorithm::length( *u ), 101.0 );
+    BOOST_CHECK( accumulator.isEmpty() );
+
+    size_t numPoints = 0;
+
+    for ( size_t i = 0; i < u->numGeometries(); i++ ) {
+        numPoints += u->geometryN( i ).is< Point >() ? 1 : 0;
+    }
+
+    BOOST_CHECK_EQUAL( numPoints, 1U );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAccumulatorMerge )
+{
+    algorithm::UnionAccumulator left, right;
+    left.add( *io::readWkt( "POLYGON((0 0,2 0,2 2,0 2,0 0))" ) );
+    right.add( *io::readWkt( "POLYGON((1 1,3 1,3 3,1 3,1 1))" ) );
+    right.add( *io::readWkt( "LINESTRING(0 5,1 5)" ) );
+
+    left.merge( right );
+    BOOST_CHECK( ! right.isEmpty() );
+
+    std::auto_ptr<Geometry> u = left.finish();
+    BOOST_CHECK_EQUAL( algorithm::area( *u ), 7.0 );
+    BOOST_CHECK_EQUAL( algorithm::length( *u ), 1.0 );
+
+    algorithm::UnionAccumulator accumulator3D( true );
+    BOOST_CHECK_THROW( left.merge( accumulator3D ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( UnionAccumulator3D )
+{
+    algorithm::UnionAccumulator accumulator( true );
+    accumulator.add( *io::readWkt( "LINESTRING(0 0 0,2 0 0)" ) );
+    accumulator.add( *io::readWkt( "LINESTRING(1 0 0,3 0 0)" ) );
+
+    algorithm::UnionAccumulator other( true );
+    other.add( *io::readWkt( "LINESTRING(0 0 1,1 1 1)" ) );
+    accumulator.merge( other );
+
+    std::auto_ptr<Geometry> u = accumulator.finish();
+    BOOST_CHECK( u->is3D() );
+    // the overlapping part is counted once
+    BOOST_CHECK_CLOSE( algorithm::length3D( *u ), 3.0 + sqrt( 2.0 ), 1e-9 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
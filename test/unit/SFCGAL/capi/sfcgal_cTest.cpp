@@ -31,6 +31,8 @@
 #include <SFCGAL/MultiPolygon.h>
 #include <SFCGAL/MultiSolid.h>
 #include <SFCGAL/io/wkt.h>
+#include <SFCGAL/GeometryArena.h>
+#include <SFCGAL/algorithm/orientation.h>
 
 #include <boost/test/unit_test.hpp>
 
@@ -74,6 +76,127 @@ BOOST_AUTO_TEST_CASE( testErrorOnBadGeometryType )
     BOOST_CHECK( hasError == true );
 }
 
+BOOST_AUTO_TEST_CASE( testArena )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    hasError = false;
+    sfcgal_arena_t* arena = sfcgal_arena_create();
+
+    // an error instead of silently allocating on the heap
+    if ( ! sfcgal_arena_enabled() ) {
+        BOOST_CHECK( arena == NULL );
+        BOOST_CHECK( hasError );
+
+        hasError = false;
+        BOOST_CHECK_EQUAL( sfcgal_arena_activate( arena ), 0 );
+        BOOST_CHECK( hasError );
+        BOOST_CHECK( GeometryArena::current() == NULL );
+        return ;
+    }
+
+    BOOST_REQUIRE( arena != NULL );
+    BOOST_CHECK_EQUAL( sfcgal_arena_activate( arena ), 1 );
+    BOOST_CHECK( GeometryArena::current() == arena );
+
+    sfcgal_geometry_t* ls = sfcgal_linestring_create();
+    sfcgal_linestring_add_point( ls, sfcgal_point_create_from_xy( 0.0, 0.0 ) );
+    sfcgal_linestring_add_point( ls, sfcgal_point_create_from_xy( 1.0, 1.0 ) );
+    BOOST_CHECK( reinterpret_cast< GeometryArena* >( arena )->allocatedSize() > 0 );
+
+    sfcgal_arena_deactivate();
+    BOOST_CHECK( GeometryArena::current() == NULL );
+
+    BOOST_CHECK_EQUAL( sfcgal_linestring_num_points( ls ), 2U );
+    sfcgal_geometry_delete( ls );
+    sfcgal_arena_delete( arena );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testMemoryFootprint )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::auto_ptr<Geometry> a( io::readWkt( "LINESTRING(0 0,3 1)" ) );
+    std::auto_ptr<Geometry> b( io::readWkt( "LINESTRING(0 1,1 -1)" ) );
+
+    hasError = false;
+    sfcgal_geometry_t* g = sfcgal_geometry_intersection( a.get(), b.get() );
+    size_t structuralBytes = 0, exactBytes = 0;
+    sfcgal_geometry_memory_footprint( g, &structuralBytes, &exactBytes );
+    BOOST_CHECK( structuralBytes >= sizeof( Point ) );
+    BOOST_CHECK( exactBytes > 0 );
+
+    // exact value kept, history dropped
+    sfcgal_geometry_compact_exact( g, 0 );
+    size_t compactedExactBytes = 0;
+    sfcgal_geometry_memory_footprint( g, &structuralBytes, &compactedExactBytes );
+    BOOST_CHECK( compactedExactBytes > 0 );
+
+    // rounded to doubles
+    sfcgal_geometry_compact_exact( g, 1 );
+    sfcgal_geometry_memory_footprint( g, &structuralBytes, &exactBytes );
+    BOOST_CHECK_EQUAL( exactBytes, 0U );
+
+    sfcgal_prepared_geometry_t* prepared = sfcgal_prepared_geometry_create_from_geometry( g, 0 );
+    size_t preparedStructuralBytes = 0;
+    sfcgal_prepared_geometry_memory_footprint( prepared, &preparedStructuralBytes, &exactBytes );
+    BOOST_CHECK( preparedStructuralBytes > structuralBytes );
+    sfcgal_prepared_geometry_delete( prepared );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testMemoryFootprintCompactExact )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    std::auto_ptr<Geometry> a( io::readWkt( "LINESTRING(0 0,2 2)" ) );
+    std::auto_ptr<Geometry> b( io::readWkt( "LINESTRING(0 2,2 0)" ) );
+
+    hasError = false;
+    sfcgal_geometry_t* g = sfcgal_geometry_intersection( a.get(), b.get() );
+    size_t structuralBytes = 0, exactBytes = 0;
+    sfcgal_geometry_memory_footprint( g, &structuralBytes, &exactBytes );
+    BOOST_CHECK( exactBytes > 0 );
+
+    // POINT(1 1) : the exact value is a double
+    sfcgal_geometry_compact_exact( g, 0 );
+    size_t compactedExactBytes = 0;
+    sfcgal_geometry_memory_footprint( g, &structuralBytes, &compactedExactBytes );
+    BOOST_CHECK_EQUAL( compactedExactBytes, 0U );
+    BOOST_CHECK_LT( compactedExactBytes, exactBytes );
+
+    sfcgal_geometry_delete( g );
+    BOOST_CHECK( hasError == false );
+}
+
+BOOST_AUTO_TEST_CASE( testForceLhrRhrTriangulatedSurface )
+{
+    sfcgal_set_error_handlers( printf, on_error );
+
+    // a clockwise and a counter clockwise triangle
+    std::auto_ptr<Geometry> g( io::readWkt( "TIN(((0 0,0 1,1 0,0 0)),((1 0,1 1,0 1,1 0)))" ) );
+
+    hasError = false;
+    std::auto_ptr<Geometry> lhr( reinterpret_cast< Geometry* >( sfcgal_geometry_force_lhr( g.get() ) ) );
+    std::auto_ptr<Geometry> rhr( reinterpret_cast< Geometry* >( sfcgal_geometry_force_rhr( g.get() ) ) );
+    BOOST_CHECK( hasError == false );
+
+    const TriangulatedSurface& lhrTin = lhr->as< TriangulatedSurface >();
+    const TriangulatedSurface& rhrTin = rhr->as< TriangulatedSurface >();
+    BOOST_REQUIRE_EQUAL( lhrTin.numTriangles(), 2U );
+    BOOST_REQUIRE_EQUAL( rhrTin.numTriangles(), 2U );
+
+    for ( size_t i = 0; i < 2; i++ ) {
+        BOOST_CHECK( algorithm::isCounterClockWiseOriented( lhrTin, i ) );
+        BOOST_CHECK( ! algorithm::isCounterClockWiseOriented( rhrTin, i ) );
+    }
+
+    // reoriented in the mesh
+    BOOST_CHECK( lhrTin.isIndexed() );
+    BOOST_CHECK_EQUAL( lhrTin.triangleN( 0 ).toTriangle().asText( 0 ), "TRIANGLE((0 0,1 0,0 1,0 0))" );
+}
+
 BOOST_AUTO_TEST_CASE( testStraightSkeletonPolygon )
 {
     sfcgal_set_error_handlers( printf, on_error );
@@ -0,0 +1,94 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/deepCopy.h>
+#include <SFCGAL/Coordinate.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/io/wkt.h>
+#include <SFCGAL/algorithm/translate.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_DeepCopyTest )
+
+BOOST_AUTO_TEST_CASE( testNumber )
+{
+    const Kernel::FT half = Kernel::FT( 1 ) / 2 ;
+    const Kernel::FT third = Kernel::FT( 1 ) / 3 ;
+
+    BOOST_CHECK_EQUAL( deepCopy( half ), half );
+    BOOST_CHECK_EQUAL( deepCopy( third ), third );
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+    // a new rational
+    BOOST_CHECK( CGAL::exact( deepCopy( third ) ).mpq() != CGAL::exact( third ).mpq() );
+#endif
+}
+
+BOOST_AUTO_TEST_CASE( testPrimitives )
+{
+    const Kernel::FT third = Kernel::FT( 1 ) / 3 ;
+    const Kernel::Point_2 a( third, Kernel::FT( 0 ) ), b( Kernel::FT( 1 ), third ), c( Kernel::FT( 0 ), Kernel::FT( 1 ) );
+
+    BOOST_CHECK_EQUAL( deepCopy( a ), a );
+    BOOST_CHECK_EQUAL( deepCopy( Kernel::Segment_2( a, b ) ), Kernel::Segment_2( a, b ) );
+
+    CGAL::Polygon_2< Kernel > ring ;
+    ring.push_back( a );
+    ring.push_back( b );
+    ring.push_back( c );
+    const CGAL::Polygon_with_holes_2< Kernel > polygon( ring );
+    const CGAL::Polygon_with_holes_2< Kernel > copy = deepCopy( polygon );
+    BOOST_CHECK( copy.outer_boundary() == ring );
+    BOOST_CHECK_EQUAL( copy.number_of_holes(), 0U );
+}
+
+BOOST_AUTO_TEST_CASE( testCoordinate )
+{
+    BOOST_CHECK( ! Coordinate( 1.0, 2.0 ).sharesLazyExact() );
+    BOOST_CHECK( ! Coordinate().sharesLazyExact() );
+
+    const Coordinate exact( Kernel::FT( 1 ) / 3, Kernel::FT( 2 ) );
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+    BOOST_CHECK( exact.sharesLazyExact() );
+#endif
+    BOOST_CHECK( exact.deepCopy() == exact );
+}
+
+BOOST_AUTO_TEST_CASE( testDeepClone )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT(1 2),TIN(((0 0,1 0,0 1,0 0)),((1 0,1 1,0 1,1 0))))" ) );
+    BOOST_CHECK( ! sharesLazyExact( *g ) );
+
+    algorithm::translate( *g, Kernel::Vector_2( Kernel::FT( 1 ) / 3, 0 ) );
+#ifndef SFCGAL_USE_INEXACT_KERNEL
+    BOOST_CHECK( sharesLazyExact( *g ) );
+#endif
+
+    std::auto_ptr< Geometry > clone( deepClone( *g ) );
+    BOOST_CHECK_EQUAL( clone->asText( 10 ), g->asText( 10 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/GeometrySet.h>
+#include <SFCGAL/Geometry.h>
+#include <SFCGAL/io/wkt.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+
+// always after CGAL
+using namespace boost::unit_test ;
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_GeometrySetTest )
+
+BOOST_AUTO_TEST_CASE( testDecomposeRemovesDuplicates )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT(1 1),POINT(0 0),POINT(1 1),LINESTRING(0 0,1 1,0 0,1 1))" ) );
+    GeometrySet< 2 > gs( *g );
+
+    BOOST_CHECK_EQUAL( gs.points().size(), 2U );
+    // (0 0,1 1) and (1 1,0 0) are different segments
+    BOOST_CHECK_EQUAL( gs.segments().size(), 2U );
+    BOOST_CHECK( gs.points().begin()->primitive() < ( gs.points().begin() + 1 )->primitive() );
+}
+
+BOOST_AUTO_TEST_CASE( testDecomposeTriangulatedSurface )
+{
+    // triangles sharing vertices (the vertices are converted once)
+    std::auto_ptr< Geometry > g( io::readWkt( "TIN(((0 0,1 0,0 1,0 0)),((1 0,1 1,0 1,1 0)))" ) );
+
+    GeometrySet< 2 > gs2( *g );
+    BOOST_REQUIRE_EQUAL( gs2.surfaces().size(), 2U );
+    BOOST_CHECK( gs2.surfaces()[0].primitive().outer_boundary().is_counterclockwise_oriented() );
+
+    GeometrySet< 3 > gs3( *g );
+    BOOST_REQUIRE_EQUAL( gs3.surfaces().size(), 2U );
+    BOOST_CHECK_EQUAL( gs3.surfaces()[0].primitive().vertex( 1 ), gs3.surfaces()[1].primitive().vertex( 0 ) );
+}
+
+BOOST_AUTO_TEST_CASE( testDecomposeLineString )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "LINESTRING(0 0,1 1,2 0,3 1)" ) );
+    GeometrySet< 2 > gs( *g );
+    BOOST_CHECK_EQUAL( gs.segments().size(), 3U );
+}
+
+BOOST_AUTO_TEST_CASE( testMerge )
+{
+    std::auto_ptr< Geometry > ga( io::readWkt( "MULTIPOINT(0 0,2 2)" ) );
+    std::auto_ptr< Geometry > gb( io::readWkt( "GEOMETRYCOLLECTION(POINT(1 1),POINT(2 2),TRIANGLE((0 0,1 0,0 1,0 0)))" ) );
+    GeometrySet< 2 > gs( *ga );
+    gs.merge( GeometrySet< 2 >( *gb ) );
+
+    BOOST_CHECK_EQUAL( gs.points().size(), 3U );
+    BOOST_CHECK_EQUAL( gs.surfaces().size(), 1U );
+}
+
+BOOST_AUTO_TEST_CASE( testComputeBoundingBoxes )
+{
+    std::auto_ptr< Geometry > g( io::readWkt( "GEOMETRYCOLLECTION(POINT(5 5),LINESTRING(0 0,1 1,2 0),TRIANGLE((0 0,1 0,0 1,0 0)))" ) );
+    GeometrySet< 2 > gs( *g );
+
+    HandleCollection< 2 >::Type handles ;
+    BoxCollection< 2 >::Type boxes ;
+    gs.computeBoundingBoxes( handles, boxes );
+
+    BOOST_REQUIRE_EQUAL( handles.size(), 4U );
+    BOOST_REQUIRE_EQUAL( boxes.size(), 4U );
+
+    for ( size_t i = 0; i < boxes.size(); i++ ) {
+        BOOST_CHECK( boxes[i].handle() == &handles[i] );
+    }
+
+    // computed again : previous handles are dropped
+    gs.computeBoundingBoxes( handles, boxes );
+    BOOST_CHECK_EQUAL( handles.size(), 4U );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/SortedCollection.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail ;
+using namespace boost::unit_test ;
+
+namespace {
+// an element ordered by key, tagged to check which duplicate is kept
+struct Tagged {
+    Tagged( int k, int t ): key( k ), tag( t ) {}
+    int key ;
+    int tag ;
+    bool operator < ( const Tagged& other ) const {
+        return key < other.key ;
+    }
+};
+}
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_SortedCollectionTest )
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    SortedCollection< int > collection ;
+    BOOST_CHECK( collection.empty() );
+    BOOST_CHECK_EQUAL( collection.size(), 0U );
+    BOOST_CHECK( collection.isNormalized() );
+}
+
+BOOST_AUTO_TEST_CASE( testInsert )
+{
+    SortedCollection< int > collection ;
+    collection.insert( 3 );
+    collection.insert( 1 );
+    collection.insert( 2 );
+    collection.insert( 1 );
+
+    BOOST_REQUIRE_EQUAL( collection.size(), 3U );
+    std::vector< int > elements( collection.begin(), collection.end() );
+    BOOST_CHECK_EQUAL( elements[0], 1 );
+    BOOST_CHECK_EQUAL( elements[1], 2 );
+    BOOST_CHECK_EQUAL( elements[2], 3 );
+}
+
+BOOST_AUTO_TEST_CASE( testInsertRange )
+{
+    const int values[] = { 5, 1, 4, 1, 5, 9, 2, 6 };
+    SortedCollection< int > collection ;
+    collection.insert( 3 );
+    collection.insert( values, values + 8 );
+
+    BOOST_REQUIRE_EQUAL( collection.size(), 7U );
+    std::vector< int > elements( collection.begin(), collection.end() );
+    const int expected[] = { 1, 2, 3, 4, 5, 6, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS( elements.begin(), elements.end(), expected, expected + 7 );
+}
+
+BOOST_AUTO_TEST_CASE( testAppendNormalize )
+{
+    SortedCollection< int > collection ;
+    collection.append( 2 );
+    collection.append( 1 );
+    collection.append( 2 );
+    BOOST_CHECK( ! collection.isNormalized() );
+
+    collection.normalize();
+    BOOST_CHECK( collection.isNormalized() );
+    BOOST_REQUIRE_EQUAL( collection.size(), 2U );
+    BOOST_CHECK_EQUAL( *collection.begin(), 1 );
+}
+
+// inserted elements are ordered once, on the first read
+BOOST_AUTO_TEST_CASE( testNormalizedOnRead )
+{
+    SortedCollection< int > collection ;
+
+    for ( int i = 1000; i > 0; i-- ) {
+        collection.insert( i % 100 );
+    }
+
+    BOOST_CHECK( ! collection.isNormalized() );
+
+    const SortedCollection< int >& read = collection ;
+    BOOST_REQUIRE_EQUAL( read.size(), 100U );
+    BOOST_CHECK( collection.isNormalized() );
+    BOOST_CHECK_EQUAL( *read.begin(), 0 );
+    BOOST_CHECK_EQUAL( *( read.end() - 1 ), 99 );
+}
+
+BOOST_AUTO_TEST_CASE( testMerge )
+{
+    SortedCollection< int > a ;
+    a.insert( 1 );
+    a.insert( 3 );
+    SortedCollection< int > b ;
+    b.insert( 2 );
+    b.insert( 3 );
+
+    a.merge( b );
+    BOOST_REQUIRE_EQUAL( a.size(), 3U );
+    std::vector< int > elements( a.begin(), a.end() );
+    BOOST_CHECK_EQUAL( elements[0], 1 );
+    BOOST_CHECK_EQUAL( elements[1], 2 );
+    BOOST_CHECK_EQUAL( elements[2], 3 );
+}
+
+// as with a std::set, the first inserted element is kept
+BOOST_AUTO_TEST_CASE( testFirstInsertedIsKept )
+{
+    SortedCollection< Tagged > collection ;
+    collection.insert( Tagged( 1, 0 ) );
+    collection.append( Tagged( 2, 1 ) );
+    collection.append( Tagged( 1, 2 ) );
+    collection.append( Tagged( 2, 3 ) );
+    collection.normalize();
+
+    BOOST_REQUIRE_EQUAL( collection.size(), 2U );
+    BOOST_CHECK_EQUAL( collection.begin()->tag, 0 );
+    BOOST_CHECK_EQUAL( ( collection.begin() + 1 )->tag, 1 );
+
+    SortedCollection< Tagged > other ;
+    other.insert( Tagged( 2, 4 ) );
+    collection.merge( other );
+    BOOST_CHECK_EQUAL( ( collection.begin() + 1 )->tag, 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,212 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/detail/algorithm/findBoxIntersection.h>
+
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+using namespace SFCGAL::detail::algorithm ;
+using namespace boost::unit_test ;
+
+namespace {
+// a minimal 2D box with the Box_d interface
+struct Box {
+    Box( int id_, double x, double y, double size ): id( id_ ) {
+        lo[0] = x ;
+        lo[1] = y ;
+        hi[0] = x + size ;
+        hi[1] = y + size ;
+    }
+    static int dimension() {
+        return 2 ;
+    }
+    double min_coord( int d ) const {
+        return lo[d] ;
+    }
+    double max_coord( int d ) const {
+        return hi[d] ;
+    }
+    int id ;
+    double lo[2] ;
+    double hi[2] ;
+};
+
+bool overlaps( const Box& a, const Box& b )
+{
+    return !( a.hi[0] < b.lo[0] || b.hi[0] < a.lo[0] || a.hi[1] < b.lo[1] || b.hi[1] < a.lo[1] );
+}
+
+// records the visited pairs, never accepts
+struct RecordPairs {
+    RecordPairs( std::multiset< std::pair< int, int > >& pairs_ ): pairs( &pairs_ ) {}
+    bool operator()( const Box& a, const Box& b ) const {
+        pairs->insert( std::make_pair( a.id, b.id ) );
+        return false ;
+    }
+    std::multiset< std::pair< int, int > >* pairs ;
+};
+
+// accepts every pair
+struct AcceptAll {
+    AcceptAll( int& calls_ ): calls( &calls_ ) {}
+    bool operator()( const Box&, const Box& ) const {
+        ++( *calls ) ;
+        return true ;
+    }
+    int* calls ;
+};
+
+// accepts a given pair
+struct AcceptPair {
+    AcceptPair( int a_, int b_, int& calls_ ): a( a_ ), b( b_ ), calls( &calls_ ) {}
+    bool operator()( const Box& boxA, const Box& boxB ) const {
+        ++( *calls ) ;
+        return boxA.id == a && boxB.id == b ;
+    }
+    int a ;
+    int b ;
+    int* calls ;
+};
+
+std::vector< Box > randomBoxes( int first, int n )
+{
+    std::vector< Box > boxes ;
+
+    for ( int i = 0; i < n; i++ ) {
+        boxes.push_back( Box( first + i, std::rand() % 100, std::rand() % 100, std::rand() % 10 ) );
+    }
+
+    return boxes ;
+}
+
+// boxes overlapping along x, spread along y
+std::vector< Box > columnBoxes( int first, int n, double y0 )
+{
+    std::vector< Box > boxes ;
+
+    for ( int i = 0; i < n; i++ ) {
+        boxes.push_back( Box( first + i, std::rand() % 3, y0 + i * 10.0, 5.0 ) );
+    }
+
+    return boxes ;
+}
+
+std::multiset< std::pair< int, int > > bruteForcePairs( const std::vector< Box >& a, const std::vector< Box >& b )
+{
+    std::multiset< std::pair< int, int > > pairs ;
+
+    for ( size_t i = 0; i < a.size(); i++ ) {
+        for ( size_t j = 0; j < b.size(); j++ ) {
+            if ( overlaps( a[i], b[j] ) ) {
+                pairs.insert( std::make_pair( a[i].id, b[j].id ) );
+            }
+        }
+    }
+
+    return pairs ;
+}
+}
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_algorithm_FindBoxIntersectionTest )
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    std::vector< Box > a, b ;
+    std::multiset< std::pair< int, int > > pairs ;
+    BOOST_CHECK( ! findBoxIntersection( a.begin(), a.end(), b.begin(), b.end(), RecordPairs( pairs ) ) );
+
+    a.push_back( Box( 0, 0.0, 0.0, 1.0 ) );
+    BOOST_CHECK( ! findBoxIntersection( a.begin(), a.end(), b.begin(), b.end(), RecordPairs( pairs ) ) );
+    BOOST_CHECK( pairs.empty() );
+}
+
+// closed boxes : touching boxes overlap
+BOOST_AUTO_TEST_CASE( testTouching )
+{
+    std::vector< Box > a, b ;
+    a.push_back( Box( 0, 0.0, 0.0, 1.0 ) );
+    b.push_back( Box( 1, 1.0, 1.0, 1.0 ) );
+
+    int calls = 0 ;
+    BOOST_CHECK( findBoxIntersection( a.begin(), a.end(), b.begin(), b.end(), AcceptPair( 0, 1, calls ) ) );
+    BOOST_CHECK_EQUAL( calls, 1 );
+}
+
+// each overlapping pair is visited once, as with a brute force test
+BOOST_AUTO_TEST_CASE( testVisitsAllPairsOnce )
+{
+    std::vector< Box > a = randomBoxes( 0, 300 );
+    std::vector< Box > b = randomBoxes( 1000, 200 );
+
+    const std::multiset< std::pair< int, int > > expected = bruteForcePairs( a, b );
+
+    std::multiset< std::pair< int, int > > pairs ;
+    BOOST_CHECK( ! findBoxIntersection( a.begin(), a.end(), b.begin(), b.end(), RecordPairs( pairs ) ) );
+    BOOST_CHECK( pairs == expected );
+}
+
+// rows are swept along x, columns along y
+BOOST_AUTO_TEST_CASE( testSweepAxis )
+{
+    std::vector< Box > a, b ;
+
+    for ( int i = 0; i < 100; i++ ) {
+        a.push_back( Box( i, i * 10.0, 0.0, 5.0 ) );
+        b.push_back( Box( 100 + i, i * 10.0 + 5.5, 1.0, 5.0 ) );
+    }
+
+    BOOST_CHECK_EQUAL( sweepAxis( a.begin(), a.end(), b.begin(), b.end() ), 0 );
+
+    a = columnBoxes( 0, 100, 0.0 );
+    b = columnBoxes( 1000, 100, 5.5 );
+    BOOST_CHECK_EQUAL( sweepAxis( a.begin(), a.end(), b.begin(), b.end() ), 1 );
+}
+
+BOOST_AUTO_TEST_CASE( testVisitsAllPairsOnceInColumns )
+{
+    std::vector< Box > a = columnBoxes( 0, 300, 0.0 );
+    std::vector< Box > b = columnBoxes( 1000, 200, 2.0 );
+    const std::multiset< std::pair< int, int > > expected = bruteForcePairs( a, b );
+    BOOST_CHECK( ! expected.empty() );
+
+    std::multiset< std::pair< int, int > > pairs ;
+    BOOST_CHECK( ! findBoxIntersection( a.begin(), a.end(), b.begin(), b.end(), RecordPairs( pairs ) ) );
+    BOOST_CHECK( pairs == expected );
+}
+
+// the traversal stops on the accepted pair
+BOOST_AUTO_TEST_CASE( testEarlyExit )
+{
+    std::vector< Box > a, b ;
+
+    for ( int i = 0; i < 100; i++ ) {
+        a.push_back( Box( i, 0.0, 0.0, 10.0 ) );
+        b.push_back( Box( 100 + i, 1.0, 1.0, 10.0 ) );
+    }
+
+    int calls = 0 ;
+    BOOST_CHECK( findBoxIntersection( a.begin(), a.end(), b.begin(), b.end(), AcceptAll( calls ) ) );
+    BOOST_CHECK_EQUAL( calls, 1 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+/**
+ *   SFCGAL
+ *
+ *   Copyright (C) 2012-2013 Oslandia <infos@oslandia.com>
+ *   Copyright (C) 2012-2013 IGN (http://www.ign.fr)
+ *
+ *   This library is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Library General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2 of the License, or (at your option) any later version.
+ *
+ *   This library is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Library General Public License for more details.
+
+ *   You should have received a copy of the GNU Library General Public
+ *   License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/test/unit_test.hpp>
+
+#include <SFCGAL/Solid.h>
+#include <SFCGAL/MultiSolid.h>
+#include <SFCGAL/Envelope.h>
+#include <SFCGAL/Exception.h>
+#include <SFCGAL/detail/algorithm/solidShells.h>
+
+using namespace SFCGAL ;
+using namespace SFCGAL::detail::algorithm ;
+using namespace boost::unit_test ;
+
+namespace {
+// shell of a cube, the sign of the volume tells an exterior shell from a cavity
+SolidShell* cubeShell( const double& xmin, const double& size, const int& sign )
+{
+    SolidShell* shell = new SolidShell ;
+    std::auto_ptr< Solid > cube( Envelope( xmin, xmin + size, xmin, xmin + size, xmin, xmin + size ).toSolid() );
+    shell->surface.reset( new PolyhedralSurface( cube->exteriorShell() ) );
+    shell->volume = sign * size * size * size ;
+    shell->sample = CGAL::Point_3< Kernel >( xmin + size / 2, xmin + size / 2, xmin );
+    return shell ;
+}
+}
+
+BOOST_AUTO_TEST_SUITE( SFCGAL_detail_algorithm_SolidShellsTest )
+
+BOOST_AUTO_TEST_CASE( testEmpty )
+{
+    boost::ptr_vector< SolidShell > shells ;
+    std::auto_ptr< Geometry > g( toSolids( shells ) );
+    BOOST_CHECK( g->isEmpty() );
+}
+
+// the cavity goes to the smallest exterior shell containing it
+BOOST_AUTO_TEST_CASE( testCavityInSmallestShell )
+{
+    boost::ptr_vector< SolidShell > shells ;
+    shells.push_back( cubeShell( 0.0, 10.0, 1 ) );
+    shells.push_back( cubeShell( 20.0, 10.0, 1 ) );
+    shells.push_back( cubeShell( 22.0, 6.0, 1 ) );
+    shells.push_back( cubeShell( 24.0, 2.0, -1 ) );
+
+    std::auto_ptr< Geometry > g( toSolids( shells ) );
+    BOOST_REQUIRE_EQUAL( g->geometryTypeId(), TYPE_MULTISOLID );
+    BOOST_REQUIRE_EQUAL( g->numGeometries(), 3U );
+    BOOST_CHECK_EQUAL( g->geometryN( 0 ).as< Solid >().numInteriorShells(), 0U );
+    BOOST_CHECK_EQUAL( g->geometryN( 1 ).as< Solid >().numInteriorShells(), 0U );
+    BOOST_CHECK_EQUAL( g->geometryN( 2 ).as< Solid >().numInteriorShells(), 1U );
+}
+
+// a cavity outside of the single exterior shell is not attached to it
+BOOST_AUTO_TEST_CASE( testCavityOutsideShell )
+{
+    boost::ptr_vector< SolidShell > shells ;
+    shells.push_back( cubeShell( 0.0, 10.0, 1 ) );
+    shells.push_back( cubeShell( 20.0, 2.0, -1 ) );
+    BOOST_CHECK_THROW( toSolids( shells ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE( testCavityOutsideShells )
+{
+    boost::ptr_vector< SolidShell > shells ;
+    shells.push_back( cubeShell( 0.0, 10.0, 1 ) );
+    shells.push_back( cubeShell( 20.0, 10.0, 1 ) );
+    shells.push_back( cubeShell( 40.0, 2.0, -1 ) );
+    BOOST_CHECK_THROW( toSolids( shells ), Exception );
+}
+
+// cavities are not dropped when there is no exterior shell
+BOOST_AUTO_TEST_CASE( testCavityWithoutShell )
+{
+    boost::ptr_vector< SolidShell > shells ;
+    shells.push_back( cubeShell( 0.0, 2.0, -1 ) );
+    BOOST_CHECK_THROW( toSolids( shells ), Exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
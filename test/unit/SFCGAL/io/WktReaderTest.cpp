@@ -63,6 +63,15 @@ BOOST_AUTO_TEST_CASE( pointXY )
     BOOST_CHECK_EQUAL( g->as< Point >().y(), 6.0 );
 }
 
+BOOST_AUTO_TEST_CASE( pointXY_exactDecimal )
+{
+    // 0.1 is not a double, it must be kept as an exact rational
+    std::auto_ptr< Geometry > g( readWkt( "POINT(0.1 0.5)" ) );
+    std::ostringstream oss;
+    oss << CGAL::exact( g->as< Point >().x() ) << " " << CGAL::exact( g->as< Point >().y() );
+    BOOST_CHECK_EQUAL( oss.str(), "1/10 1/2" );
+}
+
 BOOST_AUTO_TEST_CASE( pointXYZ_implicit )
 {
     std::auto_ptr< Geometry > g( readWkt( "POINT(4.0 5.0 6.0)" ) );
@@ -23,6 +23,8 @@
 #include <SFCGAL/io/wkt.h>
 #include <SFCGAL/detail/io/WktWriter.h>
 #include <SFCGAL/Polygon.h>
+#include <SFCGAL/TriangulatedSurface.h>
+#include <SFCGAL/algorithm/orientation.h>
 #include <SFCGAL/detail/transform/ForceZOrderPoints.h>
 
 using namespace boost::unit_test ;
@@ -45,6 +47,19 @@ BOOST_AUTO_TEST_CASE( simple )
 }
 
 
+BOOST_AUTO_TEST_CASE( triangulatedSurface )
+{
+    std::auto_ptr<Geometry> g1 = io::readWkt( "TIN(((0 0,0 1,1 0,0 0)),((1 0,1 1,0 1,1 0)))" );
+
+    transform::ForceZOrderPoints forceZ;
+    g1->accept( forceZ );
+
+    BOOST_CHECK( g1->is3D() );
+    const TriangulatedSurface& tin = g1->as<TriangulatedSurface>();
+    BOOST_CHECK( algorithm::isCounterClockWiseOriented( tin, 0 ) );
+    BOOST_CHECK( algorithm::isCounterClockWiseOriented( tin, 1 ) );
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 